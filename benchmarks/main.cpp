@@ -0,0 +1,512 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TGUI.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#elif defined(__APPLE__)
+    #include <malloc/malloc.h>
+#else
+    #include <malloc.h>
+#endif
+
+// Headless benchmarks for TGUI
+//
+// Each scene builds a stress test inside a gui that renders to an sf::RenderTexture (just like the tests do),
+// then simulates a number of frames. Every frame sends a few events to the gui, lets the scene update its widgets
+// and draws everything. The results are written as JSON, so that they can be compared between releases.
+//
+// Besides the scenes, a memory report is generated that shows how much heap memory a single widget of each type uses.
+//
+// Usage: benchmarks [--frames N] [--scene NAME] [--output FILE]
+
+namespace
+{
+    // Amount of heap allocations made by the process, used to measure the allocations per frame.
+    // On Windows the replaced operator new only counts allocations that are made from this executable, not from a TGUI dll.
+    std::atomic<std::size_t> allocationCount{0};
+
+    // Amount of bytes that are currently allocated on the heap, including the padding that malloc adds to each block.
+    // The size is asked to the allocator instead of being stored next to the memory, because memory that is allocated
+    // by a TGUI dll may be freed by this executable and the other way around.
+    std::atomic<std::size_t> allocatedBytes{0};
+
+    std::size_t getAllocationSize(void* ptr)
+    {
+    #if defined(_WIN32)
+        return _msize(ptr);
+    #elif defined(__APPLE__)
+        return malloc_size(ptr);
+    #else
+        return malloc_usable_size(ptr);
+    #endif
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        allocatedBytes += getAllocationSize(ptr);
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (!ptr)
+        return;
+
+    allocatedBytes -= getAllocationSize(ptr);
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    const unsigned int WindowWidth = 1280;
+    const unsigned int WindowHeight = 720;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Scene
+    {
+        std::string name;
+        std::function<void(tgui::Gui& gui)> create;
+        std::function<void(tgui::Gui& gui, unsigned int frame)> update;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Statistics
+    {
+        double mean = 0;
+        double median = 0;
+        double p95 = 0;
+        double max = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct SceneResult
+    {
+        std::string name;
+        unsigned int frames = 0;
+        double setupTime = 0;
+        Statistics frameTime;
+        Statistics eventTime;
+        Statistics layoutTime;
+        Statistics allocationsPerFrame;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct WidgetMemoryResult
+    {
+        std::string type;
+        double bytesPerWidget = 0;
+        double allocationsPerWidget = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double elapsedMilliseconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Statistics calculateStatistics(std::vector<double> samples)
+    {
+        Statistics stats;
+        if (samples.empty())
+            return stats;
+
+        std::sort(samples.begin(), samples.end());
+
+        double sum = 0;
+        for (const double sample : samples)
+            sum += sample;
+
+        stats.mean = sum / static_cast<double>(samples.size());
+        stats.median = samples[samples.size() / 2];
+        stats.p95 = samples[std::min(samples.size() - 1, (samples.size() * 95) / 100)];
+        stats.max = samples.back();
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Event createMouseMoveEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Event createMouseWheelEvent(int x, int y, float delta)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseWheelScrolled;
+        event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+        event.mouseWheelScroll.delta = delta;
+        event.mouseWheelScroll.x = x;
+        event.mouseWheelScroll.y = y;
+        return event;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SceneResult runScene(const Scene& scene, unsigned int frameCount)
+    {
+        SceneResult result;
+        result.name = scene.name;
+        result.frames = frameCount;
+
+        sf::RenderTexture target;
+        target.create(WindowWidth, WindowHeight);
+        tgui::Gui gui{target};
+
+        auto startTime = Clock::now();
+        scene.create(gui);
+        result.setupTime = elapsedMilliseconds(startTime);
+
+        std::vector<double> frameTimes;
+        std::vector<double> eventTimes;
+        std::vector<double> allocations;
+        frameTimes.reserve(frameCount);
+        eventTimes.reserve(frameCount * 2);
+        allocations.reserve(frameCount);
+
+        for (unsigned int frame = 0; frame < frameCount; ++frame)
+        {
+            const std::size_t allocationsBeforeFrame = allocationCount;
+            const auto frameStartTime = Clock::now();
+
+            // Move the mouse over the scene and scroll, which is what most widgets spend their event handling on
+            const int mouseX = static_cast<int>((frame * 37) % WindowWidth);
+            const int mouseY = static_cast<int>((frame * 23) % WindowHeight);
+
+            startTime = Clock::now();
+            gui.handleEvent(createMouseMoveEvent(mouseX, mouseY));
+            eventTimes.push_back(elapsedMilliseconds(startTime));
+
+            startTime = Clock::now();
+            gui.handleEvent(createMouseWheelEvent(mouseX, mouseY, (frame % 20 < 10) ? -1.f : 1.f));
+            eventTimes.push_back(elapsedMilliseconds(startTime));
+
+            if (scene.update)
+                scene.update(gui, frame);
+
+            target.clear();
+            gui.draw();
+            target.display();
+
+            frameTimes.push_back(elapsedMilliseconds(frameStartTime));
+            allocations.push_back(static_cast<double>(allocationCount - allocationsBeforeFrame));
+        }
+
+        // Measure how long it takes to recalculate the layouts when the window is resized
+        std::vector<double> layoutTimes;
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            const float scale = (i % 2 == 0) ? 0.75f : 1.f;
+            startTime = Clock::now();
+            gui.setView(sf::View{sf::FloatRect{0, 0, WindowWidth * scale, WindowHeight * scale}});
+            layoutTimes.push_back(elapsedMilliseconds(startTime));
+        }
+
+        result.frameTime = calculateStatistics(frameTimes);
+        result.eventTime = calculateStatistics(eventTimes);
+        result.layoutTime = calculateStatistics(layoutTimes);
+        result.allocationsPerFrame = calculateStatistics(allocations);
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Scene> createScenes()
+    {
+        std::vector<Scene> scenes;
+
+        scenes.push_back({"buttons_10k",
+            [](tgui::Gui& gui)
+            {
+                // 100 columns and 100 rows of buttons, positioned relative to the size of the window
+                for (unsigned int i = 0; i < 10000; ++i)
+                {
+                    auto button = tgui::Button::create("Button");
+                    button->setSize({"1%", "1%"});
+                    button->setPosition({tgui::bindWidth(gui) * ((i % 100) / 100.f), tgui::bindHeight(gui) * ((i / 100) / 100.f)});
+                    gui.add(button);
+                }
+            },
+            nullptr
+        });
+
+        scenes.push_back({"listview_100k_rows",
+            [](tgui::Gui& gui)
+            {
+                auto listView = tgui::ListView::create();
+                listView->setSize({"100%", "100%"});
+                listView->addColumn("Id", 100);
+                listView->addColumn("Name", 300);
+                listView->addColumn("Value", 200);
+                for (unsigned int i = 0; i < 100000; ++i)
+                    listView->addItem({tgui::to_string(i), "Item " + tgui::to_string(i), tgui::to_string(i * 7 % 1000)});
+
+                gui.add(listView, "ListView");
+            },
+            nullptr
+        });
+
+        scenes.push_back({"textbox_1mb",
+            [](tgui::Gui& gui)
+            {
+                const std::string line = "The quick brown fox jumps over the lazy dog. 0123456789\n";
+                std::string text;
+                text.reserve(1024 * 1024 + line.size());
+                while (text.size() < 1024 * 1024)
+                    text += line;
+
+                auto textBox = tgui::TextBox::create();
+                textBox->setSize({"100%", "100%"});
+                textBox->setText(text);
+                gui.add(textBox, "TextBox");
+            },
+            nullptr
+        });
+
+        scenes.push_back({"treeview_deep",
+            [](tgui::Gui& gui)
+            {
+                // 40 branches that are each 50 levels deep
+                auto treeView = tgui::TreeView::create();
+                treeView->setSize({"100%", "100%"});
+                for (unsigned int branch = 0; branch < 40; ++branch)
+                {
+                    std::vector<sf::String> hierarchy;
+                    for (unsigned int depth = 0; depth < 50; ++depth)
+                    {
+                        hierarchy.push_back("Node " + tgui::to_string(branch) + "." + tgui::to_string(depth));
+                        treeView->addItem(hierarchy);
+                    }
+                }
+
+                treeView->expandAll();
+                gui.add(treeView, "TreeView");
+            },
+            nullptr
+        });
+
+        scenes.push_back({"chatbox_5k_lines_per_second",
+            [](tgui::Gui& gui)
+            {
+                auto chatBox = tgui::ChatBox::create();
+                chatBox->setSize({"100%", "100%"});
+                chatBox->setLineLimit(10000);
+                gui.add(chatBox, "ChatBox");
+            },
+            [](tgui::Gui& gui, unsigned int frame)
+            {
+                // 5000 lines per second at 60 frames per second
+                auto chatBox = gui.get<tgui::ChatBox>("ChatBox");
+                const unsigned int firstLine = frame * 5000 / 60;
+                const unsigned int lastLine = (frame + 1) * 5000 / 60;
+                for (unsigned int i = firstLine; i < lastLine; ++i)
+                    chatBox->addLine("Line " + tgui::to_string(i) + ": the quick brown fox jumps over the lazy dog");
+            }
+        });
+
+        return scenes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<WidgetMemoryResult> measureWidgetMemory()
+    {
+        const std::vector<std::string> types = {
+            "BitmapButton", "Button", "ChatBox", "CheckBox", "ChildWindow", "ClickableWidget", "ComboBox", "EditBox", "Group",
+            "Knob", "Label", "ListBox", "ListView", "MenuBar", "Panel", "Picture", "ProgressBar", "RadioButton", "RangeSlider",
+            "ScrollablePanel", "Scrollbar", "Slider", "SpinButton", "Tabs", "TextBox", "TreeView"
+        };
+
+        const unsigned int widgetCount = 1000;
+
+        std::vector<WidgetMemoryResult> results;
+        for (const auto& type : types)
+        {
+            const auto& constructor = tgui::WidgetFactory::getConstructFunction(type);
+
+            // Create one widget up front so that allocations that are only made once (e.g. loading the theme) aren't counted
+            constructor();
+
+            std::vector<tgui::Widget::Ptr> widgets;
+            widgets.reserve(widgetCount);
+
+            const std::size_t bytesBefore = allocatedBytes;
+            const std::size_t allocationsBefore = allocationCount;
+            for (unsigned int i = 0; i < widgetCount; ++i)
+                widgets.push_back(constructor());
+
+            WidgetMemoryResult result;
+            result.type = type;
+            result.bytesPerWidget = static_cast<double>(allocatedBytes - bytesBefore) / widgetCount;
+            result.allocationsPerWidget = static_cast<double>(allocationCount - allocationsBefore) / widgetCount;
+            results.push_back(result);
+        }
+
+        return results;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeStatistics(std::ostream& out, const std::string& name, const Statistics& stats, bool last = false)
+    {
+        out << "      \"" << name << "\": {\"mean\": " << stats.mean << ", \"median\": " << stats.median
+            << ", \"p95\": " << stats.p95 << ", \"max\": " << stats.max << "}" << (last ? "\n" : ",\n");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeJson(std::ostream& out, const std::vector<SceneResult>& results, const std::vector<WidgetMemoryResult>& memoryResults)
+    {
+        out << "{\n";
+        out << "  \"tgui_version\": \"" << TGUI_VERSION_MAJOR << "." << TGUI_VERSION_MINOR << "." << TGUI_VERSION_PATCH << "\",\n";
+        out << "  \"width\": " << WindowWidth << ",\n";
+        out << "  \"height\": " << WindowHeight << ",\n";
+        out << "  \"scenes\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const SceneResult& result = results[i];
+            out << "    {\n";
+            out << "      \"name\": \"" << result.name << "\",\n";
+            out << "      \"frames\": " << result.frames << ",\n";
+            out << "      \"setup_ms\": " << result.setupTime << ",\n";
+            writeStatistics(out, "frame_ms", result.frameTime);
+            writeStatistics(out, "event_ms", result.eventTime);
+            writeStatistics(out, "layout_ms", result.layoutTime);
+            writeStatistics(out, "allocations_per_frame", result.allocationsPerFrame, true);
+            out << ((i + 1 < results.size()) ? "    },\n" : "    }\n");
+        }
+        out << "  ],\n";
+        out << "  \"widget_memory\": [\n";
+        for (std::size_t i = 0; i < memoryResults.size(); ++i)
+        {
+            const WidgetMemoryResult& result = memoryResults[i];
+            out << "    {\"type\": \"" << result.type << "\", \"bytes_per_widget\": " << result.bytesPerWidget
+                << ", \"allocations_per_widget\": " << result.allocationsPerWidget << "}"
+                << ((i + 1 < memoryResults.size()) ? ",\n" : "\n");
+        }
+        out << "  ]\n";
+        out << "}\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    unsigned int frameCount = 120;
+    std::string sceneFilter;
+    std::string outputFilename;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "--frames") == 0) && (i + 1 < argc))
+            frameCount = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        else if ((std::strcmp(argv[i], "--scene") == 0) && (i + 1 < argc))
+            sceneFilter = argv[++i];
+        else if ((std::strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+            outputFilename = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--frames N] [--scene NAME] [--output FILE]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<SceneResult> results;
+    for (const auto& scene : createScenes())
+    {
+        if (!sceneFilter.empty() && (scene.name != sceneFilter))
+            continue;
+
+        std::cerr << "Running " << scene.name << "..." << std::endl;
+        results.push_back(runScene(scene, frameCount));
+    }
+
+    // The memory report is skipped when only a single scene was requested
+    std::vector<WidgetMemoryResult> memoryResults;
+    if (sceneFilter.empty())
+    {
+        std::cerr << "Measuring widget memory..." << std::endl;
+        memoryResults = measureWidgetMemory();
+    }
+
+    if (outputFilename.empty())
+        writeJson(std::cout, results, memoryResults);
+    else
+    {
+        std::ofstream out{outputFilename};
+        if (!out.is_open())
+        {
+            std::cerr << "Failed to open '" << outputFilename << "' for writing." << std::endl;
+            return 1;
+        }
+
+        writeJson(out, results, memoryResults);
+    }
+
+    return 0;
+}
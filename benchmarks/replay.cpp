@@ -0,0 +1,349 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/TGUI.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Headless replay of an event recording
+//
+// The widgets are loaded from a form file into a gui that renders to an sf::RenderTexture (just like the tests do).
+// The events, time updates and view changes that were recorded with Gui::startRecording are then passed to the gui in their
+// original order, with the recorded time steps instead of the real time, so that every run goes through the exact same states.
+// When the window was resized during the recording, the render texture is resized along with the view.
+// The time spent on each event and each frame is written as JSON and the frames can optionally be saved as images,
+// which allows comparing the results between machines or releases.
+//
+// Usage: replay --form FILE --recording FILE [--repeat N] [--dump-frames DIR] [--output FILE]
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Statistics
+    {
+        double mean = 0;
+        double median = 0;
+        double p95 = 0;
+        double max = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct EventTiming
+    {
+        std::size_t entryIndex = 0;
+        sf::Event::EventType type = sf::Event::Closed;
+        double timestamp = 0;
+        double time = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct ReplayResult
+    {
+        std::size_t events = 0;
+        std::size_t frames = 0;
+        double loadTime = 0;
+        Statistics eventTime;
+        Statistics updateTime;
+        Statistics drawTime;
+        Statistics frameTime;
+        std::vector<EventTiming> slowestEvents;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double elapsedMilliseconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Statistics calculateStatistics(std::vector<double> samples)
+    {
+        Statistics stats;
+        if (samples.empty())
+            return stats;
+
+        std::sort(samples.begin(), samples.end());
+
+        double sum = 0;
+        for (const double sample : samples)
+            sum += sample;
+
+        stats.mean = sum / static_cast<double>(samples.size());
+        stats.median = samples[samples.size() / 2];
+        stats.p95 = samples[std::min(samples.size() - 1, (samples.size() * 95) / 100)];
+        stats.max = samples.back();
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string getEventTypeName(sf::Event::EventType type)
+    {
+        static const char* const names[] = {
+            "Closed", "Resized", "LostFocus", "GainedFocus", "TextEntered", "KeyPressed", "KeyReleased", "MouseWheelMoved",
+            "MouseWheelScrolled", "MouseButtonPressed", "MouseButtonReleased", "MouseMoved", "MouseEntered", "MouseLeft",
+            "JoystickButtonPressed", "JoystickButtonReleased", "JoystickMoved", "JoystickConnected", "JoystickDisconnected",
+            "TouchBegan", "TouchMoved", "TouchEnded", "SensorChanged"
+        };
+
+        const auto index = static_cast<std::size_t>(type);
+        if (index < sizeof(names) / sizeof(names[0]))
+            return names[index];
+        else
+            return "Unknown";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string getFrameFilename(const std::string& directory, std::size_t frame)
+    {
+        char number[16];
+        std::snprintf(number, sizeof(number), "%05u", static_cast<unsigned int>(frame));
+        return directory + "/frame_" + number + ".png";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ReplayResult replay(const std::string& formFilename, const tgui::EventRecording& recording, const std::string& frameDirectory)
+    {
+        ReplayResult result;
+
+        sf::Vector2u targetSize = recording.getTargetSize();
+        if ((targetSize.x == 0) || (targetSize.y == 0))
+            targetSize = {800, 600};
+
+        sf::RenderTexture target;
+        target.create(targetSize.x, targetSize.y);
+        tgui::Gui gui{target};
+        gui.setAutomaticTimeUpdateEnabled(false);
+
+        const sf::FloatRect view = recording.getView();
+        if ((view.width > 0) && (view.height > 0))
+            gui.setView(sf::View{view});
+
+        auto startTime = Clock::now();
+        gui.loadWidgetsFromFile(formFilename);
+        result.loadTime = elapsedMilliseconds(startTime);
+
+        std::vector<double> eventTimes;
+        std::vector<double> updateTimes;
+        std::vector<double> drawTimes;
+        std::vector<double> frameTimes;
+        std::vector<EventTiming> eventTimings;
+
+        // A frame consists of the events that were handled since the previous time update, the update itself and drawing
+        double frameEventTime = 0;
+        const auto& entries = recording.getEntries();
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            const tgui::EventRecording::Entry& entry = entries[i];
+            if (entry.type == tgui::EventRecording::Entry::Type::Event)
+            {
+                startTime = Clock::now();
+                gui.handleEvent(entry.event);
+                const double time = elapsedMilliseconds(startTime);
+
+                EventTiming timing;
+                timing.entryIndex = i;
+                timing.type = entry.event.type;
+                timing.timestamp = entry.timestamp.asMicroseconds() / 1000.0;
+                timing.time = time;
+                eventTimings.push_back(timing);
+
+                eventTimes.push_back(time);
+                frameEventTime += time;
+            }
+            else if (entry.type == tgui::EventRecording::Entry::Type::View)
+            {
+                // The mouse positions are mapped with the viewport of the target, so its size has to match as well
+                if ((entry.targetSize.x > 0) && (entry.targetSize.y > 0) && (entry.targetSize != target.getSize()))
+                    target.create(entry.targetSize.x, entry.targetSize.y);
+
+                gui.setView(sf::View{entry.view});
+            }
+            else
+            {
+                startTime = Clock::now();
+                gui.updateTime(entry.elapsedTime);
+                const double updateTime = elapsedMilliseconds(startTime);
+
+                startTime = Clock::now();
+                target.clear();
+                gui.draw();
+                target.display();
+                const double drawTime = elapsedMilliseconds(startTime);
+
+                if (!frameDirectory.empty())
+                    target.getTexture().copyToImage().saveToFile(getFrameFilename(frameDirectory, frameTimes.size()));
+
+                updateTimes.push_back(updateTime);
+                drawTimes.push_back(drawTime);
+                frameTimes.push_back(frameEventTime + updateTime + drawTime);
+                frameEventTime = 0;
+            }
+        }
+
+        std::sort(eventTimings.begin(), eventTimings.end(), [](const EventTiming& left, const EventTiming& right){ return left.time > right.time; });
+        if (eventTimings.size() > 10)
+            eventTimings.resize(10);
+
+        result.events = eventTimes.size();
+        result.frames = frameTimes.size();
+        result.eventTime = calculateStatistics(eventTimes);
+        result.updateTime = calculateStatistics(updateTimes);
+        result.drawTime = calculateStatistics(drawTimes);
+        result.frameTime = calculateStatistics(frameTimes);
+        result.slowestEvents = std::move(eventTimings);
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeStatistics(std::ostream& out, const std::string& name, const Statistics& stats, bool last = false)
+    {
+        out << "      \"" << name << "\": {\"mean\": " << stats.mean << ", \"median\": " << stats.median
+            << ", \"p95\": " << stats.p95 << ", \"max\": " << stats.max << "}" << (last ? "\n" : ",\n");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeJson(std::ostream& out, const tgui::EventRecording& recording, const std::vector<ReplayResult>& results)
+    {
+        out << "{\n";
+        out << "  \"tgui_version\": \"" << TGUI_VERSION_MAJOR << "." << TGUI_VERSION_MINOR << "." << TGUI_VERSION_PATCH << "\",\n";
+        out << "  \"width\": " << recording.getTargetSize().x << ",\n";
+        out << "  \"height\": " << recording.getTargetSize().y << ",\n";
+        out << "  \"runs\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const ReplayResult& result = results[i];
+            out << "    {\n";
+            out << "      \"events\": " << result.events << ",\n";
+            out << "      \"frames\": " << result.frames << ",\n";
+            out << "      \"load_ms\": " << result.loadTime << ",\n";
+            writeStatistics(out, "event_ms", result.eventTime);
+            writeStatistics(out, "update_ms", result.updateTime);
+            writeStatistics(out, "draw_ms", result.drawTime);
+            writeStatistics(out, "frame_ms", result.frameTime);
+            out << "      \"slowest_events\": [\n";
+            for (std::size_t j = 0; j < result.slowestEvents.size(); ++j)
+            {
+                const EventTiming& timing = result.slowestEvents[j];
+                out << "        {\"entry\": " << timing.entryIndex << ", \"type\": \"" << getEventTypeName(timing.type)
+                    << "\", \"timestamp_ms\": " << timing.timestamp << ", \"time_ms\": " << timing.time << "}"
+                    << ((j + 1 < result.slowestEvents.size()) ? ",\n" : "\n");
+            }
+            out << "      ]\n";
+            out << ((i + 1 < results.size()) ? "    },\n" : "    }\n");
+        }
+        out << "  ]\n";
+        out << "}\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    std::string formFilename;
+    std::string recordingFilename;
+    std::string frameDirectory;
+    std::string outputFilename;
+    unsigned int repeatCount = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "--form") == 0) && (i + 1 < argc))
+            formFilename = argv[++i];
+        else if ((std::strcmp(argv[i], "--recording") == 0) && (i + 1 < argc))
+            recordingFilename = argv[++i];
+        else if ((std::strcmp(argv[i], "--repeat") == 0) && (i + 1 < argc))
+            repeatCount = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        else if ((std::strcmp(argv[i], "--dump-frames") == 0) && (i + 1 < argc))
+            frameDirectory = argv[++i];
+        else if ((std::strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+            outputFilename = argv[++i];
+        else
+        {
+            formFilename.clear();
+            break;
+        }
+    }
+
+    if (formFilename.empty() || recordingFilename.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " --form FILE --recording FILE [--repeat N] [--dump-frames DIR] [--output FILE]" << std::endl;
+        return 1;
+    }
+
+    std::vector<ReplayResult> results;
+    try
+    {
+        tgui::EventRecording recording;
+        recording.loadFromFile(recordingFilename);
+
+        // Every run starts from a freshly loaded form. Frames are only saved during the first run.
+        for (unsigned int run = 0; run < repeatCount; ++run)
+        {
+            std::cerr << "Replaying " << recording.getEntries().size() << " entries (run " << (run + 1) << "/" << repeatCount << ")..." << std::endl;
+            results.push_back(replay(formFilename, recording, (run == 0) ? frameDirectory : ""));
+        }
+
+        if (outputFilename.empty())
+            writeJson(std::cout, recording, results);
+        else
+        {
+            std::ofstream out{outputFilename};
+            if (!out.is_open())
+            {
+                std::cerr << "Failed to open '" << outputFilename << "' for writing." << std::endl;
+                return 1;
+            }
+
+            writeJson(out, recording, results);
+        }
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
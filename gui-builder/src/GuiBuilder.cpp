@@ -149,8 +149,8 @@ namespace
                 if ((themeIt->second.getType() == tgui::ObjectConverter::Type::RendererData)
                  && (widgetPropertyValuePairs[themeIt->first].getType() == tgui::ObjectConverter::Type::RendererData))
                 {
-                    if (compareRenderers(themeIt->second.getRenderer()->propertyValuePairs,
-                                         widgetPropertyValuePairs[themeIt->first].getRenderer()->propertyValuePairs))
+                    if (compareRenderers(themeIt->second.getRenderer()->getAllPropertyValuePairs(),
+                                         widgetPropertyValuePairs[themeIt->first].getRenderer()->getAllPropertyValuePairs()))
                     {
                         continue;
                     }
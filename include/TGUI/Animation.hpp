@@ -28,8 +28,11 @@
 
 #include <TGUI/Vector2f.hpp>
 #include <SFML/System/Time.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,98 +58,344 @@ namespace tgui
         SlideFromBottom = SlideToTop  ///< Slide from bottom to show or to the top to hide
     };
 
-    namespace priv
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that maps the elapsed fraction of a tween to the fraction of the distance between its start and end value
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class Easing
+    {
+        Linear,          ///< Constant speed
+        QuadraticIn,     ///< Start slowly and accelerate
+        QuadraticOut,    ///< Start fast and decelerate
+        QuadraticInOut,  ///< Accelerate during the first half and decelerate during the second half
+        CubicIn,         ///< Like QuadraticIn, but with a stronger acceleration
+        CubicOut,        ///< Like QuadraticOut, but with a stronger deceleration
+        CubicInOut       ///< Like QuadraticInOut, but with a stronger acceleration and deceleration
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Animates values from a start value to an end value over time
+    ///
+    /// Every gui has its own tween engine, which is advanced by Gui::updateTime once per frame. Widget::showWithEffect and
+    /// Widget::hideWithEffect use it to move, resize and fade widgets, but it can also animate any other property:
+    /// @code
+    /// gui.getTweenEngine().tween(0.f, 100.f, sf::milliseconds(300),
+    ///     [slider](float value){ slider->setValue(value); }, tgui::Easing::QuadraticOut);
+    /// @endcode
+    ///
+    /// Widgets that aren't part of a gui use the tween engine of the current context instead, whose tweens are advanced
+    /// one widget at a time when Widget::update is called.
+    ///
+    /// The tweens are stored as parallel arrays, so that the progress and the values of all tweens are calculated in a few
+    /// tight loops. The tweened position, size and opacity of a widget are afterwards written to it in a single step,
+    /// no matter in what order its tweens were started.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TweenEngine
     {
+    public:
+
+        typedef std::uint64_t TweenId; ///< Identifier of a tween, which is never 0
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenEngine();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, which discards the running tweens without finishing them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~TweenEngine();
+
+
+        TweenEngine(const TweenEngine&) = delete;
+        TweenEngine& operator=(const TweenEngine&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves a widget from one position to another
+        ///
+        /// @param widget            Widget to move
+        /// @param start             Position of the widget at the start of the tween
+        /// @param end               Position of the widget at the end of the tween
+        /// @param duration          How long it takes to reach the end position
+        /// @param easing            Curve that determines the speed of the movement
+        /// @param finishedCallback  Function to call after the widget reached its end position
+        ///
+        /// @return Identifier of the tween
+        ///
+        /// If the widget was already being moved then that tween is finished immediately.
+        /// The engine doesn't keep the widget alive, the tween is dropped without calling the callback when the widget is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenId moveWidget(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration,
+                           Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of a widget from one size to another
+        ///
+        /// @param widget            Widget to resize
+        /// @param start             Size of the widget at the start of the tween
+        /// @param end               Size of the widget at the end of the tween
+        /// @param duration          How long it takes to reach the end size
+        /// @param easing            Curve that determines the speed of the resizing
+        /// @param finishedCallback  Function to call after the widget reached its end size
+        ///
+        /// @return Identifier of the tween
+        ///
+        /// If the widget was already being resized then that tween is finished immediately.
+        /// The engine doesn't keep the widget alive, the tween is dropped without calling the callback when the widget is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenId resizeWidget(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration,
+                             Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the inherited opacity of a widget from one value to another
+        ///
+        /// @param widget            Widget to fade
+        /// @param start             Opacity of the widget at the start of the tween, between 0 and 1
+        /// @param end               Opacity of the widget at the end of the tween, between 0 and 1
+        /// @param duration          How long it takes to reach the end opacity
+        /// @param easing            Curve that determines the speed of the fading
+        /// @param finishedCallback  Function to call after the widget reached its end opacity
+        ///
+        /// @return Identifier of the tween
+        ///
+        /// If the widget was already being faded then that tween is finished immediately.
+        /// The engine doesn't keep the widget alive, the tween is dropped without calling the callback when the widget is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenId fadeWidget(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration,
+                           Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Animates an arbitrary value
+        ///
+        /// @param start             Value at the start of the tween
+        /// @param end               Value at the end of the tween
+        /// @param duration          How long it takes to reach the end value
+        /// @param setter            Function that is called with the new value every time the engine is updated
+        /// @param easing            Curve that determines how the value changes over time
+        /// @param finishedCallback  Function to call after the setter was called with the end value
+        ///
+        /// @return Identifier of the tween
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenId tween(float start, float end, sf::Time duration, std::function<void(float)> setter,
+                      Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Animates an arbitrary two-dimensional value
+        ///
+        /// @param start             Value at the start of the tween
+        /// @param end               Value at the end of the tween
+        /// @param duration          How long it takes to reach the end value
+        /// @param setter            Function that is called with the new value every time the engine is updated
+        /// @param easing            Curve that determines how the value changes over time
+        /// @param finishedCallback  Function to call after the setter was called with the end value
+        ///
+        /// @return Identifier of the tween
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenId tween(Vector2f start, Vector2f end, sf::Time duration, std::function<void(Vector2f)> setter,
+                      Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Jumps to the end of a tween
+        ///
+        /// @param id  Identifier of the tween
+        ///
+        /// @return True when the tween was finished, false when it no longer existed
+        ///
+        /// The end value is applied and the finished callback is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool finish(TweenId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops a tween at its current value, without calling its finished callback
+        ///
+        /// @param id  Identifier of the tween
+        ///
+        /// @return True when the tween was stopped, false when it no longer existed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool cancel(TweenId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a tween is still running
+        ///
+        /// @param id  Identifier of the tween
+        ///
+        /// @return False when the tween finished or was cancelled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRunning(TweenId id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of tweens that are running
+        ///
+        /// @return Amount of tweens that haven't finished yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTweenCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Advances all tweens
+        ///
+        /// @param elapsedTime  Time passed since the previous update
+        ///
+        /// This function is called by Gui::updateTime, you only need to call it yourself when using an engine without a gui.
+        ///
+        /// The tweens of a widget are paused while the widget or one of its parents is hidden, or when the widget isn't part of
+        /// a container, in the same way that such a widget isn't updated. Tweens of widgets that no longer exist are dropped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the eased progress of a tween
+        ///
+        /// @param easing    Easing curve
+        /// @param progress  Elapsed fraction of the duration, between 0 and 1
+        ///
+        /// @return Fraction of the distance between start and end value, which is 0 and 1 at the start and end respectively
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float applyEasing(Easing easing, float progress);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Advances only the tweens of a single widget
+        ///
+        /// Called from Widget::update for the tweens that were started while the widget wasn't part of a gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidget(const Widget* widget, sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
 
-        class TGUI_API Animation
+        // Property that a tween writes to
+        enum class Property : std::uint8_t
         {
-        public:
-            enum class Type
-            {
-                None = 0,
-                Move = 1,
-                Resize = 2,
-                Fade = 4
-            };
-
-            // Move constructor has to be explicitly declared since this class has a destructor
-            Animation() = default;
-            Animation(const Animation&) = default;
-            Animation(Animation&&) = default;
-            Animation& operator=(const Animation&) = default;
-            Animation& operator=(Animation&&) = default;
-            virtual ~Animation() = default;
-
-            Type getType() const;
-
-            virtual bool update(sf::Time elapsedTime) = 0;
-            virtual void finish();
-
-        protected:
-            Animation(Type type, std::shared_ptr<Widget> widget, sf::Time duration, std::function<void()> finishedCallback);
-
-        protected:
-            Type m_type = Type::None;
-            std::shared_ptr<Widget> m_widget;
-
-            sf::Time m_totalDuration;
-            sf::Time m_elapsedTime;
-
-            std::function<void()> m_finishedCallback;
+            Position,
+            Size,
+            Opacity,
+            Custom
         };
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Data that is only needed when a tween is applied or finished
+        struct Target
+        {
+            std::size_t widgetSlot;  // Index in m_widgetSlots, or NoWidget for custom tweens
+            Property property;
+            std::function<void(Vector2f)> setter;
+            std::function<void()> finishedCallback;
+        };
 
-        class TGUI_API MoveAnimation : public Animation
+        // Widget that has at least one running tween, combined with the values that are written to it during an update
+        struct WidgetSlot
         {
-        public:
-            MoveAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
+            std::weak_ptr<Widget> widget;
+            const Widget* key = nullptr; // Key in m_widgetSlotIndices, which remains known after the widget was destroyed
+            std::size_t tweenCount = 0;
+            unsigned int pendingProperties = 0;
+            Vector2f position;
+            Vector2f size;
+            float opacity = 1;
+            bool paused = false;
+        };
 
-            bool update(sf::Time elapsedTime) override;
+        static const std::size_t NoWidget = static_cast<std::size_t>(-1);
 
-            void finish() override;
 
-        private:
-            Vector2f m_startPos;
-            Vector2f m_endPos;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a tween to the arrays and returns its id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenId addTween(Vector2f start, Vector2f end, sf::Time duration, Easing easing, Target&& target);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a tween for a property of a widget, after finishing the tween that was already animating that property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenId addWidgetTween(std::shared_ptr<Widget> widget, Property property, Vector2f start, Vector2f end, sf::Time duration,
+                               Easing easing, std::function<void()> finishedCallback);
 
-        class TGUI_API ResizeAnimation : public Animation
-        {
-        public:
-            ResizeAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
 
-            bool update(sf::Time elapsedTime) override;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of a tween in the arrays, or m_ids.size() when it doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findTween(TweenId id) const;
 
-            void finish() override;
 
-        private:
-            Vector2f m_startSize;
-            Vector2f m_endSize;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the current values of the tweens in the range [begin, end)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void calculateValues(std::size_t begin, std::size_t end);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the value of a tween in its widget slot or passes it to its setter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collectValue(std::size_t index);
 
-        class TGUI_API FadeAnimation : public Animation
-        {
-        public:
-            FadeAnimation(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
 
-            bool update(sf::Time elapsedTime) override;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Immediately writes the value of a tween to its widget or passes it to its setter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyValue(std::size_t index);
 
-            void finish() override;
 
-        private:
-            float m_startOpacity;
-            float m_endOpacity;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Writes the collected values of the widget slots to their widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyWidgetValues();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the tweens of widgets that were destroyed as cancelled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelExpiredWidgetTweens();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the tweens that were marked as finished or cancelled and calls the callbacks of the finished ones
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFinishedTweens();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // One element per tween in every array. The ids are always sorted, as tweens are only appended or removed.
+        // Times are stored in microseconds, so that they add up exactly like sf::Time does.
+        std::vector<TweenId> m_ids;
+        std::vector<std::int64_t> m_elapsed;
+        std::vector<std::int64_t> m_duration;
+        std::vector<float> m_progress;
+        std::vector<float> m_startX;
+        std::vector<float> m_startY;
+        std::vector<float> m_endX;
+        std::vector<float> m_endY;
+        std::vector<float> m_valueX;
+        std::vector<float> m_valueY;
+        std::vector<Easing> m_easing;
+        std::vector<std::uint8_t> m_removed; // 1 when finished, 2 when cancelled
+        std::vector<Target> m_targets;
+
+        std::vector<std::uint8_t> m_paused; // Recalculated in every update, 1 when the widget of the tween is hidden
+
+        std::vector<WidgetSlot> m_widgetSlots;
+        std::unordered_map<const Widget*, std::size_t> m_widgetSlotIndices;
+
+        TweenId m_lastId = 0;
+        bool m_updating = false;
+        bool m_hasRemovedTweens = false;
+    };
 
-    } // namespace priv
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace tgui
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@
 
 namespace tgui
 {
+    class RenderBackend;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Clipping
@@ -63,7 +65,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        // Sets the view used by the gui, which the calculations have to take into account when changing the view for clipping
+        // Sets the view used by the gui, which the calculations have to take into account when changing the view for clipping.
+        // The view is stored in the current context, so that guis on different threads don't overwrite each other's view.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void setGuiView(const sf::View& view);
 
@@ -73,8 +76,7 @@ namespace tgui
 
         sf::RenderTarget& m_target;
         sf::View m_oldView;
-
-        static sf::View m_originalView;
+        RenderBackend* m_backend = nullptr;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
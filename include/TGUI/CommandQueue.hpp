@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_COMMAND_QUEUE_HPP
+#define TGUI_COMMAND_QUEUE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <functional>
+#include <atomic>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the commands that were posted to a CommandQueue
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct CommandQueueStats
+    {
+        std::size_t postedCommands = 0;      ///< Amount of commands that were posted since the queue was created
+        std::size_t executedCommands = 0;    ///< Amount of commands that were executed since the queue was created
+        std::size_t pendingCommands = 0;     ///< Amount of commands that are waiting to be executed
+        std::size_t peakPendingCommands = 0; ///< Highest amount of pending commands seen at the start of an execute call
+        std::size_t throttledBatches = 0;    ///< Amount of execute calls that had to leave commands in the queue
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Queue that allows any thread to schedule work on the thread that owns the gui
+    ///
+    /// Posting is lock-free and never waits for the consumer, while the commands are executed in the order in which they were
+    /// posted by the single thread that calls execute. The Gui owns such a queue and executes it every frame, see Gui::post.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CommandQueue
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, which discards the commands that weren't executed yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CommandQueue();
+
+
+        CommandQueue(const CommandQueue&) = delete;
+        CommandQueue& operator=(const CommandQueue&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to the queue
+        ///
+        /// @param command  Function to call on the thread that executes the queue
+        ///
+        /// This function may be called from any thread at any time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the commands in the queue
+        ///
+        /// @param maxCommands  Maximum amount of commands to execute, or 0 to execute all commands
+        ///
+        /// @return Amount of commands that were executed
+        ///
+        /// Only one thread may call this function. Commands that are posted while executing will be executed as well,
+        /// as long as the maximum has not yet been reached.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t execute(std::size_t maxCommands = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the posted and executed commands
+        ///
+        /// @return Statistics of the queue
+        ///
+        /// The values are only approximate when other threads are posting commands at the same time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueueStats getStats() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            std::function<void()> command;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Links a node after the last node of the queue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushNode(Node* node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Unlinks the first node of the queue, returns nullptr when the queue is empty or a producer is still linking a node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Node* popNode();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::atomic<Node*> m_head; // Last posted node, updated by the producers
+        Node* m_tail;              // Oldest node, only used by the consumer
+        Node m_stub;
+
+        std::atomic<std::size_t> m_postedCommands{0};
+        std::atomic<std::size_t> m_executedCommands{0};
+        std::atomic<std::size_t> m_peakPendingCommands{0};
+        std::atomic<std::size_t> m_throttledBatches{0};
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMMAND_QUEUE_HPP
@@ -27,6 +27,7 @@
 #define TGUI_CONTAINER_HPP
 
 
+#include <unordered_map>
 #include <list>
 
 #include <TGUI/Widget.hpp>
@@ -140,6 +141,9 @@ namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// The name can also be a path of names separated by slashes (e.g. "Sidebar/Settings/Volume"), in which case each
+        /// name is looked up in the direct children of the container found by the previous name.
+        ///
         /// @return Pointer to the earlier added widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -395,6 +399,12 @@ namespace tgui
     protected:
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute position of this container and of all widgets inside it as outdated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateAbsolutePosition() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
@@ -441,12 +451,23 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the first direct child with the given name, or nullptr when there is no such child
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getChildByName(const sf::String& widgetName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::vector<Widget::Ptr> m_widgets;
         std::vector<sf::String>  m_widgetNames;
 
+        // Maps the names of the children to the index of the first widget with that name. It is rebuilt when needed, so
+        // derived classes that change m_widgetNames directly have to set m_widgetNameIndexValid to false.
+        mutable std::unordered_map<sf::String, std::size_t, StringHasher> m_widgetNameIndex;
+        mutable bool m_widgetNameIndexValid = false;
+
         Widget::Ptr m_widgetBelowMouse;
         Widget::Ptr m_focusedWidget;
 
@@ -513,6 +534,15 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the tween engine that animates the widgets in this container
+        ///
+        /// @return Tween engine of the gui
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenEngine& getTweenEngine();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -537,6 +567,8 @@ namespace tgui
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
+        TweenEngine m_tweenEngine;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
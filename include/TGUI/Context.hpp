@@ -0,0 +1,332 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_CONTEXT_HPP
+#define TGUI_CONTEXT_HPP
+
+
+#include <TGUI/Animation.hpp>
+#include <TGUI/Font.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Time.hpp>
+#include <cstdint>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Theme;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief State that is shared by all widgets of a gui, such as the global font, text size and default theme
+    ///
+    /// Each thread has a current context. Threads that never select one use the default context, so programs with a single
+    /// gui don't have to deal with contexts at all. To run independent guis on separate threads, give each of them its own
+    /// context. A Gui remembers the context that was current when it was constructed and activates it while handling events,
+    /// drawing and loading widgets. Widgets that are created outside these functions use the current context of the thread.
+    ///
+    /// @code
+    /// std::thread thread([]{
+    ///     tgui::Context::Scope scope{tgui::Context::create()};
+    ///     tgui::Gui gui{renderTexture}; // The gui and its widgets use the context of the scope
+    ///     ...
+    /// });
+    /// @endcode
+    ///
+    /// Resources that don't belong to a single gui, like textures loaded from the same file and parsed theme files, are
+    /// shared between all contexts and can safely be used from multiple threads.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Context
+    {
+    public:
+
+        typedef std::shared_ptr<Context> Ptr; ///< Shared context pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a context current in the calling thread until the scope object is destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Makes the context current
+            ///
+            /// @param context  Context to activate, or nullptr to activate the default context
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Scope(Ptr context);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Makes the context that was current before the scope was created current again
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Scope();
+
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+
+        private:
+
+            Ptr m_previousContext;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Context();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~Context();
+
+
+        Context(const Context&) = delete;
+        Context& operator=(const Context&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new context
+        ///
+        /// @return The new context
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the context that is used by threads that didn't select a context
+        ///
+        /// @return Default context
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const Ptr& getDefault();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the context of the calling thread
+        ///
+        /// @param context  Context to activate, or nullptr to use the default context again
+        ///
+        /// @see Scope
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCurrent(Ptr context);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the context of the calling thread
+        ///
+        /// @return Current context, which is the default context when the thread didn't select one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const Ptr& getCurrent();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a number that identifies the context
+        ///
+        /// Unlike the address of the context, the id is never reused by a context that is created later.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint64_t getId() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text size for all widgets created in this context after calling the function
+        ///
+        /// @param textSize  New default text size
+        ///
+        /// @see setGlobalTextSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextSize(unsigned int textSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the default text size of new widgets in this context
+        ///
+        /// @return Default text size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTextSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the font used by widgets in this context that don't have a font of their own
+        ///
+        /// @param font  New default font
+        ///
+        /// @see setGlobalFont
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFont(const Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the default font of this context
+        ///
+        /// @return Default font, which is created when no font was set yet
+        ///
+        /// Each context creates its own copy of the built-in font, because a font can't be used by multiple threads.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Font getFont();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the default font of this context, without creating it when it didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::shared_ptr<sf::Font>& getInternalFont() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the tween engine that animates widgets which aren't part of a gui
+        ///
+        /// @return Tween engine of the context
+        ///
+        /// Each gui has its own tween engine (see Gui::getTweenEngine). The tweens in this engine are advanced when
+        /// Widget::update is called on their widget, or when update is called on the engine itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenEngine& getTweenEngine();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Sets the view of the gui that is being drawn, which the clipping calculations have to take into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGuiView(const sf::View& view);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the view of the gui that is being drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::View& getGuiView() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Changes how long text layouts are postponed after a resize of the gui view
+        /// @see Gui::setResizeReflowDelay
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResizeReflowDelay(sf::Time delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how long text layouts are postponed after a resize of the gui view
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getResizeReflowDelay() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Changes the time per frame that may be spent on postponed text layouts
+        /// @see Gui::setResizeReflowTimeBudget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResizeReflowTimeBudget(sf::Time budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the time per frame that may be spent on postponed text layouts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getResizeReflowTimeBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Marks whether the gui is passing a change of its view size to its widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResizingView(bool resizing);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether the gui is passing a change of its view size to its widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isResizingView() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the time spent on a postponed text layout in the current frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addResizeReflowTime(sf::Time time);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Forgets the time spent on postponed text layouts, called at the start of every frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetResizeReflowTime();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether another postponed text layout may still be done in the current frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isResizeReflowTimeAvailable() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops using a theme as default theme in all contexts, called when the theme is destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeDefaultTheme(const Theme* theme);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::uint64_t m_id;
+        unsigned int m_textSize = 13;
+        std::shared_ptr<sf::Font> m_font;
+        sf::View m_guiView;
+
+        // Postponing text layouts while the gui view is being resized
+        sf::Time m_resizeReflowDelay;
+        sf::Time m_resizeReflowTimeBudget;
+        sf::Time m_resizeReflowTimeUsed;
+        bool m_resizingView = false;
+
+        TweenEngine m_tweenEngine;
+
+        // The theme used by new widgets, which points to m_builtinTheme when no other theme was selected
+        Theme* m_defaultTheme = nullptr;
+        std::shared_ptr<Theme> m_builtinTheme;
+
+        friend class Theme; // Theme::getDefault and Theme::setDefault access the default theme of the current context
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_CONTEXT_HPP
@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DEFERRED_REFLOW_HPP
+#define TGUI_DEFERRED_REFLOW_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/Time.hpp>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Postpones laying out the text of a widget while the gui view is being resized
+    ///
+    /// Widgets that lay out their text when their size changes (Label, TextBox and ChatBox) ask this object whether to do so
+    /// immediately. Size changes caused by Gui::setView are postponed until the size stayed the same for the delay that was
+    /// set with Gui::setResizeReflowDelay. The postponed layout is done from the update function of the widget, within the
+    /// time budget per frame that was set with Gui::setResizeReflowTimeBudget.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DeferredReflow
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the object that the size of the widget changed
+        ///
+        /// @return Should the text be laid out immediately? False when the layout was postponed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool sizeChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lays out the text when the layout was postponed and the size hasn't changed for long enough
+        ///
+        /// @param elapsedTime  Time passed since the previous call
+        /// @param reflow       Function that lays out the text of the widget
+        ///
+        /// This function should be called from the update function of the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime, const std::function<void()>& reflow);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lays out the text immediately when the layout was postponed
+        ///
+        /// @param reflow  Function that lays out the text of the widget
+        ///
+        /// Hidden widgets aren't updated, so this function should be called when the widget is shown again and before returning
+        /// information that depends on the layout.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flush(const std::function<void()>& reflow);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widget still has to lay out its text for its current size
+        ///
+        /// @return Was the layout postponed and not done yet?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isPending() const
+        {
+            return m_pending;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        bool m_pending = false;
+        sf::Time m_timeSinceResize;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DEFERRED_REFLOW_HPP
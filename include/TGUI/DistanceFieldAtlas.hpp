@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DISTANCE_FIELD_ATLAS_HPP
+#define TGUI_DISTANCE_FIELD_ATLAS_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/String.hpp>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Texture containing signed distance fields of the glyphs of a font
+    ///
+    /// The glyphs are rasterized only once, at BaseCharacterSize, and stored as distance fields from which text of any size
+    /// can be drawn with the shader returned by getShader. This is used by Text when distance field rendering is enabled.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DistanceFieldAtlas
+    {
+    public:
+
+        /// Character size at which the glyphs are rasterized
+        static const unsigned int BaseCharacterSize = 48;
+
+        /// Distance (in pixels at BaseCharacterSize) around the glyph outlines that is stored in the distance field
+        static const unsigned int Spread = 6;
+
+
+        /// @brief Glyph in the atlas, with all values in pixels at BaseCharacterSize
+        struct Glyph
+        {
+            float advance = 0;        ///< Offset to move horizontally to the next character
+            sf::FloatRect bounds;     ///< Bounding rectangle of the distance field, relative to the baseline
+            sf::IntRect textureRect;  ///< Location of the distance field in the texture
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the atlas of a font, creating it when the font didn't have one yet
+        ///
+        /// @param font  The font for which the atlas is requested
+        ///
+        /// @return Atlas that is shared by all texts using the same font, or nullptr when font was a nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<DistanceFieldAtlas> getAtlas(const std::shared_ptr<sf::Font>& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the graphics driver supports the shader needed to draw the distance fields
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAvailable();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the shader that turns the distance fields into sharp glyphs, or nullptr when it isn't available
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const sf::Shader* getShader();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the atlas for a font
+        ///
+        /// @param font  The font from which the glyphs are taken
+        ///
+        /// You should use getAtlas instead of constructing the atlas yourself, so that it can be shared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DistanceFieldAtlas(const std::shared_ptr<sf::Font>& font);
+
+
+        DistanceFieldAtlas(const DistanceFieldAtlas&) = delete;
+        DistanceFieldAtlas& operator=(const DistanceFieldAtlas&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds all characters of a string that weren't in the atlas yet
+        ///
+        /// @param characters  The characters to add
+        /// @param bold        Should the bold version of the glyphs be added?
+        ///
+        /// Reading back the rasterized glyphs is done once per call, so adding many characters at once is faster than
+        /// retrieving them one by one with getGlyph. The printable ASCII characters are added together with the first
+        /// characters, so that most texts never need another read back.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addGlyphs(const sf::String& characters, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a glyph, adding it to the atlas first when needed
+        ///
+        /// @param codePoint  Unicode code point of the character
+        /// @param bold       Should the bold version of the glyph be returned?
+        ///
+        /// @return The glyph at BaseCharacterSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Glyph& getGlyph(std::uint32_t codePoint, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the location of a block of texels that is fully inside a glyph, used to draw underlines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getSolidTextureRect() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture containing the distance fields
+        ///
+        /// The texture changes when glyphs are added, so the mutex returned by getMutex has to be locked while using it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the mutex that protects the atlas, which is shared by texts on all threads
+        ///
+        /// addGlyphs and getGlyph lock the mutex themselves.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::mutex& getMutex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the characters that aren't in the atlas yet, the mutex has to be locked when calling this function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addMissingGlyphs(const sf::String& characters, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Computes the distance field of a rasterized glyph and copies it into the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Glyph addDistanceField(const sf::Image& fontImage, const sf::Glyph& glyph);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a free location in the image, making the image higher when it is full
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u allocateRect(unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::weak_ptr<sf::Font> m_font;
+        std::unordered_map<std::uint64_t, Glyph> m_glyphs;
+        sf::Image m_image;
+        sf::Texture m_texture;
+        unsigned int m_nextX = 0;
+        unsigned int m_nextY = 0;
+        unsigned int m_rowHeight = 0;
+        bool m_asciiAdded[2] = {false, false}; // Indexed by the bold flag
+
+        // Rows of the image that changed since the texture was last updated
+        unsigned int m_dirtyTop = 0;
+        unsigned int m_dirtyBottom = 0;
+
+        mutable std::mutex m_mutex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DISTANCE_FIELD_ATLAS_HPP
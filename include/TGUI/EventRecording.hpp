@@ -0,0 +1,223 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_EVENT_RECORDING_HPP
+#define TGUI_EVENT_RECORDING_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Event.hpp>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Sequence of events and time updates that were passed to a gui
+    ///
+    /// A recording is made by calling Gui::startRecording and Gui::stopRecording. Feeding the entries back to a gui that
+    /// contains the same widgets, with Gui::handleEvent, Gui::updateTime and Gui::setView, reproduces the exact same session.
+    /// The recording can be stored in a compact binary file so that it can e.g. be attached to a bug report.
+    ///
+    /// Only the input of the gui is recorded. Commands passed to Gui::post and changes that the program makes to the
+    /// widgets itself are not part of the recording, a replay only reproduces them when the program makes them again.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API EventRecording
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Entry in the recording
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Entry
+        {
+            enum class Type
+            {
+                Event,  ///< An event was passed to Gui::handleEvent
+                Update, ///< Gui::updateTime was called, which happens once per frame when the gui is drawn
+                View    ///< The view was changed with Gui::setView, e.g. after the window was resized
+            };
+
+            Type type = Type::Event;
+            sf::Time timestamp;            ///< Time since the start of the recording
+            sf::Event event = sf::Event(); ///< The event that was handled, only valid when the type is Event
+            sf::Time elapsedTime;          ///< Time passed to updateTime, only valid when the type is Update
+            sf::FloatRect view;            ///< New visible area of the gui, only valid when the type is View
+            sf::Vector2u targetSize;       ///< Size of the render target when the view changed, only valid when the type is View
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds an event to the end of the recording
+        ///
+        /// @param timestamp  Time since the start of the recording
+        /// @param event      The event that was passed to the gui
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addEvent(sf::Time timestamp, const sf::Event& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a time update to the end of the recording
+        ///
+        /// @param timestamp    Time since the start of the recording
+        /// @param elapsedTime  Time that was passed to Gui::updateTime
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addUpdate(sf::Time timestamp, sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a change of the view to the end of the recording
+        ///
+        /// @param timestamp   Time since the start of the recording
+        /// @param view        New visible area of the gui
+        /// @param targetSize  Size of the render target at the moment the view was changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addViewChange(sf::Time timestamp, const sf::FloatRect& view, sf::Vector2u targetSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorded entries, in the order in which they were added
+        ///
+        /// @return List of events, time updates and view changes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Entry>& getEntries() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of time updates in the recording, which is the amount of frames that were drawn
+        ///
+        /// @return Amount of entries with type Update
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getFrameCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all entries from the recording
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the size of the render target that the gui was drawing to
+        ///
+        /// @param size  Size of the target in pixels
+        ///
+        /// The mouse positions in the events are in pixels, so the target and view have to match during replay.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTargetSize(sf::Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the render target that the gui was drawing to
+        ///
+        /// @return Size of the target in pixels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u getTargetSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the view that the gui was using when the recording started
+        ///
+        /// @param view  Visible area of the gui, as returned by Gui::getView
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(const sf::FloatRect& view);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the view that the gui was using when the recording started
+        ///
+        /// @return Visible area of the gui
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getView() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recording to a file
+        ///
+        /// @param filename  Name of the file to write
+        ///
+        /// @throw Exception when the file could not be written
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveToFile(const std::string& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the contents of the recording with the contents of a file
+        ///
+        /// @param filename  Name of the file that was written by saveToFile
+        ///
+        /// @throw Exception when the file could not be read or is not a valid recording
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recording to a binary stream
+        ///
+        /// @param stream  Stream to write to
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveToStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the contents of the recording with the data from a binary stream
+        ///
+        /// @param stream  Stream containing data that was written by saveToStream
+        ///
+        /// @throw Exception when the stream does not contain a valid recording
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromStream(std::istream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<Entry> m_entries;
+        sf::Vector2u m_targetSize;
+        sf::FloatRect m_view;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_EVENT_RECORDING_HPP
@@ -27,11 +27,15 @@
 #define TGUI_FONT_HPP
 
 #include <TGUI/Config.hpp>
+#include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
 #include <cstdint>
 #include <string>
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -229,6 +233,40 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues glyphs to be rasterized ahead of time, so that the first frame showing them doesn't stall
+        ///
+        /// @param characterSizes  Character sizes at which the glyphs will be needed
+        /// @param style           Style of the text that will use the glyphs
+        /// @param characters      Characters to rasterize, or an empty string for all printable ASCII characters
+        ///
+        /// Only bold text uses different glyphs, text with other styles uses the same glyphs as regular text.
+        ///
+        /// The queued glyphs are rasterized a few at a time by processGlyphPrewarming, which the gui calls every frame.
+        /// SFML rasterizes glyphs directly into the font texture, so this has to happen on the thread that draws the gui.
+        /// Every thread has its own queue, which is processed by the guis that run on that thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarmGlyphs(const std::vector<unsigned int>& characterSizes, TextStyle style = sf::Text::Regular, const sf::String& characters = "") const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs that were queued with prewarmGlyphs
+        ///
+        /// @param maxDuration  Time after which the function returns, even when glyphs remain queued (0 to empty the queue)
+        ///
+        /// @return Are there still glyphs waiting to be rasterized?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool processGlyphPrewarming(sf::Time maxDuration);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of glyphs that were queued with prewarmGlyphs and haven't been rasterized yet
+        ///
+        /// @return Amount of pending glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getPendingGlyphPrewarmCount();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -30,6 +30,7 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Font.hpp>
+#include <SFML/System/String.hpp>
 #include <cstdint>
 #include <string>
 #include <memory>
@@ -45,6 +46,8 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Sets the default text size for all widgets created after calling the function
+    ///
+    /// The text size is stored in the current context of the calling thread, see Context.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API void setGlobalTextSize(unsigned int textSize);
 
@@ -57,6 +60,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Sets the default font used by widgets
+    ///
+    /// The font is stored in the current context of the calling thread, see Context.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API void setGlobalFont(const Font& font);
 
@@ -166,6 +171,16 @@ namespace tgui
     TGUI_API std::string trim(std::string str);
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Hash function for using sf::String as key in unordered containers.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API StringHasher
+    {
+        std::size_t operator()(const sf::String& str) const;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
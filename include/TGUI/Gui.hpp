@@ -28,13 +28,29 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/Context.hpp>
+#include <TGUI/EventRecording.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the events that were passed to Gui::handleEvents
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct EventBatchStats
+    {
+        std::size_t processedEvents = 0;  ///< Amount of events that were passed to the widgets
+        std::size_t droppedEvents = 0;    ///< Amount of events that were merged into a later move or wheel event
+        std::size_t consumedEvents = 0;   ///< Amount of processed events that were consumed by a widget
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Gui class
     ///
@@ -113,6 +129,27 @@ namespace tgui
         sf::RenderTarget* getTarget() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a backend that will receive the drawing primitives of the widgets instead of the render target
+        ///
+        /// @param backend  Backend to draw with, or nullptr to draw on the render target again
+        ///
+        /// A gui with a backend doesn't need a render target. When it doesn't have one, its view is set to cover the size
+        /// of the backend and mouse events are mapped to the view using that size.
+        ///
+        /// @see SoftwareRenderer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderBackend(RenderBackend::Ptr backend);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the backend that is used for drawing the widgets
+        ///
+        /// @return Backend that was set with setRenderBackend, or nullptr when the widgets are drawn on the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const RenderBackend::Ptr& getRenderBackend() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the view that is used by the gui
         ///
@@ -131,6 +168,49 @@ namespace tgui
         const sf::View& getView() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how long widgets wait before laying out their text again after the view changed
+        ///
+        /// @param delay  Time that the size of a widget has to stay the same before its text is laid out, or 0 to always do it
+        ///               immediately (default)
+        ///
+        /// While the user resizes the window, the view (and thus the size of widgets with a relative size) changes every frame.
+        /// Laying out the text in Label, TextBox and ChatBox again on every change can be very slow. With a delay, these widgets
+        /// keep drawing their previous layout (clipped to their new size) until the resizing stops.
+        /// Size changes that aren't caused by setView are never postponed.
+        ///
+        /// @see setResizeReflowTimeBudget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResizeReflowDelay(sf::Time delay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long widgets wait before laying out their text again after the view changed
+        ///
+        /// @return Time that the size of a widget has to stay the same before its text is laid out
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getResizeReflowDelay() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Limits the time per frame that is spent on the text layouts that were postponed after the view changed
+        ///
+        /// @param budget  Maximum time per frame, or 0 to lay out all postponed text in the same frame (default)
+        ///
+        /// When many widgets were resized, their layouts are spread over multiple frames. At least one widget is laid out
+        /// per frame, so a budget that is too small doesn't stop the layouts from happening.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResizeReflowTimeBudget(sf::Time budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the time per frame that is spent on the text layouts that were postponed after the view changed
+        ///
+        /// @return Maximum time per frame, or 0 when there is no limit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getResizeReflowTimeBudget() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Passes the event to the widgets
         ///
@@ -145,6 +225,74 @@ namespace tgui
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes all events that were polled during a frame to the widgets
+        ///
+        /// @param events  The events that were polled from the window, in the order in which they were received
+        ///
+        /// @return Amount of events that were processed, dropped and consumed
+        ///
+        /// Consecutive mouse move events are merged into the last one, as are consecutive touch move events of the same finger.
+        /// Consecutive wheel scroll events of the same wheel at the same position are merged into a single event with the sum
+        /// of their deltas.
+        /// All other events, including button presses and releases, are passed to handleEvent one by one in their
+        /// original order. Using this function instead of calling handleEvent for every event avoids doing a hit test for
+        /// each of the many move events that high polling rate mice and touch screens generate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        EventBatchStats handleEvents(const std::vector<sf::Event>& events);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts recording all events passed to handleEvent, all time updates and all changes of the view
+        ///
+        /// A recording that was still in progress is discarded. The size of the render target and the current view are stored
+        /// in the recording as well, so that the events can be replayed on the same gui layout.
+        /// Commands passed to post are not recorded.
+        ///
+        /// @see stopRecording
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void startRecording();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops recording and returns everything that was recorded since startRecording was called
+        ///
+        /// @return The recorded events, time updates and view changes, which is empty when no recording was in progress
+        ///
+        /// To replay the recording, disable the automatic time updates and pass the entries to handleEvent, updateTime and
+        /// setView in the order in which they are stored, drawing the gui after each time update. When a view change has a
+        /// different target size, the render target has to be resized as well for the mouse positions to be mapped correctly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        EventRecording stopRecording();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the events and time updates are currently being recorded
+        ///
+        /// @return Has startRecording been called without calling stopRecording afterwards?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRecording() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the draw function updates the time of the widgets
+        ///
+        /// @param enabled  Should draw pass the time since the previous frame to updateTime? (default)
+        ///
+        /// When disabled, animations and timers only advance when you call updateTime yourself, which is needed to replay
+        /// a recording deterministically.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAutomaticTimeUpdateEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the draw function updates the time of the widgets
+        ///
+        /// @return Does draw pass the time since the previous frame to updateTime?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAutomaticTimeUpdateEnabled() const;
+
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief While tab key usage is enabled (default), pressing tab will focus another widget
@@ -177,6 +325,56 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns timings and counters about the last frame that was drawn
+        ///
+        /// @return Statistics collected since the previous call to draw, up to and including the last call to draw
+        ///
+        /// The statistics are only collected when TGUI was built with the TGUI_ENABLE_PROFILING option, they will be zero
+        /// otherwise. Use the Profiler class to pause collecting statistics or to record a trace.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const FrameStats& getFrameStats() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be called on the thread that draws the gui
+        ///
+        /// @param command  Function to call at the start of the next call to draw
+        ///
+        /// This is the only function of the gui that may be called from other threads. It never blocks, so worker threads
+        /// can use it to update widgets (e.g. add a line to a chat box) without needing their own locks. The commands are
+        /// executed in the order in which they were posted, at most getCommandBatchSize() of them per frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of posted commands that are executed per frame
+        ///
+        /// @param maxCommands  Maximum amount of commands to execute in a single call to draw, or 0 for no limit
+        ///
+        /// Remaining commands are executed in the next frames, so that a burst of updates can't freeze the gui.
+        /// The default batch size is 1024.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCommandBatchSize(std::size_t maxCommands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of posted commands that are executed per frame
+        ///
+        /// @return Maximum amount of commands to execute in a single call to draw, or 0 when there is no limit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCommandBatchSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the commands that were posted to the gui
+        ///
+        /// @return Amount of posted, executed and pending commands and how often the batch size was reached
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueueStats getCommandQueueStats() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -191,11 +389,33 @@ namespace tgui
         GuiContainer::Ptr getContainer() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the tween engine that animates the widgets of the gui
+        ///
+        /// @return Tween engine that is advanced once per frame, before the widgets are updated
+        ///
+        /// Besides the show and hide effects of widgets, it can be used to animate arbitrary properties.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TweenEngine& getTweenEngine();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the context to which the gui is bound
+        ///
+        /// @return Context that was current in the thread that constructed the gui
+        ///
+        /// The context is made current while the gui handles events, draws, updates and loads or adds widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Context::Ptr& getContext() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the global font
         ///
         /// @param font  Font to use
         ///
+        /// The glyphs of the font are prewarmed at the global text size (see Font::prewarmGlyphs).
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setFont(const Font& font);
 
@@ -406,7 +626,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Updates the internal clock to make animation possible. This function is called automatically by the draw function.
-        // You will thus only need to call it yourself when you are drawing everything manually.
+        // You will thus only need to call it yourself when you are drawing everything manually or when the automatic time
+        // updates were disabled.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateTime(const sf::Time& elapsedTime);
 
@@ -420,6 +641,12 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts a mouse position in pixels to the coordinates of the view
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f mapPixelToView(int x, int y) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -430,11 +657,17 @@ namespace tgui
         sf::RenderTarget* m_target;
         bool m_windowFocused = true;
 
+        // Backend that replaces the render target while drawing, when one was set
+        RenderBackend::Ptr m_renderBackend;
+
     #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
         // Does m_target contains a sf::RenderWindow?
         bool m_accessToWindow;
     #endif
 
+        // The context has to be initialized before the container, whose constructor already uses it
+        Context::Ptr m_context = Context::getCurrent();
+
         // Internal container to store all widgets
         GuiContainer::Ptr m_container = std::make_shared<GuiContainer>();
 
@@ -447,6 +680,17 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        FrameStats m_frameStats;
+
+        CommandQueue m_commandQueue;
+        std::size_t m_commandBatchSize = 1024;
+
+        bool m_automaticTimeUpdate = true;
+
+        // Events and time updates are only recorded while the recording exists
+        std::unique_ptr<EventRecording> m_recording;
+        sf::Clock m_recordingClock;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
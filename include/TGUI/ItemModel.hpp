@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ITEM_MODEL_HPP
+#define TGUI_ITEM_MODEL_HPP
+
+
+#include <TGUI/Global.hpp>
+#include <SFML/System/String.hpp>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Immutable list of items that can be shown by many list boxes and combo boxes at the same time
+    ///
+    /// Widgets that use the same model share the items instead of each storing a copy of them. Every widget still has its own
+    /// selection, hover and scroll position, and only creates the texts for the items that are visible.
+    ///
+    /// Example:
+    /// @code
+    /// auto countries = tgui::ItemModel::create({"Belgium", "France", "Germany"}, {"BE", "FR", "DE"});
+    /// comboBox1->setItemModel(countries);
+    /// comboBox2->setItemModel(countries);
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ItemModel
+    {
+    public:
+
+        typedef std::shared_ptr<ItemModel> Ptr; ///< Shared item model pointer
+        typedef std::shared_ptr<const ItemModel> ConstPtr; ///< Shared constant item model pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param items  The items in the model
+        /// @param ids    Ids of the items, or an empty list when the items don't have ids
+        ///
+        /// @throw Exception when ids were given but not the same amount as there are items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemModel(std::vector<sf::String> items, std::vector<sf::String> ids = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new item model
+        ///
+        /// @param items  The items in the model
+        /// @param ids    Ids of the items, or an empty list when the items don't have ids
+        ///
+        /// @return The new model
+        ///
+        /// @throw Exception when ids were given but not the same amount as there are items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ConstPtr create(std::vector<sf::String> items, std::vector<sf::String> ids = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items in the model
+        ///
+        /// @return Number of items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemCount() const
+        {
+            return m_items.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the item at the given index
+        ///
+        /// @param index  Index of the item, must be smaller than getItemCount()
+        ///
+        /// @return The item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getItem(std::size_t index) const
+        {
+            return m_items[index];
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of the item at the given index
+        ///
+        /// @param index  Index of the item, must be smaller than getItemCount()
+        ///
+        /// @return The id of the item, or an empty string when the model has no ids
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getItemId(std::size_t index) const
+        {
+            return m_itemIds[index];
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns all items in the model
+        ///
+        /// @return The items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::String>& getItems() const
+        {
+            return m_items;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the ids of all items in the model
+        ///
+        /// @return The item ids, items without id have an empty string as id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::String>& getItemIds() const
+        {
+            return m_itemIds;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the first item with the given name
+        ///
+        /// @param item  The item to search for
+        ///
+        /// @return Index of the item, or -1 when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItem(const sf::String& item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the first item with the given id
+        ///
+        /// @param id  The id to search for
+        ///
+        /// @return Index of the item, or -1 when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemById(const sf::String& id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<sf::String> m_items;
+        std::vector<sf::String> m_itemIds;
+
+        // Since the model can't change, the index is built once and shared by all widgets using the model
+        std::unordered_map<sf::String, std::size_t, StringHasher> m_itemIndex;
+        std::unordered_map<sf::String, std::size_t, StringHasher> m_itemIdIndex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ITEM_MODEL_HPP
@@ -30,8 +30,10 @@
 #include <TGUI/Vector2f.hpp>
 #include <type_traits>
 #include <functional>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +46,9 @@ namespace tgui
     /// @brief Class to store the left, top, width or height of a widget
     ///
     /// You don't have to create an instance of this class, numbers are implicitly cast to this class.
+    ///
+    /// Expressions are stored as a flat array of nodes that is evaluated in a single loop. Strings are only parsed the first
+    /// time they are encountered, layouts created from the same string afterwards copy the nodes of the cached result.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Layout
     {
@@ -120,7 +125,7 @@ namespace tgui
         /// @internal
         /// @brief Constructs the layout with a mathematical operation between two other layouts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
+        explicit Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,7 +172,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isConstant() const
         {
-            return m_operation == Operation::Value;
+            return m_nodes.empty() || (m_nodes.back().operation == Operation::Value);
         }
 
 
@@ -193,14 +198,16 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
+        ///
+        /// @param widget  Widget that is being destroyed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout based on the operation it contains and inform the connected widget
+        ///        when the value of the layout has changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
@@ -208,43 +215,74 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Part of the expression. The nodes are stored in postfix order, so the operands of a node always come before it and
+        // the last node contains the value of the whole expression.
+        struct Node
+        {
+            Operation operation;
+            float value;
+            std::uint32_t leftOperand;  // Index of the left operand in case the operation is a math operation
+            std::uint32_t rightOperand; // Index of the right operand in case the operation is a math operation
+            std::uint32_t boundString;  // Index in m_boundStrings in case the node was created from a string containing a binding
+            Widget* boundWidget;        // The widget on which this node depends in case the operation is a binding
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // Parses a string into a layout, without looking in the cache
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindLayout();
+        static Layout parse(std::string expression);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Creates a layout that refers to a widget that can only be found once the layout is connected to a widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        static Layout createBindingString(std::string expression);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the nodes of another layout to the end of the node array and returns the index of its last node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint32_t appendOperand(const Layout& operand);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts the part of the expression that ends with the given node to a string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string nodeToString(std::uint32_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tell the bound widgets that this layout requires information about changes to their position or size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // If widgets are bound, inform them that the layout no longer binds them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindLayout();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Forgets the widgets that were found for bindings strings, so that they have to be searched again
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        void resetBindingStrings();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Find the widget corresponding to the given name and bind it to the node if found
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        static void parseBindingString(Node& node, const std::string& expression, Widget* widget, bool xAxis);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
-        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        std::vector<Node> m_nodes; // Empty when the layout is a constant
+        std::shared_ptr<const std::vector<std::string>> m_boundStrings; // Strings referring to widgets on which the nodes depend in case the layout was created from a string
+        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout is not a constant
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,252 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RESOURCE_PRELOADER_HPP
+#define TGUI_RESOURCE_PRELOADER_HPP
+
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <set>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Decodes the images and fonts used by widget files and themes on background threads
+    ///
+    /// The preloader collects the filenames of all textures and fonts that are referenced in a widget file or theme file.
+    /// When started, the files are loaded in parallel and the decoded images are handed to the TextureManager.
+    /// Creating the actual textures (which requires uploading to the GPU) still happens on the main thread, when the
+    /// widget file or theme is loaded afterwards.
+    ///
+    /// Example usage:
+    /// @code
+    /// tgui::ResourcePreloader preloader;
+    /// preloader.addFromThemeFile("themes/Black.txt");
+    /// preloader.addFromWidgetFile("form.txt");
+    /// preloader.start();
+    /// while (!preloader.isFinished())
+    ///     drawLoadingScreen(preloader.getProgress());
+    /// gui.loadWidgetsFromFile("form.txt");
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ResourcePreloader
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ResourcePreloader() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, waits until all worker threads have finished
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ResourcePreloader();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ResourcePreloader(const ResourcePreloader&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ResourcePreloader& operator=(const ResourcePreloader&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds an image that should be preloaded
+        ///
+        /// @param filename  Filename of the image, relative filenames are relative to the resource path
+        ///
+        /// Files that were already added are ignored. Files can't be added after start() has been called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addImage(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a font that should be preloaded
+        ///
+        /// @param filename  Filename of the font, relative filenames are relative to the resource path
+        ///
+        /// Files that were already added are ignored. Files can't be added after start() has been called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFont(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds all images and fonts that are referenced in a widget file
+        ///
+        /// @param filename  Filename of the widget file that would be passed to Container::loadWidgetsFromFile
+        ///
+        /// @throw Exception when the file could not be opened or parsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFromWidgetFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds all images and fonts that are referenced in a theme file
+        ///
+        /// @param filename  Filename of the theme file that would be passed to the Theme constructor
+        ///
+        /// @throw Exception when the file could not be opened or parsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFromThemeFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds all images and fonts that are referenced in a parsed tree
+        ///
+        /// @param node  Root node of the tree returned by DataIO::parse
+        /// @param path  Path that is inserted in front of relative filenames (e.g. the directory of the theme file)
+        ///
+        /// Properties starting with "Texture" and properties named "Image" are treated as images, "Font" properties as fonts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFromNode(const std::unique_ptr<DataIO::Node>& node, const std::string& path = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading the added files in the background
+        ///
+        /// @param threadCount  Amount of worker threads to use, 0 to use the amount of hardware threads
+        ///
+        /// This function returns immediately. Calling it a second time has no effect.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void start(unsigned int threadCount = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all added files have been loaded
+        ///
+        /// If start() was not called yet then the files will be loaded on the calling thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wait();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether all added files have been loaded
+        ///
+        /// @return Has every file been processed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isFinished() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of files that have already been processed
+        ///
+        /// @return Amount of processed files, including the files that failed to load
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLoadedCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of files that will be loaded
+        ///
+        /// @return Amount of unique images and fonts that were added
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTotalCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the fraction of the files that have been processed
+        ///
+        /// @return Value between 0 and 1, which is 1 when there is nothing to load
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getProgress() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Takes a font that was loaded by a preloader out of the cache
+        ///
+        /// @param filename  Full filename of the font (with the resource path already included)
+        ///
+        /// @return The preloaded font, or nullptr when the font wasn't preloaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> takePreloadedFont(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all preloaded fonts that haven't been used yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removePreloadedFonts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the files from the queue until there are no more files left
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void processQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads a single file from the queue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFile(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct QueuedFile
+        {
+            sf::String filename;
+            bool isFont;
+        };
+
+        std::vector<QueuedFile> m_queue;
+        std::set<std::pair<bool, sf::String>> m_queuedFilenames;
+        std::vector<std::thread> m_threads;
+        std::atomic<std::size_t> m_nextIndex{0};
+        std::atomic<std::size_t> m_loadedCount{0};
+        bool m_started = false;
+
+        static std::map<sf::String, std::shared_ptr<sf::Font>> m_preloadedFonts;
+        static std::mutex m_preloadedFontsMutex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RESOURCE_PRELOADER_HPP
@@ -28,6 +28,7 @@
 
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -68,6 +69,31 @@ namespace tgui
         void load(const std::string& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reloads the theme when its file was modified since it was loaded
+        ///
+        /// This function can be called periodically (e.g. once per frame or once per second) to edit a theme file while the
+        /// program is running. Only the properties that were changed are passed to the widgets that use this theme.
+        ///
+        /// @return True when the theme was reloaded, false when nothing changed
+        ///
+        /// @throw Exception when the modified file contains errors, in which case the old theme remains in use
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool reloadIfModified();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Prewarms the glyphs of the fonts used by the renderers of this theme
+        ///
+        /// @param characterSizes  Character sizes at which the glyphs will be needed
+        /// @param style           Style of the text that will use the glyphs
+        ///
+        /// Only renderers that were already requested from the theme (e.g. by creating widgets) are taken into account.
+        /// @see Font::prewarmGlyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarmFonts(const std::vector<unsigned int>& characterSizes, TextStyle style = sf::Text::Regular);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -143,6 +169,7 @@ namespace tgui
         /// @param theme  Theme to use as default
         ///
         /// The default theme will automatically be reset to nullptr when the theme that is pointed to is destructed.
+        /// The default theme is stored in the current context of the calling thread, see Context.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void setDefault(Theme* theme);
 
@@ -162,10 +189,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static Theme* m_defaultTheme;
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+        unsigned int m_revision = std::numeric_limits<unsigned int>::max(); // Revision of the loader data, never returned by a loader
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,10 +28,12 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/ObjectConverter.hpp>
 #include <SFML/System/String.hpp>
 #include <memory>
 #include <string>
 #include <vector>
+#include <mutex>
 #include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,6 +87,31 @@ namespace tgui
         virtual bool canLoad(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme as objects that can be put in a renderer
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation converts the strings returned by the load function.
+        ///
+        /// @return Map of property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::map<std::string, ObjectConverter> loadProperties(const std::string& primary, const std::string& secondary);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reloads the cached data when the theme was changed since it was loaded
+        ///
+        /// @param primary  Primary parameter of the loader
+        ///
+        /// The default implementation doesn't support reloading and always returns 0.
+        ///
+        /// @return Revision of the cached data, which is increased every time the theme is reloaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual unsigned int reloadIfModified(const std::string& primary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -136,6 +163,39 @@ namespace tgui
         bool canLoad(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file as objects that can be put in a renderer
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// The returned objects share their parsed values with all other objects loaded from the same section. A color or
+        /// texture in the theme is thus only parsed once, even when it is used by many renderers or themes.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, ObjectConverter> loadProperties(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reparses the theme file when it was modified on disk since it was loaded
+        ///
+        /// @param filename  Filename of the theme file
+        ///
+        /// The modification time and size of the file are compared with the values from when the file was cached.
+        /// Only the changed file is parsed again. Already parsed values of properties that didn't change are kept.
+        /// When the new file contains errors, the previously cached contents remain in use.
+        ///
+        /// @return Revision of the cached file, which is increased every time the file is reloaded
+        ///
+        /// @exception Exception when finding syntax errors in the modified file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int reloadIfModified(const std::string& filename) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
@@ -160,7 +220,20 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
+
+        struct CachedFileInfo
+        {
+            long long modificationTime = 0;
+            long long fileSize = 0;
+            unsigned int revision = 0;
+        };
+
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
+        static std::map<std::string, std::map<std::string, std::map<std::string, ObjectConverter>>> m_parsedPropertiesCache;
+        static std::map<std::string, CachedFileInfo> m_cachedFileInfo;
+
+        // The caches are shared by all contexts. The mutex is recursive because load and reloadIfModified call preload.
+        static std::recursive_mutex m_cacheMutex;
 
         friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
     };
@@ -30,6 +30,7 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <functional>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,15 +56,19 @@ namespace tgui
         ///
         /// @param type  Type of the widget
         ///
-        /// @return Function used to construct the widget (all TGUI widgets use std::make_shared<WidgetType>)
+        /// @return Function used to construct the widget (all TGUI widgets use std::make_shared<WidgetType>), or an empty
+        ///         function when no construct function was set for the type
+        ///
+        /// The function is returned by value, because another thread may change the construct functions while it is used.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static const std::function<Widget::Ptr()>& getConstructFunction(const std::string& type);
+        static std::function<Widget::Ptr()> getConstructFunction(const std::string& type);
 
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, std::function<Widget::Ptr()>> m_constructFunctions;
+        static std::mutex m_constructFunctionsMutex;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
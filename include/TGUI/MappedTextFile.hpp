@@ -0,0 +1,222 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_MAPPED_TEXT_FILE_HPP
+#define TGUI_MAPPED_TEXT_FILE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <condition_variable>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Read-only UTF-8 text file that is mapped in memory instead of being loaded
+    ///
+    /// Opening the file only maps it, so it takes the same time no matter how large the file is. The offsets of the lines
+    /// are found by a background thread, which only remembers the start of every 256th line. A line is read by scanning
+    /// forward from the nearest remembered offset. Lines are only decoded when they are requested.
+    ///
+    /// This class is used by TextBox::openDocument to show large files without copying their contents.
+    ///
+    /// The file should not be changed while it is open. When another process truncates it, the lines past the new end of
+    /// the file are no longer returned. The file size is only checked before reading though, so truncating the file at the
+    /// exact moment that lines are being read from it can still crash the program on systems other than Windows.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MappedTextFile
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedTextFile() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, stops the indexing thread and unmaps the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~MappedTextFile();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedTextFile(const MappedTextFile&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedTextFile& operator=(const MappedTextFile&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps a file in memory and starts indexing its lines in the background
+        ///
+        /// @param filename  Filename of the text file, relative filenames are relative to the resource path
+        ///
+        /// A file that was opened before is closed first.
+        ///
+        /// @throw Exception when the file could not be opened or mapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void open(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops indexing and unmaps the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void close();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a file is currently opened
+        ///
+        /// @return Has open been called successfully without calling close afterwards?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOpen() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the opened file
+        ///
+        /// @return Amount of bytes in the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getFileSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether all lines of the file have been found
+        ///
+        /// @return Has the background thread reached the end of the file?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isIndexingFinished() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all lines of the file have been found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForIndexing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines that have been found so far
+        ///
+        /// @return Amount of lines that can be requested with getLine
+        ///
+        /// While the file is still being indexed, only the lines whose end has already been found are counted.
+        /// Just like in TextBox, text ending with a newline has an empty line at the end.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes a single line of the file
+        ///
+        /// @param lineIndex  Index of the line, starting from 0
+        ///
+        /// @return Contents of the line without the newline, or an empty string when the line doesn't exist (yet)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getLine(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes consecutive lines of the file
+        ///
+        /// @param firstLine  Index of the first line to decode
+        /// @param count      Maximum amount of lines to decode
+        ///
+        /// @return Contents of the lines, which only contains the lines that have already been indexed and that still exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<sf::String> getLines(std::size_t firstLine, std::size_t count) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Function executed by the indexing thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void buildIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of mapped bytes that can still be read. Reading a mapping past the end of a file that was
+        // truncated after it was mapped would crash the program (SIGBUS), so the current file size is checked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getReadableSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the byte offset at which the line starts. The line must have been indexed already.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLineStart(std::size_t lineIndex, std::size_t readableSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the byte offset of the newline at the end of the line starting at the given offset, or the readable size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLineEnd(std::size_t lineStart, std::size_t readableSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+        bool m_open = false;
+
+#ifdef SFML_SYSTEM_WINDOWS
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#else
+        int m_fileDescriptor = -1; // Kept open to find out whether the file was truncated
+#endif
+
+        std::vector<std::size_t> m_checkpoints; // Byte offset of the first line and every 256th line after it
+        mutable std::mutex m_checkpointsMutex;
+        std::condition_variable m_indexingFinishedCondition;
+
+        std::atomic<std::size_t> m_lineCount{0};
+        std::atomic<bool> m_indexingFinished{true};
+        std::atomic<bool> m_stopIndexing{false};
+        std::thread m_indexingThread;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MAPPED_TEXT_FILE_HPP
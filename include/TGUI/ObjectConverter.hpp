@@ -365,6 +365,37 @@ namespace tgui
         bool operator!=(const ObjectConverter& right) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Lets all copies of this object share the value that is created when parsing the stored string
+        ///
+        /// This is used by the theme loader so that a property in a theme file is only parsed once per context, no matter how
+        /// many renderers are created from it. Every context gets its own parsed value, because objects like fonts can't be
+        /// used by multiple threads. Nested renderer data is copied for every user, but its properties are shared too.
+        /// This function has no effect if the object doesn't contain a string.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void shareParsedValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Values that were parsed from the string of the shared objects, for each context that used them
+        struct ParsedValueCache;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Takes the value from the shared cache when it was already parsed to the requested type in the current context
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadParsedValue(Type type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the parsed value in the shared cache, so that copies of this object no longer have to parse the string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void storeParsedValue();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         Type m_type = Type::None;
@@ -377,6 +408,8 @@ namespace tgui
 
         bool m_serialized = false;
         sf::String m_string;
+
+        std::shared_ptr<ParsedValueCache> m_parsedValues;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
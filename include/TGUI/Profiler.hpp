@@ -0,0 +1,222 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <chrono>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about a single frame, as returned by Gui::getFrameStats
+    ///
+    /// All times are in milliseconds. The statistics are only collected when TGUI was built with TGUI_ENABLE_PROFILING.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct FrameStats
+    {
+        float frameTime = 0;            ///< Time between the end of the previous frame and the end of this frame
+        float drawTime = 0;             ///< Time spent inside Gui::draw
+        float eventTime = 0;            ///< Time spent inside Gui::handleEvent
+        float updateTime = 0;           ///< Time spent updating animations and timers
+        float layoutTime = 0;           ///< Time spent recalculating layouts
+        float rendererChangedTime = 0;  ///< Time spent updating widgets after a renderer property changed
+        float signalTime = 0;           ///< Time spent emitting signals, including the time spent in the signal handlers
+        unsigned int widgetsDrawn = 0;  ///< Amount of widgets that were drawn
+        unsigned int drawCalls = 0;     ///< Amount of draw calls made on the render target
+        unsigned int textureBinds = 0;  ///< Amount of draw calls that used a texture
+        unsigned int clippingPushes = 0;///< Amount of times a clipping area was set
+        unsigned int textLayouts = 0;   ///< Amount of times the size of a text had to be recalculated
+        unsigned int events = 0;        ///< Amount of events that were handled
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects timings and counters about the work done by the gui in each frame
+    ///
+    /// The profiler is only active when TGUI was built with the TGUI_ENABLE_PROFILING option. Otherwise none of the internal
+    /// code is instrumented and all statistics remain zero.
+    ///
+    /// Besides the per-frame statistics, the profiler can record every measured scope so that it can be saved in the
+    /// Chrome trace event format, which can be viewed in chrome://tracing or similar tools.
+    ///
+    /// The per-frame statistics are collected separately for every thread, so guis that run on different threads don't
+    /// influence each other's statistics. The trace contains the scopes of all threads.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Profiler
+    {
+    public:
+
+        /// @brief Categories of the measured scopes
+        enum class Category
+        {
+            Draw,            ///< Drawing the gui
+            WidgetDraw,      ///< Drawing a single widget
+            Event,           ///< Handling an event
+            Update,          ///< Updating the time of the widgets
+            Layout,          ///< Recalculating a layout
+            RendererChanged, ///< Updating a widget after its renderer changed
+            Signal           ///< Emitting a signal
+        };
+
+        /// @brief Counters that are incremented at specific places in the code
+        enum class Counter
+        {
+            DrawCalls,       ///< Draw call on the render target
+            TextureBinds,    ///< Draw call that uses a texture
+            ClippingPushes,  ///< Clipping area being set
+            TextLayouts,     ///< Size of a text being recalculated
+            Events           ///< Event being handled by the gui
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the time between its construction and destruction
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts measuring
+            ///
+            /// @param category  Category to which the measured time is added
+            /// @param name      Name of the scope in the recorded trace
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Scope(Category category, const char* name);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stops measuring
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Scope();
+
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+            Category m_category;
+            std::string m_name; // Only set while a trace is being recorded
+            std::chrono::steady_clock::time_point m_startTime;
+            bool m_active;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Pauses or resumes collecting statistics
+        ///
+        /// @param enabled  Should statistics be collected?
+        ///
+        /// The profiler is enabled by default, but it only has an effect when TGUI was built with TGUI_ENABLE_PROFILING.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether statistics are being collected
+        ///
+        /// @return Is the profiler enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Increments one of the counters of the current frame
+        ///
+        /// @param counter  The counter to increment
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void count(Counter counter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Ends the current frame and starts a new one
+        ///
+        /// @return Statistics of the frame that just ended
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FrameStats finishFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts recording all measured scopes for the trace
+        ///
+        /// Previously recorded events are discarded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void startTrace();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops recording the measured scopes
+        ///
+        /// The events that were already recorded are kept until saveTrace or startTrace is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void stopTrace();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the measured scopes are being recorded
+        ///
+        /// @return Is a trace being recorded?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isTracing();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the recorded events in the Chrome trace event format and discards them
+        ///
+        /// @param filename  Filename of the json file to create
+        ///
+        /// @throw Exception when the file could not be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void saveTrace(const std::string& filename);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef TGUI_ENABLE_PROFILING
+    #define TGUI_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define TGUI_PROFILE_CONCAT(a, b) TGUI_PROFILE_CONCAT_IMPL(a, b)
+    #define TGUI_PROFILE_SCOPE(category, name) tgui::Profiler::Scope TGUI_PROFILE_CONCAT(tguiProfileScope, __LINE__){tgui::Profiler::Category::category, name}
+    #define TGUI_PROFILE_COUNT(counter) tgui::Profiler::count(tgui::Profiler::Counter::counter)
+#else
+    #define TGUI_PROFILE_SCOPE(category, name) static_cast<void>(0)
+    #define TGUI_PROFILE_COUNT(counter) static_cast<void>(0)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
@@ -0,0 +1,167 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_REGEX_DFA_HPP
+#define TGUI_REGEX_DFA_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Deterministic automaton that matches unicode text against a regular expression
+    ///
+    /// The automaton is built once and then matches text one character at a time, so text can be validated incrementally by
+    /// remembering the state after each prefix. It is used by EditBox to check its input validator on every key press.
+    ///
+    /// Only the subset of the ECMAScript syntax that can be expressed as a DFA is supported: literals, escapes, dot,
+    /// bracket expressions, character class escapes (\\d, \\w, \\s and their negations), groups, alternation and greedy
+    /// or lazy quantifiers. Patterns with anchors, assertions or backreferences are rejected.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RegexDfa
+    {
+    public:
+
+        typedef std::shared_ptr<const RegexDfa> ConstPtr; ///< Shared constant automaton pointer
+
+        static const unsigned int DeadState = 0; ///< State from which the text can no longer become a match
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the automaton for a pattern
+        ///
+        /// @param pattern  Regular expression, encoded as UTF-8
+        ///
+        /// @return Automaton for the pattern, or nullptr when the pattern is invalid or uses unsupported syntax
+        ///
+        /// The predefined EditBox::Validator patterns are not compiled but return prebuilt tables.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ConstPtr create(const std::string& pattern);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles a pattern into an automaton
+        ///
+        /// @param pattern  Regular expression, encoded as UTF-8
+        ///
+        /// @return Automaton for the pattern, or nullptr when the pattern is invalid or uses unsupported syntax
+        ///
+        /// Unlike create, this function never uses a prebuilt table.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ConstPtr compile(const std::string& pattern);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state before any character was processed
+        ///
+        /// @return Start state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getStartState() const
+        {
+            return 1;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Advances the automaton with a single character
+        ///
+        /// @param state      Current state
+        /// @param character  Unicode code point of the next character
+        ///
+        /// @return New state, which is DeadState when no text starting with the processed characters can match
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int advance(unsigned int state, std::uint32_t character) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text processed so far matches the pattern
+        ///
+        /// @param state  State after processing the text
+        ///
+        /// @return Whether the state is an accepting state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAccepting(unsigned int state) const
+        {
+            return m_accepting[state];
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the entire text matches the pattern
+        ///
+        /// @param text  Text to match
+        ///
+        /// @return True when the text matches, the equivalent of std::regex_match
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool match(const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of states in the automaton, including the dead state
+        ///
+        /// @return Amount of states
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getStateCount() const
+        {
+            return m_accepting.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructs the automaton from its tables
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RegexDfa(std::vector<std::uint32_t> classBoundaries, std::vector<unsigned int> transitions, std::vector<bool> accepting);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Code points are grouped in classes that behave identically, each boundary is the first code point of a class
+        std::vector<std::uint32_t> m_classBoundaries;
+
+        // Next state for each combination of state and character class, stored row by row
+        std::vector<unsigned int> m_transitions;
+
+        std::vector<bool> m_accepting;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_REGEX_DFA_HPP
@@ -0,0 +1,210 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDER_BACKEND_HPP
+#define TGUI_RENDER_BACKEND_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Base class for renderers that replace the render target while a gui is being drawn
+    ///
+    /// By default the widgets draw directly on the sf::RenderTarget of the gui. When a backend is given to the gui with
+    /// Gui::setRenderBackend, the drawing primitives used by the widgets (rectangles, borders, shapes, sprites, texts and
+    /// clipping areas) are passed to the backend instead. The gui no longer needs a render target in that case.
+    ///
+    /// Shaders and blend modes other than sf::BlendAlpha are not passed to the backend.
+    /// Custom widgets have to use the drawVertices, drawShape and drawText functions instead of calling target.draw
+    /// directly in order to work with backends.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderBackend
+    {
+    public:
+
+        typedef std::shared_ptr<RenderBackend> Ptr; ///< Shared render backend pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a backend active in the calling thread until the scope object is destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Makes the backend active
+            ///
+            /// @param backend  Backend to activate, or nullptr to draw directly on the render target again
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Scope(RenderBackend* backend);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Makes the backend that was active before the scope was created active again
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Scope();
+
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+
+        private:
+
+            RenderBackend* m_previousBackend;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Virtual destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~RenderBackend() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the drawing area in pixels
+        ///
+        /// @return Size of the output
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Vector2u getSize() const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called by the gui before it draws its widgets
+        ///
+        /// @param view  View of the gui, which maps the coordinates of the widgets to the pixels of the output
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void beginFrame(const sf::View& view) = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called by the gui after all widgets have been drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void endFrame() = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws primitives
+        ///
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param states       Render states, of which only the transform and texture have to be taken into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void renderVertices(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states) = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a text
+        ///
+        /// @param text    Text to draw
+        /// @param states  Render states, of which only the transform has to be taken into account
+        ///
+        /// The transform of the text itself still has to be applied on top of the transform in the render states.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void renderText(const sf::Text& text, const sf::RenderStates& states) = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restricts the drawing to a rectangle until popClipArea is called
+        ///
+        /// @param rect  Area in the coordinates of the view of the gui. The backend has to intersect it with the previous area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void pushClipArea(const FloatRect& rect) = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restores the clipping area that was active before the last call to pushClipArea
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void popClipArea() = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the backend that the contents of a texture changed
+        ///
+        /// @param texture  Texture that was modified
+        ///
+        /// Backends that keep a copy of the textures have to refresh it. The default implementation does nothing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateTexture(const sf::Texture& texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the backend that is active in the calling thread
+        ///
+        /// @return Active backend, or nullptr when the widgets are drawing directly on the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static RenderBackend* getActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws primitives on the active backend, or on the render target when no backend is active
+        ///
+        /// @param target       Render target to draw on when no backend is active
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param states       Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void drawVertices(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a shape on the active backend, or on the render target when no backend is active
+        ///
+        /// @param target  Render target to draw on when no backend is active
+        /// @param shape   Shape to draw. Textures of shapes are ignored by backends.
+        /// @param states  Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void drawShape(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a text on the active backend, or on the render target when no backend is active
+        ///
+        /// @param target  Render target to draw on when no backend is active
+        /// @param text    Text to draw
+        /// @param states  Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void drawText(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_BACKEND_HPP
@@ -34,9 +34,9 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getOutline(); \
+        ObjectConverter* value = m_data->findProperty(toLower(#NAME)); \
+        if (value) \
+            return value->getOutline(); \
         else \
             return {}; \
     } \
@@ -50,9 +50,9 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getColor(); \
+        ObjectConverter* value = m_data->findProperty(toLower(#NAME)); \
+        if (value) \
+            return value->getColor(); \
         else \
             return DEFAULT; \
     } \
@@ -66,9 +66,9 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     TextStyle CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTextStyle(); \
+        ObjectConverter* value = m_data->findProperty(toLower(#NAME)); \
+        if (value) \
+            return value->getTextStyle(); \
         else \
             return DEFAULT; \
     } \
@@ -82,9 +82,9 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getNumber(); \
+        ObjectConverter* value = m_data->findProperty(toLower(#NAME)); \
+        if (value) \
+            return value->getNumber(); \
         else \
             return DEFAULT; \
     }
@@ -101,9 +101,9 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getBool(); \
+        ObjectConverter* value = m_data->findProperty(toLower(#NAME)); \
+        if (value) \
+            return value->getBool(); \
         else \
             return DEFAULT; \
     }
@@ -118,17 +118,20 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // TGUI_NEXT: const reference
+// The returned texture can be changed, so a texture from the base data of an overlay is copied into the overlay first.
+// That way the base data, which may be shared with a theme, is never changed through the getter.
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
+        const std::string property = toLower(#NAME); \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
-        else \
-        { \
-            m_data->propertyValuePairs[toLower(#NAME)] = {Texture{}}; \
-            return m_data->propertyValuePairs[toLower(#NAME)].getTexture(); \
-        } \
+        \
+        ObjectConverter* value = m_data->findProperty(property); \
+        ObjectConverter& ownValue = m_data->propertyValuePairs[property]; \
+        ownValue = ObjectConverter{value ? value->getTexture() : Texture{}}; \
+        return ownValue.getTexture(); \
     } \
     void CLASS::set##NAME(const Texture& texture) \
     { \
@@ -140,15 +143,11 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
     std::shared_ptr<RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getRenderer(); \
+        ObjectConverter* value = m_data->findProperty(toLower(#NAME)); \
+        if (value) \
+            return value->getRenderer(); \
         else \
-        { \
-            const auto& renderer = Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[toLower(#NAME)] = {renderer ? renderer : RendererData::create()}; \
-            return renderer; \
-        } \
+            return Theme::getDefault()->getRendererNoThrow(RENDERER); \
     } \
     void CLASS::set##NAME(std::shared_ptr<RendererData> renderer) \
     { \
@@ -30,6 +30,7 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -38,10 +39,15 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    struct RendererData
+    struct TGUI_API RendererData
     {
         RendererData() = default;
 
+        RendererData(const RendererData&) = delete;
+        RendererData& operator=(const RendererData&) = delete;
+
+        ~RendererData();
+
         static std::shared_ptr<RendererData> create(const std::map<std::string, ObjectConverter>& init = {})
         {
             auto data = std::make_shared<RendererData>();
@@ -68,8 +74,43 @@ namespace tgui
             return rendererData;
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Creates an empty data object that only stores the properties that differ from the base data
+        ///
+        /// Properties that aren't overridden are looked up in the base data and changes to them are forwarded to the
+        /// observers of the overlay. This is what a widget uses when getRenderer is called while its data is still shared.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<RendererData> createOverlay(const std::shared_ptr<RendererData>& base);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the value of a property, also looking in the base data if this is an overlay
+        ///
+        /// @param lowercaseProperty  Name of the property, in lowercase
+        ///
+        /// @return Pointer to the value, or a nullptr when the property doesn't exist
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter* findProperty(const std::string& lowercaseProperty);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the properties of this data merged with the ones from the base data that aren't overridden
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, ObjectConverter> getAllPropertyValuePairs() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the data at the bottom of the overlay chain, or this object when it isn't an overlay
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererData& getRootData();
+
         std::map<std::string, ObjectConverter> propertyValuePairs;
         std::map<const void*, std::function<void(const std::string& property)>> observers;
+        std::recursive_mutex observersMutex; ///< Protects the observers, overlays on shared data may be created from other threads
+        std::shared_ptr<RendererData> base; ///< Data on which this overlay is placed, or nullptr when this isn't an overlay
         bool shared = true;
     };
 
@@ -212,10 +253,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets a map with all properties and their values
         ///
-        /// @return Property-value pairs of the renderer
+        /// @return Property-value pairs of the renderer, including the ones that are inherited from the theme
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        std::map<std::string, ObjectConverter> getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,18 @@ namespace tgui
 
     namespace internal_signal
     {
-        extern TGUI_API std::deque<const void*> parameters;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the storage for the parameters of the signal that is being emitted. Every thread has its own storage, so that
+        // guis on different threads can emit signals at the same time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API std::deque<const void*>& getParameters();
+
+        // Makes certain that the storage returned by getParameters has room for the given amount of parameters in every thread
+        TGUI_API void reserveParameters(std::size_t count);
+
+        // Returns a pointer to a string with the given contents that remains valid for the lifetime of the program.
+        // Signals with the same name share the string instead of each signal storing a copy.
+        TGUI_API const std::string* getUniqueName(std::string&& name);
     }
 
 
@@ -74,10 +85,9 @@ namespace tgui
         /// @param extraParameters  Amount of extra parameters to reserve space for
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Signal(std::string&& name, std::size_t extraParameters = 0) :
-            m_name{std::move(name)}
+            m_name{internal_signal::getUniqueName(std::move(name))}
         {
-            if (1 + extraParameters > internal_signal::parameters.size())
-                internal_signal::parameters.resize(1 + extraParameters);
+            internal_signal::reserveParameters(1 + extraParameters);
         }
 
 
@@ -148,20 +158,7 @@ namespace tgui
         ///
         /// @return True when at least one signal handler was called
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool emit(const Widget* widget)
-        {
-            if (m_handlers.empty() || !m_enabled)
-                return false;
-
-            internal_signal::parameters[0] = static_cast<const void*>(&widget);
-
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
-
-            return true;
-        }
+        bool emit(const Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,7 +168,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::string getName() const
         {
-            return m_name;
+            return *m_name;
         }
 
 
@@ -221,12 +218,35 @@ namespace tgui
         static std::shared_ptr<Widget> getWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether any signal handler is connected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHandlers() const
+        {
+            return m_handlers && !m_handlers->empty();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the connected signal handlers, creating the storage for them when nothing was connected before
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<unsigned int, std::function<void()>>& getHandlers()
+        {
+            if (!m_handlers)
+                m_handlers = std::make_unique<std::map<unsigned int, std::function<void()>>>();
+
+            return *m_handlers;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         bool m_enabled = true;
-        std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        const std::string* m_name;
+        std::unique_ptr<std::map<unsigned int, std::function<void()>>> m_handlers; // Only allocated when a handler is connected
     };
 
 #ifdef TGUI_REMOVE_DEPRECATED_CODE
@@ -251,10 +271,10 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
+            if (!hasHandlers()) \
                 return false; \
          \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
+            internal_signal::getParameters()[1] = static_cast<const void*>(&param); \
             return Signal::emit(widget); \
         } \
         \
@@ -310,10 +330,10 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
+            if (!hasHandlers()) \
                 return false; \
          \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
+            internal_signal::getParameters()[1] = static_cast<const void*>(&param); \
             return Signal::emit(widget); \
         } \
         \
@@ -531,11 +551,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&id);
+            internal_signal::getParameters()[1] = static_cast<const void*>(&item);
+            internal_signal::getParameters()[2] = static_cast<const void*>(&id);
             return Signal::emit(widget);
         }
 
@@ -580,11 +600,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, ShowAnimationType type, bool visible)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
-            internal_signal::parameters[1] = static_cast<const void*>(&type);
-            internal_signal::parameters[2] = static_cast<const void*>(&visible);
+            internal_signal::getParameters()[1] = static_cast<const void*>(&type);
+            internal_signal::getParameters()[2] = static_cast<const void*>(&visible);
             return Signal::emit(widget);
         }
 
@@ -673,11 +693,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&fullItem);
+            internal_signal::getParameters()[1] = static_cast<const void*>(&item);
+            internal_signal::getParameters()[2] = static_cast<const void*>(&fullItem);
             return Signal::emit(widget);
         }
 
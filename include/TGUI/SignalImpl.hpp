@@ -127,14 +127,14 @@ namespace tgui
                                 args...,
                                 widget,
                                 signalName,
-                                internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                                internal_signal::dereference<UnboundArgs>(internal_signal::getParameters()[offset + Indices])...);
             #else
                 return [=,o=offset](const std::shared_ptr<Widget>& widget, const std::string& signalName) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
                                widget,
                                signalName,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(internal_signal::getParameters()[o + Indices])...);
             #endif
                 };
             }
@@ -159,12 +159,12 @@ namespace tgui
                 return [=]{
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(internal_signal::getParameters()[offset + Indices])...);
             #else
                 return [=,o=offset]{ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(internal_signal::getParameters()[o + Indices])...);
             #endif
                 };
             }
@@ -0,0 +1,251 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_SOFTWARE_RENDERER_HPP
+#define TGUI_SOFTWARE_RENDERER_HPP
+
+
+#include <TGUI/RenderBackend.hpp>
+#include <TGUI/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render backend that rasterizes the gui on the CPU into an RGBA pixel buffer
+    ///
+    /// This backend is meant for machines without a GPU, e.g. to stream the gui to remote clients or to take screenshots.
+    /// After every frame the renderer compares the new pixels with those of the previous frame, so that only the tiles
+    /// that changed have to be encoded and sent.
+    ///
+    /// @code
+    /// auto renderer = tgui::SoftwareRenderer::create({800, 600});
+    /// gui.setRenderBackend(renderer);
+    /// gui.draw();
+    /// for (const auto& rect : renderer->getDirtyRects())
+    ///     sendRect(rect, renderer->getPixels(), renderer->getSize().x);
+    /// @endcode
+    ///
+    /// Textures are copied from the graphics card the first time they are drawn. Copies are identified by the OpenGL handle
+    /// and size of the texture, so a texture that is recreated or resized is copied again. Copies of textures that weren't
+    /// drawn during a frame are removed at the end of that frame. A texture of which the pixels are changed without
+    /// changing its size has to be passed to invalidateTexture, except for font textures which are refreshed automatically
+    /// when new glyphs are added to them.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API SoftwareRenderer : public RenderBackend
+    {
+    public:
+
+        typedef std::shared_ptr<SoftwareRenderer> Ptr; ///< Shared software renderer pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param size  Size of the pixel buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit SoftwareRenderer(sf::Vector2u size = {0, 0});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new software renderer
+        ///
+        /// @param size  Size of the pixel buffer
+        ///
+        /// @return The new renderer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr create(sf::Vector2u size = {0, 0});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the pixel buffer
+        ///
+        /// @param size  New size of the output
+        ///
+        /// The whole buffer will be reported as dirty after the next frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(sf::Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the pixel buffer
+        ///
+        /// @return Size of the output
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u getSize() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color with which the buffer is filled at the start of every frame
+        ///
+        /// @param color  Background color, which is black by default
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setClearColor(Color color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color with which the buffer is filled at the start of every frame
+        ///
+        /// @return Background color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getClearColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the tiles in which the dirty rectangles are tracked
+        ///
+        /// @param tileSize  Width and height of a tile in pixels, 64 by default
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTileSize(unsigned int tileSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the tiles in which the dirty rectangles are tracked
+        ///
+        /// @return Width and height of a tile in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTileSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels of the last frame
+        ///
+        /// @return Pointer to the pixels, with 4 bytes (red, green, blue and alpha) per pixel and the rows stored from top to
+        ///         bottom without padding, which is the same layout as sf::Image::getPixelsPtr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getPixels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the areas that changed during the last frame
+        ///
+        /// @return Rectangles in pixels that are aligned to the tiles. Neighbouring dirty tiles on the same row of tiles are
+        ///         merged into a single rectangle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::IntRect>& getDirtyRects() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets the copies of all textures, which will be copied again the next time they are drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearTextureCache();
+
+
+        /// @internal
+        void beginFrame(const sf::View& view) override;
+
+        /// @internal
+        void endFrame() override;
+
+        /// @internal
+        void renderVertices(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states) override;
+
+        /// @internal
+        void renderText(const sf::Text& text, const sf::RenderStates& states) override;
+
+        /// @internal
+        void pushClipArea(const FloatRect& rect) override;
+
+        /// @internal
+        void popClipArea() override;
+
+        /// @internal
+        void invalidateTexture(const sf::Texture& texture) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Identifies a texture. The address alone isn't enough, because a new texture may be created at the same address.
+        struct TextureKey
+        {
+            const sf::Texture* texture;
+            unsigned int nativeHandle;
+            sf::Vector2u size;
+
+            bool operator==(const TextureKey& other) const
+            {
+                return (texture == other.texture) && (nativeHandle == other.nativeHandle) && (size == other.size);
+            }
+        };
+
+        struct TextureKeyHasher
+        {
+            std::size_t operator()(const TextureKey& key) const;
+        };
+
+        // Copy of a texture in memory
+        struct TextureImage
+        {
+            sf::Image image;
+            sf::Vector2u size;
+            bool smooth = false;
+            bool repeated = false;
+            bool outdated = true;
+            bool used = true; // Was the texture drawn during the current frame?
+            std::unordered_set<std::uint64_t> glyphs; // Glyphs that were in the texture when it was copied (font textures only)
+        };
+
+        // Returns the cache entry of a texture and marks it as used in the current frame
+        TextureImage& findTextureImage(const sf::Texture& texture);
+
+        // Returns the copy of a texture, copying it again when it was outdated
+        const TextureImage& getTextureImage(const sf::Texture& texture);
+
+        // Fills a triangle of which the positions are already in pixel coordinates
+        void rasterizeTriangle(const sf::Vertex& v0, const sf::Vertex& v1, const sf::Vertex& v2, const TextureImage* texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::Vector2u m_size;
+        Color m_clearColor = Color::Black;
+        unsigned int m_tileSize = 64;
+        std::vector<std::uint8_t> m_pixels;
+        std::vector<std::uint8_t> m_previousPixels;
+        bool m_previousPixelsValid = false;
+        std::vector<sf::IntRect> m_dirtyRects;
+
+        sf::Transform m_viewTransform;
+        std::vector<sf::IntRect> m_clipAreas;
+        std::vector<sf::Vertex> m_transformedVertices;
+
+        std::unordered_map<TextureKey, TextureImage, TextureKeyHasher> m_textureImages;
+        std::vector<std::uint64_t> m_glyphKeys;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SOFTWARE_RENDERER_HPP
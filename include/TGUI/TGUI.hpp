@@ -28,13 +28,25 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/Context.hpp>
+#include <TGUI/DeferredReflow.hpp>
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <TGUI/EventRecording.hpp>
 #include <TGUI/Animation.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/ItemModel.hpp>
+#include <TGUI/MappedTextFile.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RegexDfa.hpp>
+#include <TGUI/RenderBackend.hpp>
+#include <TGUI/SoftwareRenderer.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/ResourcePreloader.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
@@ -32,11 +32,16 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    class DistanceFieldAtlas;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Text : public sf::Transformable
@@ -129,6 +134,58 @@ namespace tgui
         static sf::String wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of text layouts that are kept in the process-wide layout cache
+        ///
+        /// The measured sizes and word-wrapped strings are shared between all texts with the same string, font, character
+        /// size and style, so that e.g. list items or labels with identical contents only have to be laid out once.
+        /// When the cache is full, the least recently used layouts are forgotten.
+        ///
+        /// @param capacity  Maximum amount of sizes and of wrapped strings to remember, or 0 to disable the cache
+        ///
+        /// By default the capacity is 4096.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setLayoutCacheCapacity(std::size_t capacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of text layouts that are kept in the process-wide layout cache
+        ///
+        /// @return Maximum amount of sizes and of wrapped strings to remember
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getLayoutCacheCapacity();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets all text layouts that were stored in the process-wide layout cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearLayoutCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether texts are drawn from signed distance fields instead of from glyphs rasterized at each size
+        ///
+        /// When enabled, the glyphs of each font are only rasterized once (see DistanceFieldAtlas) and texts of every character
+        /// size are drawn from that single texture with a shader. This keeps the texture memory constant when the gui is
+        /// resized or zoomed, at the cost of slightly softer text at small sizes. The setting is ignored during drawing when
+        /// shaders aren't supported by the graphics driver.
+        ///
+        /// @param enabled  Should distance field rendering be used?
+        ///
+        /// This should be set before creating widgets, texts that already exist keep their previously calculated sizes.
+        /// Distance field rendering is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDistanceFieldRendering(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether texts are drawn from signed distance fields instead of from glyphs rasterized at each size
+        ///
+        /// @return Is distance field rendering used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isDistanceFieldRenderingEnabled();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -315,6 +372,12 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the quads that draw the text from the distance field atlas of the font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDistanceFieldVertices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -323,6 +386,10 @@ namespace tgui
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        mutable std::shared_ptr<DistanceFieldAtlas> m_distanceFieldAtlas;
+        mutable std::vector<sf::Vertex> m_distanceFieldVertices;
+        mutable bool m_distanceFieldVerticesValid = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 
 #include <TGUI/TextureData.hpp>
 #include <memory>
+#include <mutex>
 #include <list>
 #include <map>
 
@@ -79,10 +80,34 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores an image that was decoded in advance, so that getTexture doesn't have to load it again
+        ///
+        /// @param filename  Filename of the image, as it will be passed to getTexture
+        /// @param image     The decoded image
+        ///
+        /// This function is thread-safe, it is called by the ResourcePreloader from its worker threads.
+        /// The image is only used once: it is moved into the texture data the first time the file is requested.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addPreloadedImage(const sf::String& filename, std::unique_ptr<sf::Image> image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all preloaded images that haven't been used yet
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removePreloadedImages();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         static std::map<sf::String, std::list<TextureDataHolder>> m_imageMap;
+        static std::mutex m_imageMapMutex; // Textures are shared between all contexts, which may live on different threads
+
+        static std::map<sf::String, std::unique_ptr<sf::Image>> m_preloadedImages;
+        static std::mutex m_preloadedImagesMutex;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,12 +58,9 @@
 namespace tgui
 {
     class Container;
+    class Context;
 
     enum class ShowAnimationType;
-    namespace priv
-    {
-        class Animation;
-    }
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,6 +245,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Get the absolute position of the widget instead of the relative position to its parent
         ///
+        /// The result is cached and only recalculated after a widget was moved, reparented, scrolled or had its renderer changed.
+        ///
         /// @return Absolute position of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Vector2f getAbsolutePosition() const;
@@ -752,6 +751,14 @@ namespace tgui
                          Color color) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute position of this widget and of all widgets inside it as outdated. This has to be called when
+        // something changes that influences the positions of child widgets without going through setPosition, setParent or a
+        // renderer change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateAbsolutePosition();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -786,9 +793,15 @@ namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
-        // Layouts that need to recalculate their value when the position or size of this widget changes
-        std::unordered_set<Layout*> m_boundPositionLayouts;
-        std::unordered_set<Layout*> m_boundSizeLayouts;
+        // Absolute position returned by the last getAbsolutePosition call. A child only caches its position after its parent
+        // did, so when the cache of a container is already invalid then the caches of its children are invalid as well.
+        mutable Vector2f m_absolutePositionCache;
+        mutable bool m_absolutePositionCached = false;
+
+        // Layouts that need to recalculate their value when the position or size of this widget changes.
+        // Most widgets are never bound to, so the sets are only created when the first layout binds to the widget.
+        std::unique_ptr<std::unordered_set<Layout*>> m_boundPositionLayouts;
+        std::unique_ptr<std::unordered_set<Layout*>> m_boundSizeLayouts;
 
         // When a widget is disabled, it will no longer receive events
         bool m_enabled = true;
@@ -809,6 +822,9 @@ namespace tgui
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
+        // Context whose tween engine animates the widget, when an animation was started while the widget wasn't part of a gui
+        std::weak_ptr<Context> m_tweenContext;
+
         // This is set to true for widgets that have something to be dragged around (e.g. sliders and scrollbars)
         bool m_draggableWidget = false;
 
@@ -821,9 +837,6 @@ namespace tgui
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = aurora::makeCopied<WidgetRenderer>();
 
-        // Show animations
-        std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
-
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
         float m_inheritedOpacity = 1;
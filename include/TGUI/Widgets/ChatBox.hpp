@@ -28,6 +28,7 @@
 
 
 #include <TGUI/CopiedSharedPtr.hpp>
+#include <TGUI/DeferredReflow.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
@@ -113,6 +114,16 @@ namespace tgui
         using Widget::setSize;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows or hides a widget
+        /// @param visible  Is the widget visible?
+        ///
+        /// The widget won't receive events (and thus won't send callbacks) nor will it be drawn when hidden.
+        /// The widget is visible by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisible(bool visible) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Adds a new line of text to the chat box
         ///
@@ -437,6 +448,12 @@ namespace tgui
         Vector2f getInnerSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -464,6 +481,9 @@ namespace tgui
 
         std::deque<Line> m_lines;
 
+        // Postpones recalculating the lines while the gui is being resized
+        DeferredReflow m_deferredReflow;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
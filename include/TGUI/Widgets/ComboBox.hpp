@@ -413,6 +413,29 @@ namespace tgui
         const std::vector<sf::String>& getItemIds() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces all items in the combo box with the items from a shared item model
+        ///
+        /// @param model  The model that will be shown, or a nullptr to remove all items
+        ///
+        /// The combo box only references the model, so the same list (e.g. countries or currencies) can be shown by many
+        /// combo boxes without duplicating it. Changing the items of the combo box afterwards gives it its own copy.
+        ///
+        /// @see ListBox::setItemModel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemModel(ItemModel::ConstPtr model);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the item model that is used by the combo box
+        ///
+        /// @return The model passed to setItemModel, or a nullptr when the combo box stores its own items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemModel::ConstPtr getItemModel() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the maximum items that the combo box can contain
         ///
@@ -499,6 +522,45 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether items are looked up with a hash index instead of comparing them one by one
+        ///
+        /// @param enabled  Should the items and ids be indexed?
+        ///
+        /// The index speeds up selecting, changing, removing and searching items by name or id in lists with many items,
+        /// at the cost of storing a second copy of the item names and ids. It is disabled by default.
+        ///
+        /// @see ListBox::setItemIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether items are looked up with a hash index instead of comparing them one by one
+        /// @return Are the items and ids indexed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text in the list
+        ///
+        /// @param filter  Text that the shown items have to contain, or an empty string to show all items
+        ///
+        /// This can be used to implement search-as-you-type. The selected item is not changed by the filter.
+        ///
+        /// @see ListBox::setFilter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const sf::String& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that the items shown in the list have to contain
+        /// @return Current filter, or an empty string when all items are shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getFilter() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the mouse wheel can be used to change the selected item while the list is closed
         ///
@@ -30,6 +30,7 @@
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/RegexDfa.hpp>
 #include <regex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +374,10 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// Most patterns are compiled into a RegexDfa, which checks typed characters without rematching the entire text and
+        /// which supports unicode. Patterns that it doesn't support (e.g. with anchors or backreferences) are matched with
+        /// std::regex, in which case the text is limited to ANSI characters.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -525,6 +530,20 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the text would still match the input validator when the characters in the given range are replaced
+        // by the typed character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAcceptedByValidator(std::size_t pos, std::size_t removedChars, std::uint32_t key);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets the cached validator states for all prefixes that are longer than the given position.
+        // This has to be called whenever characters are inserted or removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateValidatorStates(std::size_t pos);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -584,6 +603,11 @@ namespace tgui
         std::string   m_regexString = ".*";
         std::regex    m_regex = std::regex{m_regexString};
 
+        // Automaton for the validator, or nullptr when std::regex has to be used. The DFA states after each prefix of the
+        // text are cached, so that typing a character near the end of the text only has to advance a few states.
+        RegexDfa::ConstPtr m_regexDfa;
+        std::vector<unsigned int> m_regexDfaStates;
+
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
 
@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Renderers/LabelRenderer.hpp>
 #include <TGUI/CopiedSharedPtr.hpp>
+#include <TGUI/DeferredReflow.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Text.hpp>
 
@@ -137,6 +138,16 @@ namespace tgui
         using Widget::setSize;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows or hides a widget
+        /// @param visible  Is the widget visible?
+        ///
+        /// The widget won't receive events (and thus won't send callbacks) nor will it be drawn when hidden.
+        /// The widget is visible by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisible(bool visible) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the text
         ///
@@ -429,6 +440,9 @@ namespace tgui
 
         float m_maximumTextWidth = 0;
 
+        // Postpones rearranging the text while the gui is being resized
+        DeferredReflow m_deferredReflow;
+
         bool m_ignoringMouseEvents = false;
 
         // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
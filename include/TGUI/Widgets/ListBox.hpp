@@ -29,8 +29,10 @@
 
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/ItemModel.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -363,6 +365,31 @@ namespace tgui
         const std::vector<sf::String>& getItemIds() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces all items in the list box with the items from a shared item model
+        ///
+        /// @param model  The model that will be shown, or a nullptr to remove all items
+        ///
+        /// The list box only references the model, so the same model can be shown by many list boxes without duplicating
+        /// the items. Only the items that are visible are laid out. The selection, hover and scroll position are still
+        /// stored separately in each list box.
+        ///
+        /// Since the model is immutable, functions that change the items (e.g. addItem or removeItem) give the list box
+        /// its own copy of the items and the list box stops using the model.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemModel(ItemModel::ConstPtr model);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the item model that is used by the list box
+        ///
+        /// @return The model passed to setItemModel, or a nullptr when the list box stores its own items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemModel::ConstPtr getItemModel() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list box
         ///
@@ -466,6 +493,53 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether items are looked up with a hash index instead of comparing them one by one
+        ///
+        /// @param enabled  Should the items and ids be indexed?
+        ///
+        /// The index speeds up setSelectedItem, setSelectedItemById, removeItem, removeItemById, getItemById, changeItem,
+        /// changeItemById, contains and containsId in lists with many items, at the cost of storing a second copy of the
+        /// item names and ids. It is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether items are looked up with a hash index instead of comparing them one by one
+        /// @return Are the items and ids indexed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text
+        ///
+        /// @param filter  Text that the shown items have to contain, or an empty string to show all items
+        ///
+        /// The case of ASCII letters is ignored when comparing. When the new filter contains the previous one (e.g. when the
+        /// user typed an extra character), only the items that passed the previous filter are checked again.
+        /// Filtering does not change the item indices: hidden items remain in the list and can still be selected.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const sf::String& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that the shown items have to contain
+        /// @return Current filter, or an empty string when all items are shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getFilter() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that pass the filter
+        /// @return Number of shown items, which equals getItemCount() when no filter is set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getFilteredItemCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -581,6 +655,51 @@ namespace tgui
         void updateSelectedItem(int item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first item with the given name or id, or -1 when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItem(const sf::String& itemName) const;
+        int findItemById(const sf::String& id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the hash index with all current items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildItemIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the name and id of an item, whether it is stored in the list box or in the item model
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getItemString(std::size_t index) const;
+        const sf::String& getItemIdString(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the items from the item model into the list box, so that they can be changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detachItemModel();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the texts for the rows that are visible when an item model is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems(std::size_t firstRow, std::size_t lastRow) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts between the row at which an item is shown and its index. Returns -1 when the item is hidden by the filter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemIndexOfRow(std::size_t row) const;
+        int getRowOfItem(int item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the shown items below each other
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemPositions();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -612,6 +731,12 @@ namespace tgui
         std::vector<Text>       m_items;
         std::vector<sf::String> m_itemIds;
 
+        // When an item model is used, m_items and m_itemIds are empty and only the visible rows have a text
+        ItemModel::ConstPtr m_itemModel;
+        mutable std::vector<Text> m_visibleItems;
+        mutable std::size_t m_visibleItemsFirstRow = 0;
+        mutable bool m_visibleItemsValid = false;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -634,6 +759,17 @@ namespace tgui
 
         bool m_autoScroll = true;
 
+        // Optional hash index on item names and ids, mapping them to the index of the first item that has them.
+        // It is rebuilt lazily when an item was removed or changed.
+        bool m_itemIndexEnabled = false;
+        mutable bool m_itemIndexValid = false;
+        mutable std::unordered_map<sf::String, std::size_t, StringHasher> m_itemIndex;
+        mutable std::unordered_map<sf::String, std::size_t, StringHasher> m_itemIdIndex;
+
+        // Sorted indices of the items that pass the filter (only used when the filter isn't empty)
+        sf::String m_filter;
+        std::vector<std::size_t> m_filteredItems;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListViewRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -57,6 +58,15 @@ namespace tgui
             Right   ///< Place the text on the right side (e.g. for numbers)
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief How the texts in a column are compared when sorting the items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class SortMode
+        {
+            Lexical, ///< Compare the texts character by character (default)
+            Numeric  ///< Compare the numbers in the texts, texts that don't start with a number come first
+        };
+
         struct Item
         {
             std::vector<Text> texts;
@@ -381,6 +391,17 @@ namespace tgui
         std::vector<sf::String> getItemRow(std::size_t index) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the value of a single column for an item in the list
+        ///
+        /// @param index   The index of the item
+        /// @param column  The index of the column
+        ///
+        /// @return Text of the item in the given column or an empty string when the item has no text in that column
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getItemCell(std::size_t index, std::size_t column) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a list of the texts in the first column for all items in the list view
         ///
@@ -397,6 +418,69 @@ namespace tgui
         std::vector<std::vector<sf::String>> getItemRows() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the displayed rows based on the texts in one of the columns
+        ///
+        /// @param column     The index of the column to sort on
+        /// @param mode       How the texts in the column should be compared
+        /// @param ascending  Should the smallest values be shown on top?
+        ///
+        /// Sorting only changes the order in which the items are displayed, the items themselves are not moved. Item indices,
+        /// including the selected item index, thus keep referring to the same items. Items that are added while the list is
+        /// sorted are inserted at their sorted position. Items that compare equal keep the order in which they were added.
+        /// Large lists are sorted on multiple threads.
+        ///
+        /// @see resetSorting
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortItems(std::size_t column, SortMode mode = SortMode::Lexical, bool ascending = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the displayed rows based on the texts in one of the columns, using a custom comparison
+        ///
+        /// @param column      The index of the column to sort on
+        /// @param comparator  Function that returns true when its first parameter should be shown above the second one
+        ///
+        /// @warning For large lists the comparator is called from multiple threads at the same time
+        ///
+        /// @see sortItems(std::size_t, SortMode, bool)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortItems(std::size_t column, const std::function<bool(const sf::String&, const sf::String&)>& comparator);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the items in the order in which they were added again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetSorting();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the column on which the items are sorted
+        ///
+        /// @return Column index, or -1 when the items are shown in the order in which they were added
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSortColumn() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items for which the given function returns true
+        ///
+        /// @param filter  Function that receives the index of an item and returns whether it should be shown,
+        ///                or nullptr to show all items
+        ///
+        /// Like sorting, filtering doesn't change item indices and hidden items can still be selected with setSelectedItem.
+        /// The filter is also called for items that are added or changed afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const std::function<bool(std::size_t)>& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that are shown
+        /// @return Number of items that pass the filter, which equals getItemCount() when no filter is set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getFilteredItemCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -780,6 +864,44 @@ namespace tgui
         void drawColumn(sf::RenderTarget& target, sf::RenderStates states, std::size_t firstItem, std::size_t lastItem, std::size_t column, float columnWidth) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the rows are shown in a different order than the items or some items are hidden
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSortedOrFiltered() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the item should be shown above the other item when the list is sorted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool compareItems(std::size_t left, std::size_t right) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sorts all item indices again, based on the current sort column
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortAllItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates which items are shown in which row after sorting or filtering changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRows();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a single item from the sorted and filtered rows, without sorting all items again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertItemIntoRows(std::size_t index);
+        void removeItemFromRows(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts between the row at which an item is shown and its index. Returns -1 when the item is hidden by the filter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemIndexOfRow(std::size_t row) const;
+        int getRowOfItem(int item) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -801,6 +923,7 @@ namespace tgui
         SignalInt onItemSelect  = {"ItemSelected"};   ///< An item was selected in the list view. Optional parameter: selected item index (-1 when deselecting)
         SignalInt onDoubleClick = {"DoubleClicked"};  ///< An item was double clicked. Optional parameter: selected item index
         SignalInt onRightClick  = {"RightClicked"};   ///< Right mouse clicked. Optional parameter: index of item below mouse (-1 when not on top of item)
+        SignalInt onHeaderClick = {"HeaderClicked"};  ///< The header was clicked, e.g. to sort the items. Optional parameter: column index
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -812,6 +935,17 @@ namespace tgui
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
 
+        // Sorting and filtering don't move the items, they only determine which item is shown in each row.
+        // The vectors below are only used when the items are sorted or filtered.
+        int m_sortColumn = -1;
+        SortMode m_sortMode = SortMode::Lexical;
+        bool m_sortAscending = true;
+        std::function<bool(const sf::String&, const sf::String&)> m_sortComparator;
+        std::function<bool(std::size_t)> m_filter;
+        std::vector<std::size_t> m_sortedItems; // All item indices in sorted order
+        std::vector<std::size_t> m_rowItems;    // Index of the item shown in each row
+        std::vector<int> m_itemRows;            // Row in which each item is shown, or -1 when it is hidden
+
         float m_requestedHeaderHeight = 0;
         unsigned int m_itemHeight = 0;
         unsigned int m_requestedTextSize = 0;
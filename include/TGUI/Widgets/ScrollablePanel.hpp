@@ -346,6 +346,12 @@ namespace tgui
         void disconnectAllChildWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Invalidate the cached absolute positions of the child widgets when the contents are scrolled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectScrollbars();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/CopiedSharedPtr.hpp>
+#include <TGUI/DeferredReflow.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
@@ -36,6 +37,8 @@
 
 namespace tgui
 {
+    class MappedTextFile;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Text box widget
     ///
@@ -105,6 +108,16 @@ namespace tgui
         using Widget::setSize;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows or hides a widget
+        /// @param visible  Is the widget visible?
+        ///
+        /// The widget won't receive events (and thus won't send callbacks) nor will it be drawn when hidden.
+        /// The widget is visible by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisible(bool visible) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the text of the text box
         ///
@@ -329,11 +342,44 @@ namespace tgui
         /// @return Lines of text
         ///
         /// Note that this is the amount of lines after word-wrap is applied.
+        /// When a document is open, this is the amount of lines of the document that have been found so far.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::size_t getLinesCount() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the contents of a UTF-8 text file without loading it in memory
+        ///
+        /// @param filename  Filename of the text file, relative filenames are relative to the resource path
+        ///
+        /// The file is mapped in memory and its lines are found in the background, so opening it takes the same time no matter
+        /// how large the file is. Only the lines that are visible are decoded and laid out. This is intended for viewing large
+        /// files such as logs.
+        ///
+        /// While a document is open the text box is read-only, the text can't be selected and lines are not word-wrapped.
+        /// Long lines can be viewed by allowing the horizontal scrollbar to be shown. The getText function returns an empty
+        /// string while a document is open. Calling setText or addText closes the document.
+        ///
+        /// @throw Exception when the file could not be opened
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void openDocument(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Closes the document that was opened with openDocument, leaving the text box empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void closeDocument();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text box is showing a document that was opened with openDocument
+        ///
+        /// @return Is a document open?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDocumentOpen() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focus or unfocus the widget
         /// @param focused  Is the widget focused?
@@ -454,6 +500,21 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars for the lines of the document that have been found so far and lays out the visible lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeDocument();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Decodes the lines of the document that are visible when they differ from the lines that are currently shown.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDocumentLines();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls through the document when a key is pressed while a document is open.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void documentKeyPressed(const sf::Event::KeyEvent& event);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
@@ -552,6 +613,9 @@ namespace tgui
 
         std::vector<sf::String> m_lines;
 
+        // Postpones rearranging the text while the gui is being resized
+        DeferredReflow m_deferredReflow;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -588,6 +652,12 @@ namespace tgui
 
         bool m_monospacedFontOptimizationEnabled = false;
 
+        // File that is shown instead of m_text when a document is open. Copies of the text box share the read-only file.
+        std::shared_ptr<MappedTextFile> m_document;
+        std::size_t m_documentLineCount = 0;  // Amount of lines of the document for which the scrollbars were set
+        std::size_t m_documentFirstLine = 0;  // Index of the first line of the document in m_textBeforeSelection
+        std::size_t m_documentShownLines = 0; // Amount of lines of the document in m_textBeforeSelection
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
@@ -23,137 +23,625 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+
 #include <TGUI/Animation.hpp>
-#include <TGUI/Widget.hpp>
+#include <TGUI/Container.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    namespace priv
+    namespace
     {
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTweenPropertyBit(std::uint8_t property)
+        {
+            return 1u << property;
+        }
 
-        Animation::Type Animation::getType() const
+        // Containers don't update hidden widgets, so the tweens of a widget are paused while the widget or one of its parents
+        // is hidden, and while the widget isn't part of a container
+        bool isTweenedWidgetShown(const Widget& widget)
         {
-            return m_type;
+            if (!widget.getParent())
+                return false;
+
+            for (const Widget* shownWidget = &widget; shownWidget != nullptr; shownWidget = shownWidget->getParent())
+            {
+                if (!shownWidget->isVisible())
+                    return false;
+            }
+
+            return true;
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::size_t TweenEngine::NoWidget;
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::TweenEngine() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::~TweenEngine() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::TweenId TweenEngine::moveWidget(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration,
+                                                 Easing easing, std::function<void()> finishedCallback)
+    {
+        return addWidgetTween(std::move(widget), Property::Position, start, end, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void Animation::finish()
+    TweenEngine::TweenId TweenEngine::resizeWidget(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration,
+                                                   Easing easing, std::function<void()> finishedCallback)
+    {
+        return addWidgetTween(std::move(widget), Property::Size, start, end, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::TweenId TweenEngine::fadeWidget(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration,
+                                                 Easing easing, std::function<void()> finishedCallback)
+    {
+        start = std::max(0.f, std::min(1.f, start));
+        end = std::max(0.f, std::min(1.f, end));
+        return addWidgetTween(std::move(widget), Property::Opacity, {start, 0}, {end, 0}, duration, easing, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::TweenId TweenEngine::tween(float start, float end, sf::Time duration, std::function<void(float)> setter,
+                                            Easing easing, std::function<void()> finishedCallback)
+    {
+        Target target;
+        target.widgetSlot = NoWidget;
+        target.property = Property::Custom;
+        target.setter = [setter](Vector2f value){ setter(value.x); };
+        target.finishedCallback = std::move(finishedCallback);
+        return addTween({start, 0}, {end, 0}, duration, easing, std::move(target));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::TweenId TweenEngine::tween(Vector2f start, Vector2f end, sf::Time duration, std::function<void(Vector2f)> setter,
+                                            Easing easing, std::function<void()> finishedCallback)
+    {
+        Target target;
+        target.widgetSlot = NoWidget;
+        target.property = Property::Custom;
+        target.setter = std::move(setter);
+        target.finishedCallback = std::move(finishedCallback);
+        return addTween(start, end, duration, easing, std::move(target));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TweenEngine::finish(TweenId id)
+    {
+        const std::size_t index = findTween(id);
+        if ((index == m_ids.size()) || m_removed[index])
+            return false;
+
+        m_elapsed[index] = m_duration[index];
+        calculateValues(index, index + 1);
+
+        m_removed[index] = 1;
+        m_hasRemovedTweens = true;
+        applyValue(index);
+
+        // While updating, the tween is removed and its callback is called at the end of the update
+        if (!m_updating)
+            removeFinishedTweens();
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TweenEngine::cancel(TweenId id)
+    {
+        const std::size_t index = findTween(id);
+        if ((index == m_ids.size()) || m_removed[index])
+            return false;
+
+        m_removed[index] = 2;
+        m_hasRemovedTweens = true;
+
+        if (!m_updating)
+            removeFinishedTweens();
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TweenEngine::isRunning(TweenId id) const
+    {
+        const std::size_t index = findTween(id);
+        return (index < m_ids.size()) && !m_removed[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TweenEngine::getTweenCount() const
+    {
+        if (!m_hasRemovedTweens)
+            return m_ids.size();
+
+        return static_cast<std::size_t>(std::count(m_removed.begin(), m_removed.end(), std::uint8_t{0}));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TweenEngine::update(sf::Time elapsedTime)
+    {
+        if (m_ids.empty() || m_updating)
+            return;
+
+        m_updating = true;
+
+        // Tweens that are started by a setter or signal handler during the update only start moving in the next update
+        const std::size_t count = m_ids.size();
+
+        cancelExpiredWidgetTweens();
+
+        for (auto& slot : m_widgetSlots)
         {
-            if (m_finishedCallback != nullptr)
-                m_finishedCallback();
+            const auto widget = slot.widget.lock();
+            slot.paused = !widget || !isTweenedWidgetShown(*widget);
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        m_paused.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+            m_paused[i] = (m_targets[i].widgetSlot != NoWidget) && m_widgetSlots[m_targets[i].widgetSlot].paused;
+
+        const std::int64_t microseconds = elapsedTime.asMicroseconds();
+        const std::uint8_t* const paused = m_paused.data();
+        std::int64_t* const elapsed = m_elapsed.data();
+        for (std::size_t i = 0; i < count; ++i)
+            elapsed[i] += paused[i] ? 0 : microseconds;
+
+        calculateValues(0, count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // Paused tweens keep their value without writing it to the widget again
+            if (m_removed[i] || paused[i])
+                continue;
+
+            collectValue(i);
+            if (m_elapsed[i] >= m_duration[i])
+            {
+                m_removed[i] = 1;
+                m_hasRemovedTweens = true;
+            }
+        }
+
+        applyWidgetValues();
+
+        m_updating = false;
+        removeFinishedTweens();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        Animation::Animation(Type type, Widget::Ptr widget, sf::Time duration, std::function<void()> finishedCallback) :
-            m_type            {type},
-            m_widget          {widget},
-            m_totalDuration   {duration},
-            m_finishedCallback{finishedCallback}
+    float TweenEngine::applyEasing(Easing easing, float progress)
+    {
+        switch (easing)
         {
+            case Easing::Linear:
+                return progress;
+            case Easing::QuadraticIn:
+                return progress * progress;
+            case Easing::QuadraticOut:
+                return 1 - (1 - progress) * (1 - progress);
+            case Easing::QuadraticInOut:
+            {
+                if (progress < 0.5f)
+                    return 2 * progress * progress;
+
+                const float remaining = 2 - 2 * progress;
+                return 1 - remaining * remaining / 2;
+            }
+            case Easing::CubicIn:
+                return progress * progress * progress;
+            case Easing::CubicOut:
+                return 1 - (1 - progress) * (1 - progress) * (1 - progress);
+            case Easing::CubicInOut:
+            {
+                if (progress < 0.5f)
+                    return 4 * progress * progress * progress;
+
+                const float remaining = 2 - 2 * progress;
+                return 1 - remaining * remaining * remaining / 2;
+            }
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        return progress;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        MoveAnimation::MoveAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation {Type::Move, widget, duration, finishedCallback},
-            m_startPos{start},
-            m_endPos  {end}
+    void TweenEngine::updateWidget(const Widget* widget, sf::Time elapsedTime)
+    {
+        if (m_updating)
+            return;
+
+        const auto it = m_widgetSlotIndices.find(widget);
+        if (it == m_widgetSlotIndices.end())
+            return;
+
+        // The slot could still belong to a destroyed widget that had the same address
+        const std::size_t slotIndex = it->second;
+        if (m_widgetSlots[slotIndex].widget.expired())
+            return;
+
+        m_updating = true;
+
+        const std::size_t count = m_ids.size();
+        const std::int64_t microseconds = elapsedTime.asMicroseconds();
+        for (std::size_t i = 0; i < count; ++i)
         {
+            if ((m_targets[i].widgetSlot != slotIndex) || m_removed[i])
+                continue;
+
+            m_elapsed[i] += microseconds;
+            calculateValues(i, i + 1);
+            collectValue(i);
+            if (m_elapsed[i] >= m_duration[i])
+            {
+                m_removed[i] = 1;
+                m_hasRemovedTweens = true;
+            }
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        applyWidgetValues();
 
-        bool MoveAnimation::update(sf::Time elapsedTime)
+        m_updating = false;
+        removeFinishedTweens();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::TweenId TweenEngine::addTween(Vector2f start, Vector2f end, sf::Time duration, Easing easing, Target&& target)
+    {
+        m_ids.push_back(++m_lastId);
+        m_elapsed.push_back(0);
+        m_duration.push_back(std::max<std::int64_t>(0, duration.asMicroseconds()));
+        m_progress.push_back(0);
+        m_startX.push_back(start.x);
+        m_startY.push_back(start.y);
+        m_endX.push_back(end.x);
+        m_endY.push_back(end.y);
+        m_valueX.push_back(start.x);
+        m_valueY.push_back(start.y);
+        m_easing.push_back(easing);
+        m_removed.push_back(0);
+
+        if (target.widgetSlot != NoWidget)
+            m_widgetSlots[target.widgetSlot].tweenCount++;
+
+        m_targets.push_back(std::move(target));
+        return m_lastId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine::TweenId TweenEngine::addWidgetTween(std::shared_ptr<Widget> widget, Property property, Vector2f start, Vector2f end,
+                                                     sf::Time duration, Easing easing, std::function<void()> finishedCallback)
+    {
+        // Widgets that were destroyed are forgotten here as well, because the engine of the context is rarely updated
+        cancelExpiredWidgetTweens();
+        if (!m_updating)
+            removeFinishedTweens();
+
+        // If the property was already being animated then that tween is finished first.
+        // While updating, the slot that was found could still belong to a destroyed widget that had the same address.
+        auto it = m_widgetSlotIndices.find(widget.get());
+        if ((it != m_widgetSlotIndices.end()) && (m_widgetSlots[it->second].widget.lock() == widget))
         {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
+            const std::size_t slotIndex = it->second;
+            for (std::size_t i = 0; i < m_ids.size(); ++i)
             {
-                finish();
-                return true;
+                if ((m_targets[i].widgetSlot == slotIndex) && (m_targets[i].property == property) && !m_removed[i])
+                {
+                    finish(m_ids[i]);
+                    break;
+                }
             }
+        }
 
-            m_widget->setPosition(m_startPos + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endPos - m_startPos)));
-            return false;
+        // Finishing the previous tween could have removed the slot of the widget
+        std::size_t slotIndex;
+        it = m_widgetSlotIndices.find(widget.get());
+        if ((it != m_widgetSlotIndices.end()) && (m_widgetSlots[it->second].widget.lock() == widget))
+            slotIndex = it->second;
+        else
+        {
+            slotIndex = m_widgetSlots.size();
+            m_widgetSlotIndices[widget.get()] = slotIndex;
+
+            WidgetSlot slot;
+            slot.widget = widget;
+            slot.key = widget.get();
+            m_widgetSlots.push_back(std::move(slot));
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Target target;
+        target.widgetSlot = slotIndex;
+        target.property = property;
+        target.finishedCallback = std::move(finishedCallback);
+        return addTween(start, end, duration, easing, std::move(target));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TweenEngine::findTween(TweenId id) const
+    {
+        const auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id);
+        if ((it != m_ids.end()) && (*it == id))
+            return static_cast<std::size_t>(it - m_ids.begin());
+        else
+            return m_ids.size();
+    }
 
-        void MoveAnimation::finish()
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TweenEngine::calculateValues(std::size_t begin, std::size_t end)
+    {
+        const std::int64_t* const elapsed = m_elapsed.data();
+        const std::int64_t* const duration = m_duration.data();
+        float* const progress = m_progress.data();
+        for (std::size_t i = begin; i < end; ++i)
+            progress[i] = (elapsed[i] >= duration[i]) ? 1.f : (static_cast<float>(elapsed[i]) / static_cast<float>(duration[i]));
+
+        // The end value is reached exactly, because every easing curve ends at 1 and the interpolation below gives the end value for 1
+        for (std::size_t i = begin; i < end; ++i)
         {
-            m_widget->setPosition(m_endPos);
-            Animation::finish();
+            if (m_easing[i] != Easing::Linear)
+                progress[i] = applyEasing(m_easing[i], progress[i]);
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const float* const startX = m_startX.data();
+        const float* const startY = m_startY.data();
+        const float* const endX = m_endX.data();
+        const float* const endY = m_endY.data();
+        float* const valueX = m_valueX.data();
+        float* const valueY = m_valueY.data();
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            valueX[i] = (startX[i] * (1 - progress[i])) + (endX[i] * progress[i]);
+            valueY[i] = (startY[i] * (1 - progress[i])) + (endY[i] * progress[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        ResizeAnimation::ResizeAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation  {Type::Resize, widget, duration, finishedCallback},
-            m_startSize{start},
-            m_endSize  {end}
+    void TweenEngine::collectValue(std::size_t index)
+    {
+        const Target& target = m_targets[index];
+        if (target.widgetSlot == NoWidget)
         {
+            applyValue(index);
+            return;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetSlot& slot = m_widgetSlots[target.widgetSlot];
+        slot.pendingProperties |= getTweenPropertyBit(static_cast<std::uint8_t>(target.property));
+        switch (target.property)
+        {
+            case Property::Position:
+                slot.position = {m_valueX[index], m_valueY[index]};
+                break;
+            case Property::Size:
+                slot.size = {m_valueX[index], m_valueY[index]};
+                break;
+            case Property::Opacity:
+                slot.opacity = m_valueX[index];
+                break;
+            case Property::Custom:
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool ResizeAnimation::update(sf::Time elapsedTime)
+    void TweenEngine::applyValue(std::size_t index)
+    {
+        const Vector2f value{m_valueX[index], m_valueY[index]};
+        const Target& target = m_targets[index];
+        if (target.widgetSlot == NoWidget)
         {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
-            {
-                finish();
-                return true;
-            }
+            // The setter is copied because it could start a new tween, which would move the targets in memory
+            const auto setter = target.setter;
+            setter(value);
+            return;
+        }
 
-            m_widget->setSize(m_startSize + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endSize - m_startSize)));
-            return false;
+        // A value that was collected for the same property earlier in this update is outdated now
+        WidgetSlot& slot = m_widgetSlots[target.widgetSlot];
+        slot.pendingProperties &= ~getTweenPropertyBit(static_cast<std::uint8_t>(target.property));
+
+        const auto widget = slot.widget.lock();
+        if (!widget)
+            return;
+
+        switch (target.property)
+        {
+            case Property::Position:
+                widget->setPosition(value);
+                break;
+            case Property::Size:
+                widget->setSize(value);
+                break;
+            case Property::Opacity:
+                widget->setInheritedOpacity(value.x);
+                break;
+            case Property::Custom:
+                break;
         }
+    }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void ResizeAnimation::finish()
+    void TweenEngine::applyWidgetValues()
+    {
+        // Slots aren't removed while updating, so the indices stay valid even when a signal handler starts new tweens
+        for (std::size_t i = 0; i < m_widgetSlots.size(); ++i)
         {
-            m_widget->setSize(m_endSize);
-            Animation::finish();
+            const unsigned int properties = m_widgetSlots[i].pendingProperties;
+            if (properties == 0)
+                continue;
+
+            m_widgetSlots[i].pendingProperties = 0;
+            const auto widget = m_widgetSlots[i].widget.lock();
+            if (!widget)
+                continue;
+
+            const Vector2f position = m_widgetSlots[i].position;
+            const Vector2f size = m_widgetSlots[i].size;
+            const float opacity = m_widgetSlots[i].opacity;
+
+            if (properties & getTweenPropertyBit(static_cast<std::uint8_t>(Property::Position)))
+                widget->setPosition(position);
+            if (properties & getTweenPropertyBit(static_cast<std::uint8_t>(Property::Size)))
+                widget->setSize(size);
+            if (properties & getTweenPropertyBit(static_cast<std::uint8_t>(Property::Opacity)))
+                widget->setInheritedOpacity(opacity);
         }
+    }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        FadeAnimation::FadeAnimation(Widget::Ptr widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation     {Type::Fade, widget, duration, finishedCallback},
-            m_startOpacity{std::max(0.f, std::min(1.f, start))},
-            m_endOpacity  {std::max(0.f, std::min(1.f, end))}
+    void TweenEngine::cancelExpiredWidgetTweens()
+    {
+        for (std::size_t i = 0; i < m_ids.size(); ++i)
         {
+            if (!m_removed[i] && (m_targets[i].widgetSlot != NoWidget) && m_widgetSlots[m_targets[i].widgetSlot].widget.expired())
+            {
+                m_removed[i] = 2;
+                m_hasRemovedTweens = true;
+            }
         }
+    }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool FadeAnimation::update(sf::Time elapsedTime)
+    void TweenEngine::removeFinishedTweens()
+    {
+        if (!m_hasRemovedTweens)
+            return;
+
+        m_hasRemovedTweens = false;
+
+        // Move the remaining tweens to the front of the arrays, keeping them in the same order
+        // The widgets of finished tweens are kept alive until the callbacks were called, as the callbacks of show and
+        // hide animations still access their widget. The callback isn't called when the widget was already destroyed.
+        std::vector<std::function<void()>> finishedCallbacks;
+        std::vector<std::shared_ptr<Widget>> finishedWidgets;
+        std::size_t remaining = 0;
+        for (std::size_t i = 0; i < m_ids.size(); ++i)
         {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
+            if (m_removed[i])
             {
-                finish();
-                return true;
+                bool widgetExists = true;
+                if (m_targets[i].widgetSlot != NoWidget)
+                {
+                    WidgetSlot& slot = m_widgetSlots[m_targets[i].widgetSlot];
+                    slot.tweenCount--;
+
+                    if (m_removed[i] == 1)
+                    {
+                        finishedWidgets.push_back(slot.widget.lock());
+                        widgetExists = (finishedWidgets.back() != nullptr);
+                    }
+                }
+
+                if ((m_removed[i] == 1) && widgetExists && m_targets[i].finishedCallback)
+                    finishedCallbacks.push_back(std::move(m_targets[i].finishedCallback));
+
+                continue;
             }
 
-            m_widget->setInheritedOpacity(m_startOpacity + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endOpacity - m_startOpacity)));
-            return false;
+            if (remaining != i)
+            {
+                m_ids[remaining] = m_ids[i];
+                m_elapsed[remaining] = m_elapsed[i];
+                m_duration[remaining] = m_duration[i];
+                m_progress[remaining] = m_progress[i];
+                m_startX[remaining] = m_startX[i];
+                m_startY[remaining] = m_startY[i];
+                m_endX[remaining] = m_endX[i];
+                m_endY[remaining] = m_endY[i];
+                m_valueX[remaining] = m_valueX[i];
+                m_valueY[remaining] = m_valueY[i];
+                m_easing[remaining] = m_easing[i];
+                m_removed[remaining] = 0;
+                m_targets[remaining] = std::move(m_targets[i]);
+            }
+
+            ++remaining;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        m_ids.resize(remaining);
+        m_elapsed.resize(remaining);
+        m_duration.resize(remaining);
+        m_progress.resize(remaining);
+        m_startX.resize(remaining);
+        m_startY.resize(remaining);
+        m_endX.resize(remaining);
+        m_endY.resize(remaining);
+        m_valueX.resize(remaining);
+        m_valueY.resize(remaining);
+        m_easing.resize(remaining);
+        m_removed.resize(remaining);
+        m_targets.erase(m_targets.begin() + static_cast<std::ptrdiff_t>(remaining), m_targets.end());
+
+        // Remove the widgets that no longer have tweens. A new widget at the address of a destroyed one has its own slot.
+        std::vector<std::size_t> newSlotIndices(m_widgetSlots.size(), NoWidget);
+        std::size_t remainingSlots = 0;
+        for (std::size_t i = 0; i < m_widgetSlots.size(); ++i)
+        {
+            if (m_widgetSlots[i].tweenCount == 0)
+            {
+                const auto it = m_widgetSlotIndices.find(m_widgetSlots[i].key);
+                if ((it != m_widgetSlotIndices.end()) && (it->second == i))
+                    m_widgetSlotIndices.erase(it);
+
+                continue;
+            }
+
+            if (remainingSlots != i)
+            {
+                m_widgetSlots[remainingSlots] = std::move(m_widgetSlots[i]);
 
-        void FadeAnimation::finish()
+                const auto it = m_widgetSlotIndices.find(m_widgetSlots[remainingSlots].key);
+                if ((it != m_widgetSlotIndices.end()) && (it->second == i))
+                    it->second = remainingSlots;
+            }
+
+            newSlotIndices[i] = remainingSlots++;
+        }
+
+        if (remainingSlots != m_widgetSlots.size())
         {
-            m_widget->setInheritedOpacity(m_endOpacity);
-            Animation::finish();
+            m_widgetSlots.erase(m_widgetSlots.begin() + static_cast<std::ptrdiff_t>(remainingSlots), m_widgetSlots.end());
+            for (auto& target : m_targets)
+            {
+                if (target.widgetSlot != NoWidget)
+                    target.widgetSlot = newSlotIndices[target.widgetSlot];
+            }
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The callbacks may start or finish other tweens, so they are only called once the arrays are consistent again
+        for (const auto& callback : finishedCallbacks)
+            callback();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
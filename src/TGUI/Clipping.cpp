@@ -24,49 +24,62 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Context.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    sf::View Clipping::m_originalView;
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) :
         m_target {target},
         m_oldView{target.getView()}
     {
+        TGUI_PROFILE_COUNT(ClippingPushes);
+
+        // A render backend does the clipping itself, the view of the target isn't used while the backend is active
+        m_backend = RenderBackend::getActive();
+        if (m_backend)
+        {
+            const Vector2f transformedTopLeft = states.transform.transformPoint(topLeft);
+            const Vector2f transformedBottomRight = states.transform.transformPoint(topLeft + size);
+            m_backend->pushClipArea({transformedTopLeft, transformedBottomRight - transformedTopLeft});
+            return;
+        }
+
+        const sf::View& originalView = Context::getCurrent()->getGuiView();
+
         Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
         topLeft = Vector2f(states.transform.transformPoint(topLeft));
 
         Vector2f viewTopLeft = topLeft;
         size = bottomRight - topLeft;
 
-        topLeft.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        topLeft.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
-        bottomRight.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        bottomRight.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
+        topLeft.x -= originalView.getCenter().x - (originalView.getSize().x / 2.f);
+        topLeft.y -= originalView.getCenter().y - (originalView.getSize().y / 2.f);
+        bottomRight.x -= originalView.getCenter().x - (originalView.getSize().x / 2.f);
+        bottomRight.y -= originalView.getCenter().y - (originalView.getSize().y / 2.f);
 
-        topLeft.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        topLeft.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
-        size.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        size.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
+        topLeft.x *= originalView.getViewport().width / originalView.getSize().x;
+        topLeft.y *= originalView.getViewport().height / originalView.getSize().y;
+        size.x *= originalView.getViewport().width / originalView.getSize().x;
+        size.y *= originalView.getViewport().height / originalView.getSize().y;
 
-        topLeft.x += m_originalView.getViewport().left;
-        topLeft.y += m_originalView.getViewport().top;
+        topLeft.x += originalView.getViewport().left;
+        topLeft.y += originalView.getViewport().top;
 
         if (topLeft.x < m_oldView.getViewport().left)
         {
             size.x -= m_oldView.getViewport().left - topLeft.x;
-            viewTopLeft.x += (m_oldView.getViewport().left - topLeft.x) * (m_originalView.getSize().x / m_originalView.getViewport().width);
+            viewTopLeft.x += (m_oldView.getViewport().left - topLeft.x) * (originalView.getSize().x / originalView.getViewport().width);
             topLeft.x = m_oldView.getViewport().left;
         }
         if (topLeft.y < m_oldView.getViewport().top)
         {
             size.y -= m_oldView.getViewport().top - topLeft.y;
-            viewTopLeft.y += (m_oldView.getViewport().top - topLeft.y) * (m_originalView.getSize().y / m_originalView.getViewport().height);
+            viewTopLeft.y += (m_oldView.getViewport().top - topLeft.y) * (originalView.getSize().y / originalView.getViewport().height);
             topLeft.y = m_oldView.getViewport().top;
         }
 
@@ -79,8 +92,8 @@ namespace tgui
         {
             sf::View view{{std::round(viewTopLeft.x),
                            std::round(viewTopLeft.y),
-                           std::round(size.x * m_originalView.getSize().x / m_originalView.getViewport().width),
-                           std::round(size.y * m_originalView.getSize().y / m_originalView.getViewport().height)}};
+                           std::round(size.x * originalView.getSize().x / originalView.getViewport().width),
+                           std::round(size.y * originalView.getSize().y / originalView.getViewport().height)}};
 
             view.setViewport({topLeft.x, topLeft.y, size.x, size.y});
             target.setView(view);
@@ -97,14 +110,17 @@ namespace tgui
 
     Clipping::~Clipping()
     {
-        m_target.setView(m_oldView);
+        if (m_backend)
+            m_backend->popClipArea();
+        else
+            m_target.setView(m_oldView);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Clipping::setGuiView(const sf::View& view)
     {
-        m_originalView = view;
+        Context::getCurrent()->setGuiView(view);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
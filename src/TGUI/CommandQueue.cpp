@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/CommandQueue.hpp>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The queue is the intrusive multi-producer single-consumer queue by Dmitry Vyukov. Posting is a single atomic exchange,
+// the consumer owns the tail and uses a stub node to never have to unlink the last remaining node.
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::CommandQueue() :
+        m_head{&m_stub},
+        m_tail{&m_stub}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::~CommandQueue()
+    {
+        while (Node* node = popNode())
+            delete node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::post(std::function<void()> command)
+    {
+        Node* node = new Node;
+        node->command = std::move(command);
+
+        m_postedCommands.fetch_add(1, std::memory_order_relaxed);
+        pushNode(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CommandQueue::execute(std::size_t maxCommands)
+    {
+        const std::size_t pending = m_postedCommands.load(std::memory_order_relaxed) - m_executedCommands.load(std::memory_order_relaxed);
+        if (pending > m_peakPendingCommands.load(std::memory_order_relaxed))
+            m_peakPendingCommands.store(pending, std::memory_order_relaxed);
+
+        std::size_t executed = 0;
+        while ((maxCommands == 0) || (executed < maxCommands))
+        {
+            std::unique_ptr<Node> node{popNode()};
+            if (!node)
+                return executed;
+
+            // The command is counted before it is called, so that a command that throws isn't executed twice in the statistics
+            executed++;
+            m_executedCommands.fetch_add(1, std::memory_order_relaxed);
+            node->command();
+        }
+
+        if (m_postedCommands.load(std::memory_order_relaxed) > m_executedCommands.load(std::memory_order_relaxed))
+            m_throttledBatches.fetch_add(1, std::memory_order_relaxed);
+
+        return executed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueueStats CommandQueue::getStats() const
+    {
+        CommandQueueStats stats;
+        stats.executedCommands = m_executedCommands.load(std::memory_order_relaxed);
+        stats.postedCommands = m_postedCommands.load(std::memory_order_relaxed);
+        stats.pendingCommands = (stats.postedCommands > stats.executedCommands) ? (stats.postedCommands - stats.executedCommands) : 0;
+        stats.peakPendingCommands = m_peakPendingCommands.load(std::memory_order_relaxed);
+        stats.throttledBatches = m_throttledBatches.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::pushNode(Node* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::Node* CommandQueue::popNode()
+    {
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &m_stub)
+        {
+            if (!next)
+                return nullptr;
+
+            m_tail = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        // The tail is the last node, unless a producer has already swapped the head but not yet linked its node
+        if (tail != m_head.load(std::memory_order_acquire))
+            return nullptr;
+
+        pushNode(&m_stub);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <cassert>
 #include <fstream>
@@ -62,7 +63,7 @@ namespace tgui
         {
             auto node = std::make_unique<DataIO::Node>();
             node->name = name;
-            for (const auto& pair : renderer->propertyValuePairs)
+            for (const auto& pair : renderer->getAllPropertyValuePairs())
             {
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
@@ -121,6 +122,8 @@ namespace tgui
         Widget                {std::move(other)},
         m_widgets             {std::move(other.m_widgets)},
         m_widgetNames         {std::move(other.m_widgetNames)},
+        m_widgetNameIndex     {std::move(other.m_widgetNameIndex)},
+        m_widgetNameIndexValid{other.m_widgetNameIndexValid},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
         m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
@@ -129,6 +132,8 @@ namespace tgui
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_widgetNames = {};
+        other.m_widgetNameIndexValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -178,6 +183,8 @@ namespace tgui
             Widget::operator=(std::move(right));
             m_widgets              = std::move(right.m_widgets);
             m_widgetNames          = std::move(right.m_widgetNames);
+            m_widgetNameIndex      = std::move(right.m_widgetNameIndex);
+            m_widgetNameIndexValid = right.m_widgetNameIndexValid;
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
@@ -186,6 +193,8 @@ namespace tgui
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_widgetNames = {};
+            right.m_widgetNameIndexValid = false;
         }
 
         return *this;
@@ -206,8 +215,11 @@ namespace tgui
             if (getInnerSize() != m_prevInnerSize)
             {
                 m_prevInnerSize = getInnerSize();
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                if (m_boundSizeLayouts)
+                {
+                    for (auto& layout : *m_boundSizeLayouts)
+                        layout->recalculateValue();
+                }
             }
         }
     }
@@ -222,6 +234,9 @@ namespace tgui
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
 
+        if (m_widgetNameIndexValid)
+            m_widgetNameIndex.emplace(widgetName, m_widgets.size() - 1);
+
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
@@ -233,13 +248,36 @@ namespace tgui
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        Widget::Ptr child = getChildByName(widgetName);
+        if (child != nullptr)
+            return child;
+
+        // Descend directly when the name is a path
+        std::size_t slashPos = widgetName.find('/');
+        if (slashPos != sf::String::InvalidPos)
         {
-            if (m_widgetNames[i] == widgetName)
-                return m_widgets[i];
+            const Container* container = this;
+            std::size_t startPos = 0;
+            while (true)
+            {
+                child = container->getChildByName(widgetName.substring(startPos, slashPos - startPos));
+                if (slashPos == sf::String::InvalidPos)
+                {
+                    if (child != nullptr)
+                        return child;
+                    break;
+                }
+
+                if ((child == nullptr) || !child->isContainer())
+                    break;
+
+                container = static_cast<const Container*>(child.get());
+                startPos = slashPos + 1;
+                slashPos = widgetName.find('/', startPos);
+            }
         }
 
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i]->isContainer())
             {
@@ -278,6 +316,7 @@ namespace tgui
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                m_widgetNameIndexValid = false;
                 return true;
             }
         }
@@ -294,6 +333,7 @@ namespace tgui
 
         m_widgets.clear();
         m_widgetNames.clear();
+        m_widgetNameIndexValid = false;
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
@@ -308,6 +348,7 @@ namespace tgui
             if (m_widgets[i] == widget)
             {
                 m_widgetNames[i] = name;
+                m_widgetNameIndexValid = false;
                 return true;
             }
         }
@@ -402,7 +443,7 @@ namespace tgui
             }
             else // Section describes a widget
             {
-                const auto& constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
+                const auto constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
                 if (constructor)
                 {
                     Widget::Ptr widget = constructor();
@@ -473,6 +514,7 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
             m_widgetNames.erase(m_widgetNames.begin() + i);
+            m_widgetNameIndexValid = false;
             break;
         }
     }
@@ -496,6 +538,7 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
             m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+            m_widgetNameIndexValid = false;
             break;
         }
     }
@@ -745,6 +788,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::invalidateAbsolutePosition()
+    {
+        // The children can't have a cached position when this container doesn't have one
+        if (!m_absolutePositionCached)
+            return;
+
+        Widget::invalidateAbsolutePosition();
+        for (const auto& widget : m_widgets)
+            widget->invalidateAbsolutePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::rendererChanged(const std::string& property)
     {
         Widget::rendererChanged(property);
@@ -787,7 +843,7 @@ namespace tgui
             const auto nameSeparator = childNode->name.find('.');
             const auto widgetType = childNode->name.substr(0, nameSeparator);
 
-            const auto& constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
+            const auto constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
             if (constructor)
             {
                 std::string className;
@@ -1026,7 +1082,10 @@ namespace tgui
         for (const auto& widget : m_widgets)
         {
             if (widget->isVisible())
+            {
+                TGUI_PROFILE_SCOPE(WidgetDraw, widget->getWidgetType().c_str());
                 widget->draw(*target, states);
+            }
         }
     }
 
@@ -1082,6 +1141,28 @@ namespace tgui
         return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getChildByName(const sf::String& widgetName) const
+    {
+        if (!m_widgetNameIndexValid)
+        {
+            m_widgetNameIndex.clear();
+            m_widgetNameIndex.reserve(m_widgetNames.size());
+            for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+                m_widgetNameIndex.emplace(m_widgetNames[i], i);
+
+            m_widgetNameIndexValid = true;
+        }
+
+        const auto it = m_widgetNameIndex.find(widgetName);
+        if (it == m_widgetNameIndex.end())
+            return nullptr;
+
+        assert((it->second < m_widgets.size()) && (m_widgetNames[it->second] == widgetName));
+        return m_widgets[it->second];
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1115,6 +1196,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TweenEngine& GuiContainer::getTweenEngine()
+    {
+        return m_tweenEngine;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
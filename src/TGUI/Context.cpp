@@ -0,0 +1,275 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Context.hpp>
+#include <TGUI/DefaultFont.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        thread_local Context::Ptr currentThreadContext;
+
+        std::atomic<std::uint64_t> lastContextId{0};
+
+        // All contexts that exist, needed to reset their default theme when the theme is destroyed
+        struct ContextRegistry
+        {
+            std::mutex mutex;
+            std::vector<Context*> contexts;
+        };
+
+        ContextRegistry& getContextRegistry()
+        {
+            // The registry is never destroyed, because global themes may be destroyed after all other static objects
+            static auto* registry = new ContextRegistry;
+            return *registry;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Context::Scope::Scope(Ptr context) :
+        m_previousContext{currentThreadContext}
+    {
+        currentThreadContext = std::move(context);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Context::Scope::~Scope()
+    {
+        currentThreadContext = std::move(m_previousContext);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Context::Context() :
+        m_id{++lastContextId}
+    {
+        auto& registry = getContextRegistry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.contexts.push_back(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Context::~Context()
+    {
+        auto& registry = getContextRegistry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        registry.contexts.erase(std::remove(registry.contexts.begin(), registry.contexts.end(), this), registry.contexts.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Context::Ptr Context::create()
+    {
+        return std::make_shared<Context>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Context::Ptr& Context::getDefault()
+    {
+        static const Ptr defaultContext = create();
+        return defaultContext;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setCurrent(Ptr context)
+    {
+        currentThreadContext = std::move(context);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Context::Ptr& Context::getCurrent()
+    {
+        if (currentThreadContext)
+            return currentThreadContext;
+        else
+            return getDefault();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t Context::getId() const
+    {
+        return m_id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setTextSize(unsigned int textSize)
+    {
+        m_textSize = textSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Context::getTextSize() const
+    {
+        return m_textSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setFont(const Font& font)
+    {
+        m_font = font.getFont();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font Context::getFont()
+    {
+        if (!m_font)
+        {
+            m_font = std::make_shared<sf::Font>();
+            m_font->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes));
+        }
+
+        return m_font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::shared_ptr<sf::Font>& Context::getInternalFont() const
+    {
+        return m_font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TweenEngine& Context::getTweenEngine()
+    {
+        return m_tweenEngine;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setGuiView(const sf::View& view)
+    {
+        m_guiView = view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::View& Context::getGuiView() const
+    {
+        return m_guiView;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setResizeReflowDelay(sf::Time delay)
+    {
+        m_resizeReflowDelay = delay;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Context::getResizeReflowDelay() const
+    {
+        return m_resizeReflowDelay;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setResizeReflowTimeBudget(sf::Time budget)
+    {
+        m_resizeReflowTimeBudget = budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Context::getResizeReflowTimeBudget() const
+    {
+        return m_resizeReflowTimeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setResizingView(bool resizing)
+    {
+        m_resizingView = resizing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Context::isResizingView() const
+    {
+        return m_resizingView;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::addResizeReflowTime(sf::Time time)
+    {
+        m_resizeReflowTimeUsed += time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::resetResizeReflowTime()
+    {
+        m_resizeReflowTimeUsed = sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Context::isResizeReflowTimeAvailable() const
+    {
+        // Without a budget there is no limit, otherwise the layouts continue until the budget is exceeded
+        return (m_resizeReflowTimeBudget == sf::Time::Zero) || (m_resizeReflowTimeUsed < m_resizeReflowTimeBudget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::removeDefaultTheme(const Theme* theme)
+    {
+        auto& registry = getContextRegistry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        for (auto* context : registry.contexts)
+        {
+            if (context->m_defaultTheme == theme)
+                context->m_defaultTheme = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DeferredReflow.hpp>
+#include <TGUI/Context.hpp>
+#include <SFML/System/Clock.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DeferredReflow::sizeChanged()
+    {
+        const auto& context = Context::getCurrent();
+        if (!context->isResizingView() || (context->getResizeReflowDelay() == sf::Time::Zero))
+        {
+            m_pending = false;
+            return true;
+        }
+
+        // Keep waiting until the size stops changing
+        m_pending = true;
+        m_timeSinceResize = sf::Time::Zero;
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DeferredReflow::update(sf::Time elapsedTime, const std::function<void()>& reflow)
+    {
+        if (!m_pending)
+            return;
+
+        const auto& context = Context::getCurrent();
+
+        m_timeSinceResize += elapsedTime;
+        if (m_timeSinceResize < context->getResizeReflowDelay())
+            return;
+
+        // When other widgets already used the time of this frame then try again in the next frame
+        if (!context->isResizeReflowTimeAvailable())
+            return;
+
+        m_pending = false;
+
+        const sf::Clock clock;
+        reflow();
+        context->addResizeReflowTime(clock.getElapsedTime());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DeferredReflow::flush(const std::function<void()>& reflow)
+    {
+        if (!m_pending)
+            return;
+
+        m_pending = false;
+        reflow();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
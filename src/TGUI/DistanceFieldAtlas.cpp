@@ -0,0 +1,370 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <mutex>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const unsigned int distanceFieldAtlasWidth = 512;
+        const unsigned int distanceFieldAtlasInitialHeight = 256;
+
+        // Size of the block of fully opaque texels in the top left corner of the atlas, used for underlines
+        const unsigned int distanceFieldSolidBlockSize = 4;
+
+        const char distanceFieldFragmentShader[] =
+            "uniform sampler2D texture;\n"
+            "void main()\n"
+            "{\n"
+            "    float distance = texture2D(texture, gl_TexCoord[0].xy).a;\n"
+            "    float smoothing = max(fwidth(distance) * 0.75, 0.001);\n"
+            "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);\n"
+            "    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);\n"
+            "}\n";
+
+        std::uint64_t getDistanceFieldGlyphKey(std::uint32_t codePoint, bool bold)
+        {
+            return (static_cast<std::uint64_t>(bold) << 32) | codePoint;
+        }
+
+        sf::String getPrintableAsciiCharacters()
+        {
+            sf::String characters;
+            for (std::uint32_t codePoint = 0x20; codePoint < 0x7F; ++codePoint)
+                characters += codePoint;
+
+            return characters;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<DistanceFieldAtlas> DistanceFieldAtlas::getAtlas(const std::shared_ptr<sf::Font>& font)
+    {
+        if (!font)
+            return nullptr;
+
+        struct AtlasEntry
+        {
+            std::weak_ptr<sf::Font> font;
+            std::shared_ptr<DistanceFieldAtlas> atlas;
+        };
+
+        // Texts usually ask for the same font many times in a row, which is answered without locking the mutex.
+        // The entries are compared by owner, so a new font at the address of a destroyed font doesn't match.
+        thread_local AtlasEntry lastEntry;
+        if (lastEntry.atlas && !lastEntry.font.owner_before(font) && !font.owner_before(lastEntry.font))
+            return lastEntry.atlas;
+
+        static std::map<const sf::Font*, AtlasEntry> atlases;
+        static std::mutex atlasesMutex;
+        std::lock_guard<std::mutex> lock{atlasesMutex};
+
+        auto it = atlases.find(font.get());
+        if ((it == atlases.end()) || it->second.font.owner_before(font) || font.owner_before(it->second.font))
+        {
+            // Forget the atlases of fonts that no longer exist, their address may be reused by a new font
+            for (auto entryIt = atlases.begin(); entryIt != atlases.end();)
+            {
+                if (entryIt->second.font.expired())
+                    entryIt = atlases.erase(entryIt);
+                else
+                    ++entryIt;
+            }
+
+            AtlasEntry& entry = atlases[font.get()];
+            entry.font = font;
+            entry.atlas = std::make_shared<DistanceFieldAtlas>(font);
+            it = atlases.find(font.get());
+        }
+
+        lastEntry = it->second;
+        return lastEntry.atlas;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DistanceFieldAtlas::isAvailable()
+    {
+        return getShader() != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Shader* DistanceFieldAtlas::getShader()
+    {
+        static const std::unique_ptr<sf::Shader> shader = []{
+            if (!sf::Shader::isAvailable())
+                return std::unique_ptr<sf::Shader>();
+
+            auto newShader = std::make_unique<sf::Shader>();
+            if (!newShader->loadFromMemory(distanceFieldFragmentShader, sf::Shader::Fragment))
+                return std::unique_ptr<sf::Shader>();
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            newShader->setUniform("texture", sf::Shader::CurrentTexture);
+        #else
+            newShader->setParameter("texture", sf::Shader::CurrentTexture);
+        #endif
+            return newShader;
+        }();
+
+        return shader.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DistanceFieldAtlas::DistanceFieldAtlas(const std::shared_ptr<sf::Font>& font) :
+        m_font{font}
+    {
+        m_image.create(distanceFieldAtlasWidth, distanceFieldAtlasInitialHeight, sf::Color{255, 255, 255, 0});
+        for (unsigned int y = 0; y < distanceFieldSolidBlockSize; ++y)
+        {
+            for (unsigned int x = 0; x < distanceFieldSolidBlockSize; ++x)
+                m_image.setPixel(x, y, sf::Color::White);
+        }
+
+        m_nextX = distanceFieldSolidBlockSize + 1;
+        m_rowHeight = distanceFieldSolidBlockSize;
+
+        m_texture.loadFromImage(m_image);
+        m_texture.setSmooth(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::addGlyphs(const sf::String& characters, bool bold)
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        addMissingGlyphs(characters, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DistanceFieldAtlas::Glyph& DistanceFieldAtlas::getGlyph(std::uint32_t codePoint, bool bold)
+    {
+        // Glyphs are never removed and elements of an unordered_map don't move, so the reference remains valid after unlocking
+        std::lock_guard<std::mutex> lock{m_mutex};
+
+        const std::uint64_t key = getDistanceFieldGlyphKey(codePoint, bold);
+        auto it = m_glyphs.find(key);
+        if (it == m_glyphs.end())
+        {
+            addMissingGlyphs(sf::String{codePoint}, bold);
+            it = m_glyphs.find(key);
+            if (it == m_glyphs.end())
+            {
+                // The font no longer exists
+                static const Glyph emptyGlyph;
+                return emptyGlyph;
+            }
+        }
+
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect DistanceFieldAtlas::getSolidTextureRect() const
+    {
+        // Stay away from the edges of the block so that smoothing doesn't blend in the transparent pixels around it
+        return {1, 1, distanceFieldSolidBlockSize - 2.f, distanceFieldSolidBlockSize - 2.f};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture& DistanceFieldAtlas::getTexture() const
+    {
+        return m_texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::mutex& DistanceFieldAtlas::getMutex() const
+    {
+        return m_mutex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::addMissingGlyphs(const sf::String& characters, bool bold)
+    {
+        const std::shared_ptr<sf::Font> font = m_font.lock();
+        if (!font)
+            return;
+
+        // Rasterize all missing glyphs first, so that the font texture only has to be downloaded once.
+        // The first batch also contains the printable ASCII characters, which are then never downloaded again.
+        std::vector<std::uint32_t> missingCodePoints;
+        const auto addMissingCodePoints = [&](const sf::String& codePoints){
+                for (const std::uint32_t codePoint : codePoints)
+                {
+                    if ((m_glyphs.find(getDistanceFieldGlyphKey(codePoint, bold)) == m_glyphs.end())
+                     && (std::find(missingCodePoints.begin(), missingCodePoints.end(), codePoint) == missingCodePoints.end()))
+                    {
+                        font->getGlyph(codePoint, BaseCharacterSize, bold);
+                        missingCodePoints.push_back(codePoint);
+                    }
+                }
+            };
+
+        addMissingCodePoints(characters);
+        if (missingCodePoints.empty())
+            return;
+
+        if (!m_asciiAdded[bold])
+        {
+            static const sf::String asciiCharacters = getPrintableAsciiCharacters();
+            addMissingCodePoints(asciiCharacters);
+            m_asciiAdded[bold] = true;
+        }
+
+        const sf::Vector2u oldImageSize = m_image.getSize();
+        const sf::Image fontImage = font->getTexture(BaseCharacterSize).copyToImage();
+
+        m_dirtyTop = oldImageSize.y;
+        m_dirtyBottom = 0;
+        for (const std::uint32_t codePoint : missingCodePoints)
+            m_glyphs[getDistanceFieldGlyphKey(codePoint, bold)] = addDistanceField(fontImage, font->getGlyph(codePoint, BaseCharacterSize, bold));
+
+        // Only the rows that contain new glyphs are uploaded, unless the image had to grow
+        if (m_image.getSize() != oldImageSize)
+            m_texture.loadFromImage(m_image);
+        else if (m_dirtyTop < m_dirtyBottom)
+        {
+            m_texture.update(m_image.getPixelsPtr() + static_cast<std::size_t>(m_dirtyTop) * distanceFieldAtlasWidth * 4,
+                             distanceFieldAtlasWidth, m_dirtyBottom - m_dirtyTop, 0, m_dirtyTop);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DistanceFieldAtlas::Glyph DistanceFieldAtlas::addDistanceField(const sf::Image& fontImage, const sf::Glyph& glyph)
+    {
+        Glyph result;
+        result.advance = static_cast<float>(glyph.advance);
+
+        if ((glyph.textureRect.width <= 0) || (glyph.textureRect.height <= 0))
+            return result;
+
+        const int spread = static_cast<int>(Spread);
+        const int glyphWidth = glyph.textureRect.width;
+        const int glyphHeight = glyph.textureRect.height;
+        const int fieldWidth = glyphWidth + 2 * spread;
+        const int fieldHeight = glyphHeight + 2 * spread;
+
+        // Find out which pixels lie inside the glyph, with a margin around it so that the loop below needs no bound checks
+        const int gridWidth = fieldWidth + 2 * spread;
+        const int gridHeight = fieldHeight + 2 * spread;
+        std::vector<bool> inside(static_cast<std::size_t>(gridWidth * gridHeight), false);
+        for (int y = 0; y < glyphHeight; ++y)
+        {
+            for (int x = 0; x < glyphWidth; ++x)
+            {
+                const sf::Color pixel = fontImage.getPixel(static_cast<unsigned int>(glyph.textureRect.left + x),
+                                                           static_cast<unsigned int>(glyph.textureRect.top + y));
+                inside[static_cast<std::size_t>((y + 2 * spread) * gridWidth + x + 2 * spread)] = (pixel.a >= 128);
+            }
+        }
+
+        const sf::Vector2u position = allocateRect(static_cast<unsigned int>(fieldWidth), static_cast<unsigned int>(fieldHeight));
+        for (int y = 0; y < fieldHeight; ++y)
+        {
+            for (int x = 0; x < fieldWidth; ++x)
+            {
+                const int gridX = x + spread;
+                const int gridY = y + spread;
+                const bool pixelInside = inside[static_cast<std::size_t>(gridY * gridWidth + gridX)];
+
+                // Find the nearest pixel on the other side of the outline
+                int minDistanceSquared = (spread + 1) * (spread + 1);
+                for (int dy = -spread; dy <= spread; ++dy)
+                {
+                    for (int dx = -spread; dx <= spread; ++dx)
+                    {
+                        if (inside[static_cast<std::size_t>((gridY + dy) * gridWidth + gridX + dx)] != pixelInside)
+                            minDistanceSquared = std::min(minDistanceSquared, dx * dx + dy * dy);
+                    }
+                }
+
+                // The outline lies halfway between the two pixels
+                const float distance = std::sqrt(static_cast<float>(minDistanceSquared)) - 0.5f;
+                const float signedDistance = pixelInside ? distance : -distance;
+                const float value = std::max(0.f, std::min(1.f, 0.5f + signedDistance / (2 * spread)));
+                m_image.setPixel(position.x + static_cast<unsigned int>(x), position.y + static_cast<unsigned int>(y),
+                                 sf::Color{255, 255, 255, static_cast<sf::Uint8>(value * 255 + 0.5f)});
+            }
+        }
+
+        result.bounds = {glyph.bounds.left - spread, glyph.bounds.top - spread, static_cast<float>(fieldWidth), static_cast<float>(fieldHeight)};
+        result.textureRect = {static_cast<int>(position.x), static_cast<int>(position.y), fieldWidth, fieldHeight};
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u DistanceFieldAtlas::allocateRect(unsigned int width, unsigned int height)
+    {
+        // Leave one pixel between glyphs so that smoothing doesn't mix neighbouring distance fields
+        if (m_nextX + width > distanceFieldAtlasWidth)
+        {
+            m_nextX = 0;
+            m_nextY += m_rowHeight + 1;
+            m_rowHeight = 0;
+        }
+
+        if (m_nextY + height > m_image.getSize().y)
+        {
+            unsigned int newHeight = m_image.getSize().y * 2;
+            while (m_nextY + height > newHeight)
+                newHeight *= 2;
+
+            sf::Image newImage;
+            newImage.create(distanceFieldAtlasWidth, newHeight, sf::Color{255, 255, 255, 0});
+            newImage.copy(m_image, 0, 0);
+            m_image = newImage;
+        }
+
+        const sf::Vector2u position{m_nextX, m_nextY};
+        m_dirtyTop = std::min(m_dirtyTop, position.y);
+        m_dirtyBottom = std::max(m_dirtyBottom, position.y + height);
+        m_nextX += width + 1;
+        m_rowHeight = std::max(m_rowHeight, height);
+        return position;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
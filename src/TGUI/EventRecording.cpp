@@ -0,0 +1,503 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/EventRecording.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/to_string.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // The file starts with this identifier, followed by a format version
+        const char recordingMagic[] = {'T', 'G', 'U', 'I', 'R', 'E', 'C'};
+        const std::uint8_t recordingVersion = 1;
+
+        // Integers are stored in a variable amount of bytes (7 bits per byte), small values only take a single byte
+        void writeRecordingVarUint(std::ostream& stream, std::uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                stream.put(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            stream.put(static_cast<char>(value));
+        }
+
+        void writeRecordingVarInt(std::ostream& stream, std::int64_t value)
+        {
+            // Zigzag encoding keeps values close to zero small, regardless of their sign
+            writeRecordingVarUint(stream, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+        }
+
+        void writeRecordingFloat(std::ostream& stream, float value)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            for (unsigned int i = 0; i < 4; ++i)
+                stream.put(static_cast<char>((bits >> (8 * i)) & 0xFF));
+        }
+
+        std::uint8_t readRecordingByte(std::istream& stream)
+        {
+            const int c = stream.get();
+            if (c == std::char_traits<char>::eof())
+                throw Exception{"Failed to read event recording, unexpected end of data."};
+
+            return static_cast<std::uint8_t>(c);
+        }
+
+        std::uint64_t readRecordingVarUint(std::istream& stream)
+        {
+            std::uint64_t value = 0;
+            for (unsigned int shift = 0; shift < 64; shift += 7)
+            {
+                const std::uint8_t byte = readRecordingByte(stream);
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    return value;
+            }
+
+            throw Exception{"Failed to read event recording, invalid integer."};
+        }
+
+        std::int64_t readRecordingVarInt(std::istream& stream)
+        {
+            const std::uint64_t value = readRecordingVarUint(stream);
+            return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+        }
+
+        float readRecordingFloat(std::istream& stream)
+        {
+            std::uint32_t bits = 0;
+            for (unsigned int i = 0; i < 4; ++i)
+                bits |= static_cast<std::uint32_t>(readRecordingByte(stream)) << (8 * i);
+
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        int readRecordingCoordinate(std::istream& stream)
+        {
+            return static_cast<int>(readRecordingVarInt(stream));
+        }
+
+        unsigned int readRecordingUnsigned(std::istream& stream)
+        {
+            return static_cast<unsigned int>(readRecordingVarUint(stream));
+        }
+
+        // Only the members that belong to the type of the event are stored
+        void writeRecordedEvent(std::ostream& stream, const sf::Event& event)
+        {
+            writeRecordingVarUint(stream, static_cast<std::uint64_t>(event.type));
+            switch (event.type)
+            {
+                case sf::Event::Resized:
+                    writeRecordingVarUint(stream, event.size.width);
+                    writeRecordingVarUint(stream, event.size.height);
+                    break;
+                case sf::Event::TextEntered:
+                    writeRecordingVarUint(stream, event.text.unicode);
+                    break;
+                case sf::Event::KeyPressed:
+                case sf::Event::KeyReleased:
+                    writeRecordingVarInt(stream, static_cast<std::int64_t>(event.key.code));
+                    stream.put(static_cast<char>((event.key.alt ? 1 : 0) | (event.key.control ? 2 : 0)
+                                               | (event.key.shift ? 4 : 0) | (event.key.system ? 8 : 0)));
+                    break;
+                case sf::Event::MouseWheelMoved:
+                    writeRecordingVarInt(stream, event.mouseWheel.delta);
+                    writeRecordingVarInt(stream, event.mouseWheel.x);
+                    writeRecordingVarInt(stream, event.mouseWheel.y);
+                    break;
+                case sf::Event::MouseWheelScrolled:
+                    writeRecordingVarUint(stream, static_cast<std::uint64_t>(event.mouseWheelScroll.wheel));
+                    writeRecordingFloat(stream, event.mouseWheelScroll.delta);
+                    writeRecordingVarInt(stream, event.mouseWheelScroll.x);
+                    writeRecordingVarInt(stream, event.mouseWheelScroll.y);
+                    break;
+                case sf::Event::MouseButtonPressed:
+                case sf::Event::MouseButtonReleased:
+                    writeRecordingVarUint(stream, static_cast<std::uint64_t>(event.mouseButton.button));
+                    writeRecordingVarInt(stream, event.mouseButton.x);
+                    writeRecordingVarInt(stream, event.mouseButton.y);
+                    break;
+                case sf::Event::MouseMoved:
+                    writeRecordingVarInt(stream, event.mouseMove.x);
+                    writeRecordingVarInt(stream, event.mouseMove.y);
+                    break;
+                case sf::Event::JoystickButtonPressed:
+                case sf::Event::JoystickButtonReleased:
+                    writeRecordingVarUint(stream, event.joystickButton.joystickId);
+                    writeRecordingVarUint(stream, event.joystickButton.button);
+                    break;
+                case sf::Event::JoystickMoved:
+                    writeRecordingVarUint(stream, event.joystickMove.joystickId);
+                    writeRecordingVarUint(stream, static_cast<std::uint64_t>(event.joystickMove.axis));
+                    writeRecordingFloat(stream, event.joystickMove.position);
+                    break;
+                case sf::Event::JoystickConnected:
+                case sf::Event::JoystickDisconnected:
+                    writeRecordingVarUint(stream, event.joystickConnect.joystickId);
+                    break;
+                case sf::Event::TouchBegan:
+                case sf::Event::TouchMoved:
+                case sf::Event::TouchEnded:
+                    writeRecordingVarUint(stream, event.touch.finger);
+                    writeRecordingVarInt(stream, event.touch.x);
+                    writeRecordingVarInt(stream, event.touch.y);
+                    break;
+                case sf::Event::SensorChanged:
+                    writeRecordingVarUint(stream, static_cast<std::uint64_t>(event.sensor.type));
+                    writeRecordingFloat(stream, event.sensor.x);
+                    writeRecordingFloat(stream, event.sensor.y);
+                    writeRecordingFloat(stream, event.sensor.z);
+                    break;
+                default: // Events without parameters
+                    break;
+            }
+        }
+
+        sf::Event readRecordedEvent(std::istream& stream)
+        {
+            const std::uint64_t type = readRecordingVarUint(stream);
+            if (type >= static_cast<std::uint64_t>(sf::Event::Count))
+                throw Exception{"Failed to read event recording, unknown event type " + to_string(type) + "."};
+
+            sf::Event event = sf::Event();
+            event.type = static_cast<sf::Event::EventType>(type);
+            switch (event.type)
+            {
+                case sf::Event::Resized:
+                    event.size.width = readRecordingUnsigned(stream);
+                    event.size.height = readRecordingUnsigned(stream);
+                    break;
+                case sf::Event::TextEntered:
+                    event.text.unicode = static_cast<sf::Uint32>(readRecordingVarUint(stream));
+                    break;
+                case sf::Event::KeyPressed:
+                case sf::Event::KeyReleased:
+                {
+                    event.key.code = static_cast<sf::Keyboard::Key>(readRecordingVarInt(stream));
+                    const std::uint8_t modifiers = readRecordingByte(stream);
+                    event.key.alt = ((modifiers & 1) != 0);
+                    event.key.control = ((modifiers & 2) != 0);
+                    event.key.shift = ((modifiers & 4) != 0);
+                    event.key.system = ((modifiers & 8) != 0);
+                    break;
+                }
+                case sf::Event::MouseWheelMoved:
+                    event.mouseWheel.delta = readRecordingCoordinate(stream);
+                    event.mouseWheel.x = readRecordingCoordinate(stream);
+                    event.mouseWheel.y = readRecordingCoordinate(stream);
+                    break;
+                case sf::Event::MouseWheelScrolled:
+                    event.mouseWheelScroll.wheel = static_cast<sf::Mouse::Wheel>(readRecordingVarUint(stream));
+                    event.mouseWheelScroll.delta = readRecordingFloat(stream);
+                    event.mouseWheelScroll.x = readRecordingCoordinate(stream);
+                    event.mouseWheelScroll.y = readRecordingCoordinate(stream);
+                    break;
+                case sf::Event::MouseButtonPressed:
+                case sf::Event::MouseButtonReleased:
+                    event.mouseButton.button = static_cast<sf::Mouse::Button>(readRecordingVarUint(stream));
+                    event.mouseButton.x = readRecordingCoordinate(stream);
+                    event.mouseButton.y = readRecordingCoordinate(stream);
+                    break;
+                case sf::Event::MouseMoved:
+                    event.mouseMove.x = readRecordingCoordinate(stream);
+                    event.mouseMove.y = readRecordingCoordinate(stream);
+                    break;
+                case sf::Event::JoystickButtonPressed:
+                case sf::Event::JoystickButtonReleased:
+                    event.joystickButton.joystickId = readRecordingUnsigned(stream);
+                    event.joystickButton.button = readRecordingUnsigned(stream);
+                    break;
+                case sf::Event::JoystickMoved:
+                    event.joystickMove.joystickId = readRecordingUnsigned(stream);
+                    event.joystickMove.axis = static_cast<sf::Joystick::Axis>(readRecordingVarUint(stream));
+                    event.joystickMove.position = readRecordingFloat(stream);
+                    break;
+                case sf::Event::JoystickConnected:
+                case sf::Event::JoystickDisconnected:
+                    event.joystickConnect.joystickId = readRecordingUnsigned(stream);
+                    break;
+                case sf::Event::TouchBegan:
+                case sf::Event::TouchMoved:
+                case sf::Event::TouchEnded:
+                    event.touch.finger = readRecordingUnsigned(stream);
+                    event.touch.x = readRecordingCoordinate(stream);
+                    event.touch.y = readRecordingCoordinate(stream);
+                    break;
+                case sf::Event::SensorChanged:
+                    event.sensor.type = static_cast<sf::Sensor::Type>(readRecordingVarUint(stream));
+                    event.sensor.x = readRecordingFloat(stream);
+                    event.sensor.y = readRecordingFloat(stream);
+                    event.sensor.z = readRecordingFloat(stream);
+                    break;
+                default: // Events without parameters
+                    break;
+            }
+
+            return event;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::addEvent(sf::Time timestamp, const sf::Event& event)
+    {
+        Entry entry;
+        entry.type = Entry::Type::Event;
+        entry.timestamp = timestamp;
+        entry.event = event;
+        m_entries.push_back(entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::addUpdate(sf::Time timestamp, sf::Time elapsedTime)
+    {
+        Entry entry;
+        entry.type = Entry::Type::Update;
+        entry.timestamp = timestamp;
+        entry.elapsedTime = elapsedTime;
+        m_entries.push_back(entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::addViewChange(sf::Time timestamp, const sf::FloatRect& view, sf::Vector2u targetSize)
+    {
+        Entry entry;
+        entry.type = Entry::Type::View;
+        entry.timestamp = timestamp;
+        entry.view = view;
+        entry.targetSize = targetSize;
+        m_entries.push_back(entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<EventRecording::Entry>& EventRecording::getEntries() const
+    {
+        return m_entries;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t EventRecording::getFrameCount() const
+    {
+        std::size_t frames = 0;
+        for (const auto& entry : m_entries)
+        {
+            if (entry.type == Entry::Type::Update)
+                ++frames;
+        }
+
+        return frames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::clear()
+    {
+        m_entries.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::setTargetSize(sf::Vector2u size)
+    {
+        m_targetSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u EventRecording::getTargetSize() const
+    {
+        return m_targetSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::setView(const sf::FloatRect& view)
+    {
+        m_view = view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect EventRecording::getView() const
+    {
+        return m_view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::saveToFile(const std::string& filename) const
+    {
+        std::ofstream file{filename, std::ios::binary};
+        if (!file)
+            throw Exception{"Failed to open '" + filename + "' to save the event recording."};
+
+        saveToStream(file);
+        if (!file)
+            throw Exception{"Failed to write the event recording to '" + filename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::loadFromFile(const std::string& filename)
+    {
+        std::ifstream file{filename, std::ios::binary};
+        if (!file)
+            throw Exception{"Failed to open '" + filename + "' to load the event recording."};
+
+        loadFromStream(file);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::saveToStream(std::ostream& stream) const
+    {
+        stream.write(recordingMagic, sizeof(recordingMagic));
+        stream.put(static_cast<char>(recordingVersion));
+
+        writeRecordingVarUint(stream, m_targetSize.x);
+        writeRecordingVarUint(stream, m_targetSize.y);
+        writeRecordingFloat(stream, m_view.left);
+        writeRecordingFloat(stream, m_view.top);
+        writeRecordingFloat(stream, m_view.width);
+        writeRecordingFloat(stream, m_view.height);
+
+        // Timestamps are stored relative to the previous entry, in microseconds
+        writeRecordingVarUint(stream, m_entries.size());
+        sf::Int64 previousTimestamp = 0;
+        for (const auto& entry : m_entries)
+        {
+            const sf::Int64 timestamp = entry.timestamp.asMicroseconds();
+            writeRecordingVarInt(stream, timestamp - previousTimestamp);
+            previousTimestamp = timestamp;
+
+            if (entry.type == Entry::Type::Event)
+            {
+                stream.put(0);
+                writeRecordedEvent(stream, entry.event);
+            }
+            else if (entry.type == Entry::Type::Update)
+            {
+                stream.put(1);
+                writeRecordingVarInt(stream, entry.elapsedTime.asMicroseconds());
+            }
+            else
+            {
+                stream.put(2);
+                writeRecordingFloat(stream, entry.view.left);
+                writeRecordingFloat(stream, entry.view.top);
+                writeRecordingFloat(stream, entry.view.width);
+                writeRecordingFloat(stream, entry.view.height);
+                writeRecordingVarUint(stream, entry.targetSize.x);
+                writeRecordingVarUint(stream, entry.targetSize.y);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecording::loadFromStream(std::istream& stream)
+    {
+        char magic[sizeof(recordingMagic)];
+        if (!stream.read(magic, sizeof(magic)) || (std::memcmp(magic, recordingMagic, sizeof(magic)) != 0))
+            throw Exception{"Failed to read event recording, the data does not contain a recording."};
+
+        const std::uint8_t version = readRecordingByte(stream);
+        if (version != recordingVersion)
+            throw Exception{"Failed to read event recording, unsupported version " + to_string(static_cast<unsigned int>(version)) + "."};
+
+        sf::Vector2u targetSize;
+        targetSize.x = readRecordingUnsigned(stream);
+        targetSize.y = readRecordingUnsigned(stream);
+
+        sf::FloatRect view;
+        view.left = readRecordingFloat(stream);
+        view.top = readRecordingFloat(stream);
+        view.width = readRecordingFloat(stream);
+        view.height = readRecordingFloat(stream);
+
+        // Don't trust the entry count for reserving memory, a corrupt file could claim to have billions of entries
+        const std::uint64_t entryCount = readRecordingVarUint(stream);
+        std::vector<Entry> entries;
+        sf::Int64 timestamp = 0;
+        for (std::uint64_t i = 0; i < entryCount; ++i)
+        {
+            timestamp += readRecordingVarInt(stream);
+
+            Entry entry;
+            entry.timestamp = sf::microseconds(timestamp);
+
+            const std::uint8_t type = readRecordingByte(stream);
+            if (type == 0)
+            {
+                entry.type = Entry::Type::Event;
+                entry.event = readRecordedEvent(stream);
+            }
+            else if (type == 1)
+            {
+                entry.type = Entry::Type::Update;
+                entry.elapsedTime = sf::microseconds(readRecordingVarInt(stream));
+            }
+            else if (type == 2)
+            {
+                entry.type = Entry::Type::View;
+                entry.view.left = readRecordingFloat(stream);
+                entry.view.top = readRecordingFloat(stream);
+                entry.view.width = readRecordingFloat(stream);
+                entry.view.height = readRecordingFloat(stream);
+                entry.targetSize.x = readRecordingUnsigned(stream);
+                entry.targetSize.y = readRecordingUnsigned(stream);
+            }
+            else
+                throw Exception{"Failed to read event recording, unknown entry type " + to_string(static_cast<unsigned int>(type)) + "."};
+
+            entries.push_back(entry);
+        }
+
+        m_entries = std::move(entries);
+        m_targetSize = targetSize;
+        m_view = view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,13 +25,37 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <SFML/System/Clock.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct GlyphPrewarmJob
+        {
+            std::weak_ptr<sf::Font> font;
+            sf::String characters;
+            std::vector<unsigned int> characterSizes;
+            TextStyle style;
+            std::size_t nextGlyph;
+            std::size_t glyphCount;
+        };
+
+        // Each thread has its own queue, because the fonts of a gui may only be used by the thread that runs the gui
+        std::deque<GlyphPrewarmJob>& getGlyphPrewarmQueue()
+        {
+            thread_local std::deque<GlyphPrewarmJob> queue;
+            return queue;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -209,6 +233,78 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Font::prewarmGlyphs(const std::vector<unsigned int>& characterSizes, TextStyle style, const sf::String& characters) const
+    {
+        if (!m_font || characterSizes.empty())
+            return;
+
+        GlyphPrewarmJob job;
+        job.font = m_font;
+        job.characters = characters;
+        job.characterSizes = characterSizes;
+        job.style = style;
+        job.nextGlyph = 0;
+
+        if (job.characters.isEmpty())
+        {
+            for (std::uint32_t c = 32; c < 127; ++c)
+                job.characters += c;
+        }
+
+        job.glyphCount = job.characters.getSize() * job.characterSizes.size();
+        getGlyphPrewarmQueue().push_back(std::move(job));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::processGlyphPrewarming(sf::Time maxDuration)
+    {
+        auto& queue = getGlyphPrewarmQueue();
+
+        sf::Clock clock;
+        while (!queue.empty())
+        {
+            GlyphPrewarmJob& job = queue.front();
+            const std::shared_ptr<sf::Font> font = job.font.lock();
+            if (!font)
+            {
+                queue.pop_front();
+                continue;
+            }
+
+            // Rasterize glyphs in small batches, to not check the clock after every glyph
+            const std::size_t batchEnd = std::min(job.nextGlyph + 8, job.glyphCount);
+            const bool bold = ((job.style & sf::Text::Bold) != 0);
+            for (; job.nextGlyph < batchEnd; ++job.nextGlyph)
+            {
+                font->getGlyph(job.characters[job.nextGlyph % job.characters.getSize()],
+                               job.characterSizes[job.nextGlyph / job.characters.getSize()],
+                               bold);
+            }
+
+            if (job.nextGlyph == job.glyphCount)
+                queue.pop_front();
+
+            if ((maxDuration != sf::Time::Zero) && (clock.getElapsedTime() >= maxDuration))
+                break;
+        }
+
+        return !queue.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Font::getPendingGlyphPrewarmCount()
+    {
+        std::size_t count = 0;
+        for (const auto& job : getGlyphPrewarmQueue())
+            count += job.glyphCount - job.nextGlyph;
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const
     {
         if (m_font)
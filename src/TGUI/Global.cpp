@@ -25,7 +25,7 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Clipboard.hpp>
-#include <TGUI/DefaultFont.hpp>
+#include <TGUI/Context.hpp>
 #include <functional>
 #include <sstream>
 #include <locale>
@@ -38,51 +38,43 @@ namespace tgui
 {
     namespace
     {
-        unsigned int globalTextSize = 13;
         unsigned int globalDoubleClickTime = 500;
         std::string globalResourcePath = "";
-        std::shared_ptr<sf::Font> globalFont = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void setGlobalTextSize(unsigned int textSize)
     {
-        globalTextSize = textSize;
+        Context::getCurrent()->setTextSize(textSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int getGlobalTextSize()
     {
-        return globalTextSize;
+        return Context::getCurrent()->getTextSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void setGlobalFont(const Font& font)
     {
-        globalFont = font.getFont();
+        Context::getCurrent()->setFont(font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font getGlobalFont()
     {
-        if (!globalFont)
-        {
-            globalFont = std::make_shared<sf::Font>();
-            globalFont->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes));
-        }
-
-        return globalFont;
+        return Context::getCurrent()->getFont();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const std::shared_ptr<sf::Font>& getInternalGlobalFont()
     {
-        return globalFont;
+        return Context::getCurrent()->getInternalFont();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +207,22 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t StringHasher::operator()(const sf::String& str) const
+    {
+        // FNV-1a hash
+        std::size_t hash = 2166136261u;
+        const sf::Uint32* data = str.getData();
+        for (std::size_t i = 0; i < str.getSize(); ++i)
+        {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,41 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Render target that is passed to the widgets when a render backend draws without a real render target.
+        // Nothing is ever drawn on it, because all drawing goes to the backend.
+        class BackendRenderTarget : public sf::RenderTarget
+        {
+        public:
+            explicit BackendRenderTarget(const RenderBackend& backend) :
+                m_backend(backend)
+            {
+            }
+
+            sf::Vector2u getSize() const override
+            {
+                return m_backend.getSize();
+            }
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            bool setActive(bool = true) override
+            {
+                return false;
+            }
+        #else
+        private:
+            bool activate(bool) override
+            {
+                return false;
+            }
+        #endif
+
+        private:
+            const RenderBackend& m_backend;
+        };
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
@@ -124,17 +159,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setRenderBackend(RenderBackend::Ptr backend)
+    {
+        m_renderBackend = std::move(backend);
+
+        if (m_renderBackend && !m_target)
+        {
+            const sf::Vector2u size = m_renderBackend->getSize();
+            setView(sf::View{sf::FloatRect{0, 0, static_cast<float>(size.x), static_cast<float>(size.y)}});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const RenderBackend::Ptr& Gui::getRenderBackend() const
+    {
+        return m_renderBackend;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::setView(const sf::View& view)
     {
+        Context::Scope contextScope{m_context};
+
         if ((m_view.getCenter() != view.getCenter()) || (m_view.getSize() != view.getSize()))
         {
             m_view = view;
 
+            if (m_recording)
+            {
+                const sf::Vector2u targetSize = m_target ? m_target->getSize() : m_recording->getTargetSize();
+                m_recording->addViewChange(m_recordingClock.getElapsedTime(), {view.getCenter() - view.getSize() / 2.f, view.getSize()}, targetSize);
+            }
+
+            // Widgets may postpone laying out their text while the view is being resized
+            m_context->setResizingView(true);
+
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
-            for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+            if (m_container->m_boundSizeLayouts)
+            {
+                for (auto& layout : *m_container->m_boundSizeLayouts)
+                    layout->recalculateValue();
+            }
+
+            m_context->setResizingView(false);
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -149,9 +220,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setResizeReflowDelay(sf::Time delay)
+    {
+        m_context->setResizeReflowDelay(delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getResizeReflowDelay() const
+    {
+        return m_context->getResizeReflowDelay();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setResizeReflowTimeBudget(sf::Time budget)
+    {
+        m_context->setResizeReflowTimeBudget(budget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getResizeReflowTimeBudget() const
+    {
+        return m_context->getResizeReflowTimeBudget();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::handleEvent(sf::Event event)
     {
-        assert(m_target != nullptr);
+        assert((m_target != nullptr) || (m_renderBackend != nullptr));
+
+        Context::Scope contextScope{m_context};
+        TGUI_PROFILE_SCOPE(Event, "Gui::handleEvent");
+        TGUI_PROFILE_COUNT(Events);
+
+        // The event is recorded before the mouse position is mapped, replaying it will map it again
+        if (m_recording)
+            m_recording->addEvent(m_recordingClock.getElapsedTime(), event);
 
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
@@ -165,7 +272,7 @@ namespace tgui
             {
                 case sf::Event::MouseMoved:
                 {
-                    mouseCoords = m_target->mapPixelToCoords({event.mouseMove.x, event.mouseMove.y}, m_view);
+                    mouseCoords = mapPixelToView(event.mouseMove.x, event.mouseMove.y);
                     event.mouseMove.x = static_cast<int>(mouseCoords.x + 0.5f);
                     event.mouseMove.y = static_cast<int>(mouseCoords.y + 0.5f);
                     break;
@@ -174,7 +281,7 @@ namespace tgui
                 case sf::Event::MouseButtonPressed:
                 case sf::Event::MouseButtonReleased:
                 {
-                    mouseCoords = m_target->mapPixelToCoords({event.mouseButton.x, event.mouseButton.y}, m_view);
+                    mouseCoords = mapPixelToView(event.mouseButton.x, event.mouseButton.y);
                     event.mouseButton.x = static_cast<int>(mouseCoords.x + 0.5f);
                     event.mouseButton.y = static_cast<int>(mouseCoords.y + 0.5f);
                     break;
@@ -182,7 +289,7 @@ namespace tgui
 
                 case sf::Event::MouseWheelScrolled:
                 {
-                    mouseCoords = m_target->mapPixelToCoords({event.mouseWheelScroll.x, event.mouseWheelScroll.y}, m_view);
+                    mouseCoords = mapPixelToView(event.mouseWheelScroll.x, event.mouseWheelScroll.y);
                     event.mouseWheelScroll.x = static_cast<int>(mouseCoords.x + 0.5f);
                     event.mouseWheelScroll.y = static_cast<int>(mouseCoords.y + 0.5f);
                     break;
@@ -192,7 +299,7 @@ namespace tgui
                 case sf::Event::TouchBegan:
                 case sf::Event::TouchEnded:
                 {
-                    mouseCoords = m_target->mapPixelToCoords({event.touch.x, event.touch.y}, m_view);
+                    mouseCoords = mapPixelToView(event.touch.x, event.touch.y);
                     event.touch.x = static_cast<int>(mouseCoords.x + 0.5f);
                     event.touch.y = static_cast<int>(mouseCoords.y + 0.5f);
                     break;
@@ -250,6 +357,103 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    EventBatchStats Gui::handleEvents(const std::vector<sf::Event>& events)
+    {
+        EventBatchStats stats;
+
+        std::size_t i = 0;
+        while (i < events.size())
+        {
+            sf::Event event = events[i++];
+            if (event.type == sf::Event::MouseMoved)
+            {
+                // Only the last position matters
+                while ((i < events.size()) && (events[i].type == sf::Event::MouseMoved))
+                {
+                    event = events[i++];
+                    stats.droppedEvents++;
+                }
+            }
+            else if (event.type == sf::Event::TouchMoved)
+            {
+                while ((i < events.size()) && (events[i].type == sf::Event::TouchMoved) && (events[i].touch.finger == event.touch.finger))
+                {
+                    event = events[i++];
+                    stats.droppedEvents++;
+                }
+            }
+            else if (event.type == sf::Event::MouseWheelScrolled)
+            {
+                // Scroll once over the total distance, as long as the mouse stays at the same position.
+                // Scroll events at different positions may have to go to different widgets.
+                while ((i < events.size()) && (events[i].type == sf::Event::MouseWheelScrolled)
+                    && (events[i].mouseWheelScroll.wheel == event.mouseWheelScroll.wheel)
+                    && (events[i].mouseWheelScroll.x == event.mouseWheelScroll.x)
+                    && (events[i].mouseWheelScroll.y == event.mouseWheelScroll.y))
+                {
+                    event.mouseWheelScroll.delta += events[i++].mouseWheelScroll.delta;
+                    stats.droppedEvents++;
+                }
+            }
+
+            stats.processedEvents++;
+            if (handleEvent(event))
+                stats.consumedEvents++;
+        }
+
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::startRecording()
+    {
+        m_recording = std::make_unique<EventRecording>();
+        m_recordingClock.restart();
+
+        if (m_target)
+            m_recording->setTargetSize(m_target->getSize());
+        else
+            m_recording->setTargetSize({static_cast<unsigned int>(m_view.getSize().x + 0.5f), static_cast<unsigned int>(m_view.getSize().y + 0.5f)});
+
+        m_recording->setView({m_view.getCenter() - m_view.getSize() / 2.f, m_view.getSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    EventRecording Gui::stopRecording()
+    {
+        if (!m_recording)
+            return {};
+
+        EventRecording recording = std::move(*m_recording);
+        m_recording = nullptr;
+        return recording;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isRecording() const
+    {
+        return m_recording != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setAutomaticTimeUpdateEnabled(bool enabled)
+    {
+        m_automaticTimeUpdate = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isAutomaticTimeUpdateEnabled() const
+    {
+        return m_automaticTimeUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     void Gui::enableTabKeyUsage()
     {
@@ -281,24 +485,85 @@ namespace tgui
 
     void Gui::draw()
     {
-        assert(m_target != nullptr);
+        assert((m_target != nullptr) || (m_renderBackend != nullptr));
 
-        // Update the time
-        if (m_windowFocused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+        {
+            Context::Scope contextScope{m_context};
+            TGUI_PROFILE_SCOPE(Draw, "Gui::draw");
+
+            // Apply the changes that other threads have requested
+            m_commandQueue.execute(m_commandBatchSize);
+
+            // Update the time
+            if (m_windowFocused && m_automaticTimeUpdate)
+                updateTime(m_clock.restart());
+            else
+                m_clock.restart();
+
+            if (m_renderBackend)
+            {
+                // The widgets still need a render target to pass along, even though nothing is drawn on it
+                BackendRenderTarget backendTarget{*m_renderBackend};
+                sf::RenderTarget* target = m_target ? m_target : &backendTarget;
+
+                const RenderBackend::Scope backendScope{m_renderBackend.get()};
+                m_renderBackend->beginFrame(m_view);
+                m_container->drawWidgetContainer(target, sf::RenderStates::Default);
+                m_renderBackend->endFrame();
+            }
+            else
+            {
+                // Change the view
+                const sf::View oldView = m_target->getView();
+                m_target->setView(m_view);
+                Clipping::setGuiView(m_view);
+
+                // Draw the widgets
+                m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+
+                // Restore the old view
+                m_target->setView(oldView);
+            }
+        }
+
+#ifdef TGUI_ENABLE_PROFILING
+        m_frameStats = Profiler::finishFrame();
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Change the view
-        const sf::View oldView = m_target->getView();
-        m_target->setView(m_view);
-        Clipping::setGuiView(m_view);
+    const FrameStats& Gui::getFrameStats() const
+    {
+        return m_frameStats;
+    }
 
-        // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Restore the old view
-        m_target->setView(oldView);
+    void Gui::post(std::function<void()> command)
+    {
+        m_commandQueue.post(std::move(command));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setCommandBatchSize(std::size_t maxCommands)
+    {
+        m_commandBatchSize = maxCommands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getCommandBatchSize() const
+    {
+        return m_commandBatchSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueueStats Gui::getCommandQueueStats() const
+    {
+        return m_commandQueue.getStats();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,9 +575,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TweenEngine& Gui::getTweenEngine()
+    {
+        return m_container->getTweenEngine();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Context::Ptr& Gui::getContext() const
+    {
+        return m_context;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::setFont(const Font& font)
     {
+        Context::Scope contextScope{m_context};
         m_container->setInheritedFont(font);
+        font.prewarmGlyphs({getGlobalTextSize()});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,6 +621,7 @@ namespace tgui
 
     void Gui::add(const Widget::Ptr& widgetPtr, const sf::String& widgetName)
     {
+        Context::Scope contextScope{m_context};
         m_container->add(widgetPtr, widgetName);
     }
 
@@ -424,6 +706,7 @@ namespace tgui
 
     void Gui::loadWidgetsFromFile(const std::string& filename)
     {
+        Context::Scope contextScope{m_context};
         m_container->loadWidgetsFromFile(filename);
     }
 
@@ -438,6 +721,7 @@ namespace tgui
 
     void Gui::loadWidgetsFromStream(std::stringstream& stream)
     {
+        Context::Scope contextScope{m_context};
         m_container->loadWidgetsFromStream(stream);
     }
 
@@ -459,9 +743,23 @@ namespace tgui
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        Context::Scope contextScope{m_context};
+        TGUI_PROFILE_SCOPE(Update, "Gui::updateTime");
+
+        if (m_recording)
+            m_recording->addUpdate(m_recordingClock.getElapsedTime(), elapsedTime);
+
+        m_context->resetResizeReflowTime();
+
+        // All tweens of the gui are advanced at once, before the widgets update their own timers
+        m_container->getTweenEngine().update(elapsedTime);
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
 
+        // Spread the rasterization of prewarmed glyphs over the frames
+        Font::processGlyphPrewarming(sf::milliseconds(2));
+
         if (m_tooltipPossible)
         {
             m_tooltipTime += elapsedTime;
@@ -494,6 +792,25 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f Gui::mapPixelToView(int x, int y) const
+    {
+        if (m_target)
+            return m_target->mapPixelToCoords({x, y}, m_view);
+
+        // Do the same calculation as sf::RenderTarget::mapPixelToCoords, but with the size of the backend
+        const sf::Vector2u size = m_renderBackend->getSize();
+        const sf::FloatRect& viewport = m_view.getViewport();
+        const float left = static_cast<float>(static_cast<int>(0.5f + size.x * viewport.left));
+        const float top = static_cast<float>(static_cast<int>(0.5f + size.y * viewport.top));
+        const float width = static_cast<float>(static_cast<int>(0.5f + size.x * viewport.width));
+        const float height = static_cast<float>(static_cast<int>(0.5f + size.y * viewport.height));
+
+        const Vector2f normalized{-1.f + 2.f * (x - left) / width, 1.f - 2.f * (y - top) / height};
+        return m_view.getInverseTransform().transformPoint(normalized);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
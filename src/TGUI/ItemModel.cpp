@@ -0,0 +1,79 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/ItemModel.hpp>
+#include <TGUI/to_string.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    ItemModel::ItemModel(std::vector<sf::String> items, std::vector<sf::String> ids) :
+        m_items  {std::move(items)},
+        m_itemIds{std::move(ids)}
+    {
+        if (m_itemIds.empty())
+            m_itemIds.resize(m_items.size());
+        else if (m_itemIds.size() != m_items.size())
+            throw Exception{"Amount of item ids (" + to_string(m_itemIds.size()) + ") differs from the amount of items (" + to_string(m_items.size()) + ") in ItemModel"};
+
+        // Emplace doesn't overwrite existing keys, so the first item with a given name or id is stored
+        m_itemIndex.reserve(m_items.size());
+        m_itemIdIndex.reserve(m_itemIds.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            m_itemIndex.emplace(m_items[i], i);
+            m_itemIdIndex.emplace(m_itemIds[i], i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemModel::ConstPtr ItemModel::create(std::vector<sf::String> items, std::vector<sf::String> ids)
+    {
+        return std::make_shared<ItemModel>(std::move(items), std::move(ids));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ItemModel::findItem(const sf::String& item) const
+    {
+        const auto it = m_itemIndex.find(item);
+        return (it != m_itemIndex.end()) ? static_cast<int>(it->second) : -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ItemModel::findItemById(const sf::String& id) const
+    {
+        const auto it = m_itemIdIndex.find(id);
+        return (it != m_itemIdIndex.end()) ? static_cast<int>(it->second) : -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,8 +27,12 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/to_string.hpp>
+#include <TGUI/Profiler.hpp>
 #include <SFML/System/Err.hpp>
+#include <unordered_map>
 #include <cassert>
+#include <limits>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,12 +68,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Index of the bound string in nodes that weren't created from a string
+        const std::uint32_t NoBoundString = std::numeric_limits<std::uint32_t>::max();
+
+        // The amount of parsed strings that are remembered, the cache is cleared when it becomes full
+        const std::size_t MaxCachedLayoutExpressions = 1024;
+
+        struct LayoutExpressionCache
+        {
+            std::mutex mutex;
+            std::unordered_map<std::string, Layout> layouts;
+        };
+
+        LayoutExpressionCache& getLayoutExpressionCache()
+        {
+            static LayoutExpressionCache cache;
+            return cache;
+        }
+
+        bool isLayoutBindingPosition(Layout::Operation operation)
+        {
+            return (operation == Layout::Operation::BindingLeft) || (operation == Layout::Operation::BindingTop);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Layout::Layout(std::string expression)
+    {
+        expression = trim(expression);
+
+        // Layouts are often created from the same strings, so only parse each string once
+        auto& cache = getLayoutExpressionCache();
+        {
+            std::lock_guard<std::mutex> lock{cache.mutex};
+            const auto it = cache.layouts.find(expression);
+            if (it != cache.layouts.end())
+            {
+                *this = it->second;
+                return;
+            }
+        }
+
+        Layout layout = parse(expression);
+
+        {
+            std::lock_guard<std::mutex> lock{cache.mutex};
+            if (cache.layouts.size() >= MaxCachedLayoutExpressions)
+                cache.layouts.clear();
+
+            cache.layouts.emplace(expression, layout);
+        }
+
+        *this = std::move(layout);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout Layout::parse(std::string expression)
     {
         // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus)
         expression = trim(expression);
         if (expression.empty())
-            return;
+            return {};
 
         auto searchPos = expression.find_first_of("+-/*()");
 
@@ -81,15 +144,12 @@ namespace tgui
             {
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == "100%")
-                {
-                    m_boundString = "&.innersize";
-                    m_operation = Operation::BindingString;
-                }
+                    return createBindingString("&.innersize");
                 else // value is a fraction of parent size
                 {
-                    *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(tgui::stof(expression.substr(0, expression.length()-1)) / 100.f),
-                                   std::make_unique<Layout>("&.innersize")};
+                    return Layout{Layout::Operation::Multiplies,
+                                  Layout{tgui::stof(expression.substr(0, expression.length()-1)) / 100.f},
+                                  createBindingString("&.innersize")};
                 }
             }
             else
@@ -114,26 +174,23 @@ namespace tgui
                  || (expression.size() >= 11 && expression.substr(expression.size()-11) == "innerheight"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    return createBindingString(expression);
                 }
                 else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
                 {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "left"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "width")};
+                    return Layout{Operation::Plus,
+                                  parse(expression.substr(0, expression.size()-5) + "left"),
+                                  parse(expression.substr(0, expression.size()-5) + "width")};
                 }
                 else if (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom")
                 {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "top"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "height")};
+                    return Layout{Operation::Plus,
+                                  parse(expression.substr(0, expression.size()-6) + "top"),
+                                  parse(expression.substr(0, expression.size()-6) + "height")};
                 }
                 else // Constant value
-                    m_value = tgui::stof(expression);
+                    return Layout{tgui::stof(expression)};
             }
-
-            return;
         }
 
         // The string contains an expression, so split it up in multiple layouts
@@ -146,19 +203,19 @@ namespace tgui
             {
             case '+':
                 operators.push_back(Operation::Plus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '-':
                 operators.push_back(Operation::Minus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '*':
                 operators.push_back(Operation::Multiplies);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '/':
                 operators.push_back(Operation::Divides);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '(':
             {
@@ -176,20 +233,17 @@ namespace tgui
                         // If the entire layout was in brackets then remove these brackets
                         if ((searchPos == 0) && (bracketPos == expression.size()-1))
                         {
-                            *this = Layout{expression.substr(1, expression.size()-2)};
-                            return;
+                            return parse(expression.substr(1, expression.size()-2));
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "min"))
                         {
                             const auto& minSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Minimum, std::make_unique<Layout>(minSubExpressions.first), std::make_unique<Layout>(minSubExpressions.second)};
-                            return;
+                            return Layout{Operation::Minimum, parse(minSubExpressions.first), parse(minSubExpressions.second)};
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "max"))
                         {
                             const auto& maxSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Maximum, std::make_unique<Layout>(maxSubExpressions.first), std::make_unique<Layout>(maxSubExpressions.second)};
-                            return;
+                            return Layout{Operation::Maximum, parse(maxSubExpressions.first), parse(maxSubExpressions.second)};
                         }
                         else // The brackets form a sub-expression
                             searchPos = bracketPos;
@@ -203,7 +257,7 @@ namespace tgui
                 if (bracketPos == std::string::npos)
                 {
                     TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                    return;
+                    return {};
                 }
                 else
                 {
@@ -214,7 +268,7 @@ namespace tgui
             }
             case ')':
                 TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                return;
+                return {};
             };
 
             prevSearchPos = searchPos + 1;
@@ -225,10 +279,10 @@ namespace tgui
         {
             // We would get an infinite loop if we don't abort in this condition
             TGUI_PRINT_WARNING("error in expression '" << expression << "'.");
-            return;
+            return {};
         }
 
-        operands.emplace_back(expression.substr(prevSearchPos));
+        operands.push_back(parse(expression.substr(prevSearchPos)));
 
         // First perform all * and / operations
         auto operandIt = operands.begin();
@@ -239,9 +293,7 @@ namespace tgui
                 auto nextOperandIt = operandIt;
                 std::advance(nextOperandIt, 1);
 
-                (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+                (*operandIt) = Layout{operators[i], *operandIt, *nextOperandIt};
 
                 operands.erase(nextOperandIt);
             }
@@ -263,7 +315,7 @@ namespace tgui
                 assert(nextOperandIt != operands.end());
 
                 // Handle unary plus or minus
-                if ((operandIt->m_operation == Operation::Value) && (nextOperandIt->m_operation == Operation::Value) && (operandIt->m_value == 0))
+                if (operandIt->m_nodes.empty() && nextOperandIt->m_nodes.empty() && (operandIt->m_value == 0))
                 {
                     if (operators[i] == Operation::Minus)
                         nextOperandIt->m_value = -nextOperandIt->m_value;
@@ -272,9 +324,7 @@ namespace tgui
                 }
                 else // Normal addition or subtraction
                 {
-                    *operandIt = Layout{operators[i],
-                                        std::make_unique<Layout>(*operandIt),
-                                        std::make_unique<Layout>(*nextOperandIt)};
+                    *operandIt = Layout{operators[i], *operandIt, *nextOperandIt};
                 }
 
                 operands.erase(nextOperandIt);
@@ -282,88 +332,71 @@ namespace tgui
         }
 
         assert(operands.size() == 1);
-        *this = operands.front();
+        return std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+    Layout Layout::createBindingString(std::string expression)
     {
-        assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-        assert(m_boundWidget != nullptr);
+        Layout layout;
+        layout.m_boundStrings = std::make_shared<const std::vector<std::string>>(1, std::move(expression));
+        layout.m_nodes.push_back({Operation::BindingString, 0, 0, 0, 0, nullptr});
+        return layout;
+    }
 
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Operation operation, Widget* boundWidget)
+    {
+        assert((operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight));
+        assert(boundWidget != nullptr);
 
-        resetPointers();
+        m_nodes.push_back({operation, 0, 0, 0, NoBoundString, boundWidget});
+
+        bindWidgets();
         recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+    Layout::Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand)
     {
-        assert(m_leftOperand != nullptr);
-        assert(m_rightOperand != nullptr);
-        resetPointers();
+        m_nodes.reserve(std::max<std::size_t>(leftOperand.m_nodes.size(), 1) + std::max<std::size_t>(rightOperand.m_nodes.size(), 1) + 1);
+
+        const std::uint32_t leftIndex = appendOperand(leftOperand);
+        const std::uint32_t rightIndex = appendOperand(rightOperand);
+        m_nodes.push_back({operation, 0, leftIndex, rightIndex, NoBoundString, nullptr});
+
+        bindWidgets();
         recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {other.m_parent},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString}
+        m_value       {other.m_value},
+        m_nodes       {other.m_nodes},
+        m_boundStrings{other.m_boundStrings}
     {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
-
-        resetPointers();
+        // Disconnect the bound widgets if a string was used, the same name may apply to a different widget now
+        resetBindingStrings();
+        bindWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)}
+        m_value       {other.m_value},
+        m_boundStrings{std::move(other.m_boundStrings)}
     {
-        resetPointers();
+        other.unbindLayout();
+        m_nodes = std::move(other.m_nodes);
+        other.m_nodes.clear();
+
+        bindWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,19 +407,13 @@ namespace tgui
         {
             unbindLayout();
 
-            m_value           = other.m_value;
-            m_parent          = other.m_parent;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
+            m_value        = other.m_value;
+            m_nodes        = other.m_nodes;
+            m_boundStrings = other.m_boundStrings;
 
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
-
-            resetPointers();
+            // Disconnect the bound widgets if a string was used, the same name may apply to a different widget now
+            resetBindingStrings();
+            bindWidgets();
         }
 
         return *this;
@@ -399,16 +426,14 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
+            other.unbindLayout();
 
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
+            m_value        = other.m_value;
+            m_nodes        = std::move(other.m_nodes);
+            m_boundStrings = std::move(other.m_boundStrings);
+            other.m_nodes.clear();
 
-            resetPointers();
+            bindWidgets();
         }
 
         return *this;
@@ -425,107 +450,180 @@ namespace tgui
 
     std::string Layout::toString() const
     {
-        if (m_operation == Operation::Value)
-        {
+        if (m_nodes.empty())
             return to_string(m_value);
+        else
+            return nodeToString(static_cast<std::uint32_t>(m_nodes.size() - 1));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Layout::nodeToString(std::uint32_t index) const
+    {
+        const Node& node = m_nodes[index];
+        if (node.operation == Operation::Value)
+        {
+            return to_string(node.value);
         }
-        else if (m_operation == Operation::Minimum)
+        else if (node.operation == Operation::Minimum)
         {
-            return "min(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
+            return "min(" + nodeToString(node.leftOperand) + ", " + nodeToString(node.rightOperand) + ")";
         }
-        else if (m_operation == Operation::Maximum)
+        else if (node.operation == Operation::Maximum)
         {
-            return "max(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
+            return "max(" + nodeToString(node.leftOperand) + ", " + nodeToString(node.rightOperand) + ")";
         }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
+        else if ((node.operation == Operation::Plus) || (node.operation == Operation::Minus) || (node.operation == Operation::Multiplies) || (node.operation == Operation::Divides))
         {
             char operatorChar;
-            if (m_operation == Operation::Plus)
+            if (node.operation == Operation::Plus)
                 operatorChar = '+';
-            else if (m_operation == Operation::Minus)
+            else if (node.operation == Operation::Minus)
                 operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
+            else if (node.operation == Operation::Multiplies)
                 operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
+            else // if (node.operation == Operation::Divides)
                 operatorChar = '/';
 
-            auto subExpressionNeedsBrackets = [](const std::unique_ptr<Layout>& operand)
+            const auto isPercentage = [this](const Node& operand)
                 {
-                    if (!operand->m_leftOperand)
-                        return false;
+                    return (operand.operation == Operation::Multiplies)
+                        && (m_nodes[operand.leftOperand].operation == Operation::Value)
+                        && (nodeToString(operand.rightOperand) == "100%");
+                };
 
-                    if ((operand->m_operation == Operation::Minimum) || (operand->m_operation == Operation::Maximum))
+            const auto subExpressionNeedsBrackets = [this,&isPercentage](std::uint32_t operandIndex)
+                {
+                    const Node& operand = m_nodes[operandIndex];
+                    if ((operand.operation != Operation::Plus) && (operand.operation != Operation::Minus)
+                     && (operand.operation != Operation::Multiplies) && (operand.operation != Operation::Divides))
                         return false;
 
-                    if ((operand->m_operation == Operation::Multiplies) && (operand->m_leftOperand->m_operation == Operation::Value) && (operand->m_rightOperand->toString() == "100%"))
+                    if (isPercentage(operand))
                         return false;
 
                     return true;
                 };
 
-            if (subExpressionNeedsBrackets(m_leftOperand) && subExpressionNeedsBrackets(m_rightOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else if (subExpressionNeedsBrackets(m_leftOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " " + m_rightOperand->toString();
-            else if (subExpressionNeedsBrackets(m_rightOperand))
-                return m_leftOperand->toString() + " " + operatorChar + " (" + m_rightOperand->toString() + ")";
+            const bool leftNeedsBrackets = subExpressionNeedsBrackets(node.leftOperand);
+            const bool rightNeedsBrackets = subExpressionNeedsBrackets(node.rightOperand);
+            if (leftNeedsBrackets && rightNeedsBrackets)
+                return "(" + nodeToString(node.leftOperand) + ") " + operatorChar + " (" + nodeToString(node.rightOperand) + ")";
+            else if (leftNeedsBrackets)
+                return "(" + nodeToString(node.leftOperand) + ") " + operatorChar + " " + nodeToString(node.rightOperand);
+            else if (rightNeedsBrackets)
+                return nodeToString(node.leftOperand) + " " + operatorChar + " (" + nodeToString(node.rightOperand) + ")";
             else
             {
-                if ((m_operation == Operation::Multiplies) && (m_leftOperand->m_operation == Operation::Value) && (m_rightOperand->toString() == "100%"))
-                    return to_string(m_leftOperand->getValue() * 100) + '%';
+                if (isPercentage(node))
+                    return to_string(m_nodes[node.leftOperand].value * 100) + '%';
                 else
-                    return m_leftOperand->toString() + " " + operatorChar + " " + m_rightOperand->toString();
+                    return nodeToString(node.leftOperand) + " " + operatorChar + " " + nodeToString(node.rightOperand);
             }
         }
         else
         {
-            if (m_boundString == "&.innersize")
+            // Hopefully the expression is stored in a bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+            if (node.boundString == NoBoundString)
+                return "";
+
+            const std::string& boundString = (*m_boundStrings)[node.boundString];
+            if (boundString == "&.innersize")
                 return "100%";
 
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            return m_boundString;
+            return boundString;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindLayout()
+    std::uint32_t Layout::appendOperand(const Layout& operand)
     {
-        if (m_boundWidget)
+        // A constant layout doesn't store any nodes, its value becomes a single node in the expression
+        if (operand.m_nodes.empty())
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+            m_nodes.push_back({Operation::Value, operand.m_value, 0, 0, NoBoundString, nullptr});
+            return static_cast<std::uint32_t>(m_nodes.size() - 1);
+        }
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
+        // Merge the bound strings of the operand with the ones that are already used by the nodes
+        std::uint32_t stringOffset = 0;
+        if (operand.m_boundStrings && !operand.m_boundStrings->empty())
+        {
+            if (!m_boundStrings || m_boundStrings->empty())
+                m_boundStrings = operand.m_boundStrings;
             else
-                m_boundWidget->unbindSizeLayout(this);
+            {
+                auto boundStrings = std::make_shared<std::vector<std::string>>(*m_boundStrings);
+                stringOffset = static_cast<std::uint32_t>(boundStrings->size());
+                boundStrings->insert(boundStrings->end(), operand.m_boundStrings->begin(), operand.m_boundStrings->end());
+                m_boundStrings = std::move(boundStrings);
+            }
+        }
+
+        const auto nodeOffset = static_cast<std::uint32_t>(m_nodes.size());
+        for (Node node : operand.m_nodes)
+        {
+            node.leftOperand += nodeOffset;
+            node.rightOperand += nodeOffset;
+
+            // The widget found for a string may no longer be the widget that the string refers to
+            if (node.boundString != NoBoundString)
+            {
+                node.boundString += stringOffset;
+                node.boundWidget = nullptr;
+                node.operation = Operation::BindingString;
+            }
+
+            m_nodes.push_back(node);
         }
+
+        return static_cast<std::uint32_t>(m_nodes.size() - 1);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::resetPointers()
+    void Layout::bindWidgets()
     {
-        if (m_leftOperand != nullptr)
+        for (const auto& node : m_nodes)
         {
-            assert(m_rightOperand != nullptr);
+            if (!node.boundWidget)
+                continue;
 
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
+            if (isLayoutBindingPosition(node.operation))
+                node.boundWidget->bindPositionLayout(this);
+            else
+                node.boundWidget->bindSizeLayout(this);
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (m_boundWidget)
+    void Layout::unbindLayout()
+    {
+        for (const auto& node : m_nodes)
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+            if (!node.boundWidget)
+                continue;
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
+            if (isLayoutBindingPosition(node.operation))
+                node.boundWidget->unbindPositionLayout(this);
             else
-                m_boundWidget->bindSizeLayout(this);
+                node.boundWidget->unbindSizeLayout(this);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::resetBindingStrings()
+    {
+        for (auto& node : m_nodes)
+        {
+            if (node.boundString != NoBoundString)
+            {
+                node.boundWidget = nullptr;
+                node.operation = Operation::BindingString;
+            }
         }
     }
 
@@ -538,7 +636,20 @@ namespace tgui
         // No callbacks must be made while parsing, a single callback will be made when done if needed
         m_connectedWidgetCallback = nullptr;
 
-        parseBindingStringRecursive(widget, xAxis);
+        // Parse the string bindings even when the referred widgets were already found. The widget may be added to a different parent
+        if (m_boundStrings)
+        {
+            unbindLayout();
+
+            for (auto& node : m_nodes)
+            {
+                if (node.boundString != NoBoundString)
+                    parseBindingString(node, (*m_boundStrings)[node.boundString], widget, xAxis);
+            }
+
+            bindWidgets();
+            recalculateValue();
+        }
 
         // Restore the callback function
         m_connectedWidgetCallback = valueChangedCallbackHandler;
@@ -552,16 +663,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    void Layout::unbindWidget(Widget* widget)
     {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        for (auto& node : m_nodes)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            if (node.boundWidget != widget)
+                continue;
+
+            node.boundWidget = nullptr;
+
+            if (node.boundString != NoBoundString)
+                node.operation = Operation::BindingString;
+            else
+            {
+                node.value = 0;
+                node.operation = Operation::Value;
+            }
         }
 
         recalculateValue();
@@ -571,149 +688,138 @@ namespace tgui
 
     void Layout::recalculateValue()
     {
-        const float oldValue = m_value;
+        TGUI_PROFILE_SCOPE(Layout, "Layout::recalculateValue");
 
-        switch (m_operation)
-        {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingInnerWidth:
-            {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
-                break;
-            }
-            case Operation::BindingInnerHeight:
-            {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
-            }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
-        };
+        if (m_nodes.empty())
+            return;
 
-        if (m_value != oldValue)
+        const float oldValue = m_value;
+
+        // The operands of a node are always stored before it, so a single pass over the nodes evaluates the entire expression
+        Node* const nodes = m_nodes.data();
+        for (auto& node : m_nodes)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            switch (node.operation)
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
-            }
+                case Operation::Value:
+                    break;
+                case Operation::Plus:
+                    node.value = nodes[node.leftOperand].value + nodes[node.rightOperand].value;
+                    break;
+                case Operation::Minus:
+                    node.value = nodes[node.leftOperand].value - nodes[node.rightOperand].value;
+                    break;
+                case Operation::Multiplies:
+                    node.value = nodes[node.leftOperand].value * nodes[node.rightOperand].value;
+                    break;
+                case Operation::Divides:
+                    if (nodes[node.rightOperand].value != 0)
+                        node.value = nodes[node.leftOperand].value / nodes[node.rightOperand].value;
+                    else
+                        node.value = 0;
+                    break;
+                case Operation::Minimum:
+                    node.value = std::min(nodes[node.leftOperand].value, nodes[node.rightOperand].value);
+                    break;
+                case Operation::Maximum:
+                    node.value = std::max(nodes[node.leftOperand].value, nodes[node.rightOperand].value);
+                    break;
+                case Operation::BindingLeft:
+                    node.value = node.boundWidget->getPosition().x;
+                    break;
+                case Operation::BindingTop:
+                    node.value = node.boundWidget->getPosition().y;
+                    break;
+                case Operation::BindingWidth:
+                    node.value = node.boundWidget->getSize().x;
+                    break;
+                case Operation::BindingHeight:
+                    node.value = node.boundWidget->getSize().y;
+                    break;
+                case Operation::BindingInnerWidth:
+                {
+                    const auto* boundContainer = dynamic_cast<Container*>(node.boundWidget);
+                    if (boundContainer)
+                        node.value = boundContainer->getInnerSize().x;
+                    break;
+                }
+                case Operation::BindingInnerHeight:
+                {
+                    const auto* boundContainer = dynamic_cast<Container*>(node.boundWidget);
+                    if (boundContainer)
+                        node.value = boundContainer->getInnerSize().y;
+                    break;
+                }
+                case Operation::BindingString:
+                    // The string should have already been parsed by now.
+                    // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
+                    break;
+            };
         }
-    }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        m_value = m_nodes.back().value;
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
-    {
-        if (m_leftOperand)
+        if (m_value != oldValue)
         {
-            assert(m_rightOperand != nullptr);
-
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
         }
-
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    void Layout::parseBindingString(Node& node, const std::string& expression, Widget* widget, bool xAxis)
     {
         if (expression == "x" || expression == "left")
         {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
+            node.operation = Operation::BindingLeft;
+            node.boundWidget = widget;
         }
         else if (expression == "y" || expression == "top")
         {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
+            node.operation = Operation::BindingTop;
+            node.boundWidget = widget;
         }
         else if (expression == "w" || expression == "width")
         {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
+            node.operation = Operation::BindingWidth;
+            node.boundWidget = widget;
         }
         else if (expression == "h" || expression == "height")
         {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
+            node.operation = Operation::BindingHeight;
+            node.boundWidget = widget;
         }
         else if (expression == "iw" || expression == "innerwidth")
         {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
+            node.operation = Operation::BindingInnerWidth;
+            node.boundWidget = widget;
         }
         else if (expression == "ih" || expression == "innerheight")
         {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
+            node.operation = Operation::BindingInnerHeight;
+            node.boundWidget = widget;
         }
         else if (expression == "size")
         {
             if (xAxis)
-                return parseBindingString("width", widget, xAxis);
+                return parseBindingString(node, "width", widget, xAxis);
             else
-                return parseBindingString("height", widget, xAxis);
+                return parseBindingString(node, "height", widget, xAxis);
         }
         else if (expression == "innersize")
         {
             if (xAxis)
-                return parseBindingString("innerwidth", widget, xAxis);
+                return parseBindingString(node, "innerwidth", widget, xAxis);
             else
-                return parseBindingString("innerheight", widget, xAxis);
+                return parseBindingString(node, "innerheight", widget, xAxis);
         }
         else if ((expression == "pos") || (expression == "position"))
         {
             if (xAxis)
-                return parseBindingString("x", widget, xAxis);
+                return parseBindingString(node, "x", widget, xAxis);
             else
-                return parseBindingString("y", widget, xAxis);
+                return parseBindingString(node, "y", widget, xAxis);
         }
         else
         {
@@ -724,7 +830,7 @@ namespace tgui
                 if (widgetName == "parent" || widgetName == "&")
                 {
                     if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                        return parseBindingString(node, expression.substr(dotPos+1), widget->getParent(), xAxis);
                 }
                 else if (!widgetName.empty())
                 {
@@ -737,7 +843,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(node, expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
 
@@ -749,7 +855,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(node, expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
                 }
@@ -758,9 +864,6 @@ namespace tgui
             // The referred widget was not found or there was something wrong with the string
             return;
         }
-
-        resetPointers();
-        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -768,35 +871,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, Layout{}, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, left, right};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -879,8 +982,8 @@ namespace tgui
         Layout bindRight(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+                          Layout{Layout::Operation::BindingLeft, widget.get()},
+                          Layout{Layout::Operation::BindingWidth, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -888,8 +991,8 @@ namespace tgui
         Layout bindBottom(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+                          Layout{Layout::Operation::BindingTop, widget.get()},
+                          Layout{Layout::Operation::BindingHeight, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -931,14 +1034,14 @@ namespace tgui
 
         Layout bindMin(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Minimum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Minimum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         Layout bindMax(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Maximum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Maximum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
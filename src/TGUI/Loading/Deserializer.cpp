@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/ResourcePreloader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 #include <cstdint>
@@ -95,16 +96,21 @@ namespace tgui
             if (filename.isEmpty())
                 return Font{};
 
-            // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
+            // Insert the resource path into the filename unless the filename is an absolute path
 #ifdef SFML_SYSTEM_WINDOWS
             if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
 #else
             if (filename[0] != '/')
 #endif
-                font->loadFromFile(getResourcePath() + filename);
-            else
+                filename = getResourcePath() + filename;
+
+            // Use the font if it was already loaded by a ResourcePreloader, load it now otherwise
+            auto font = ResourcePreloader::takePreloadedFont(filename);
+            if (!font)
+            {
+                font = std::make_shared<sf::Font>();
                 font->loadFromFile(filename);
+            }
 
             // We create the SFML font manually first, as passing the string to the Font constructor would cause
             // an endless recursive call to this function.
@@ -0,0 +1,332 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Loading/ResourcePreloader.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Texture.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::map<sf::String, std::shared_ptr<sf::Font>> ResourcePreloader::m_preloadedFonts;
+    std::mutex ResourcePreloader::m_preloadedFontsMutex;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        bool isAbsolutePath(const sf::String& filename)
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            return (filename[0] == '/') || (filename[0] == '\\') || ((filename.getSize() > 1) && (filename[1] == ':'));
+        #else
+            return (filename[0] == '/');
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Extracts the filename from a serialized texture or font (e.g. '"image.png" Part(0, 0, 10, 10)' returns 'image.png')
+        sf::String extractFilename(const sf::String& value)
+        {
+            if (value[0] != '"')
+            {
+                std::size_t end = 0;
+                while ((end < value.getSize()) && !::isspace(static_cast<unsigned char>(value[end])))
+                    ++end;
+
+                return value.substring(0, end);
+            }
+
+            // Find the closing quote, while skipping escaped characters
+            std::size_t end = 1;
+            while (end < value.getSize())
+            {
+                if (value[end] == '\\')
+                    ++end;
+                else if (value[end] == '"')
+                    break;
+
+                ++end;
+            }
+
+            if (end >= value.getSize())
+                return "";
+
+            return Deserializer::deserialize(ObjectConverter::Type::String, value.substring(0, end + 1)).getString();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ResourcePreloader::~ResourcePreloader()
+    {
+        for (auto& thread : m_threads)
+            thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::addImage(const sf::String& filename)
+    {
+        if (m_started || filename.isEmpty())
+            return;
+
+        const sf::String fullFilename = isAbsolutePath(filename) ? filename : getResourcePath() + filename;
+
+        // Svg images are rasterized when the texture is created, there is nothing to decode in advance
+        if ((fullFilename.getSize() > 4) && (toLower(fullFilename.substring(fullFilename.getSize() - 4, 4)) == ".svg"))
+            return;
+
+        if (m_queuedFilenames.insert({false, fullFilename}).second)
+            m_queue.push_back({fullFilename, false});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::addFont(const sf::String& filename)
+    {
+        if (m_started || filename.isEmpty())
+            return;
+
+        const sf::String fullFilename = isAbsolutePath(filename) ? filename : getResourcePath() + filename;
+        if (m_queuedFilenames.insert({true, fullFilename}).second)
+            m_queue.push_back({fullFilename, true});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::addFromWidgetFile(const std::string& filename)
+    {
+        std::ifstream in{filename};
+        if (!in.is_open())
+            throw Exception{"Failed to open '" + filename + "' to preload its resources."};
+
+        std::stringstream stream;
+        stream << in.rdbuf();
+        addFromNode(DataIO::parse(stream));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::addFromThemeFile(const std::string& filename)
+    {
+        if (filename.empty())
+            return;
+
+        // Textures and fonts in the theme are relative to the directory of the theme file
+        std::string path;
+        const auto slashPos = filename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            path = filename.substr(0, slashPos+1);
+
+        std::ifstream in{isAbsolutePath(filename) ? filename : getResourcePath() + filename};
+        if (!in.is_open())
+            throw Exception{"Failed to open '" + filename + "' to preload its resources."};
+
+        std::stringstream stream;
+        stream << in.rdbuf();
+        addFromNode(DataIO::parse(stream), path);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::addFromNode(const std::unique_ptr<DataIO::Node>& node, const std::string& path)
+    {
+        for (const auto& pair : node->propertyValuePairs)
+        {
+            const sf::String& value = pair.second->value;
+            if (pair.second->listNode || value.isEmpty() || (value[0] == '&'))
+                continue;
+
+            const std::string property = toLower(pair.first);
+            const bool isImage = ((property.size() >= 7) && (property.substr(0, 7) == "texture")) || (property == "image");
+            const bool isFont = (property == "font");
+            if (!isImage && !isFont)
+                continue;
+
+            const std::string lowercaseValue = toLower(value.toAnsiString());
+            if ((lowercaseValue == "none") || (lowercaseValue == "null") || (lowercaseValue == "nullptr"))
+                continue;
+
+            sf::String filename = extractFilename(value);
+            if (filename.isEmpty())
+                continue;
+
+            if (!isAbsolutePath(filename))
+                filename = path + filename;
+
+            if (isImage)
+                addImage(filename);
+            else
+                addFont(filename);
+        }
+
+        for (const auto& child : node->children)
+            addFromNode(child, path);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::start(unsigned int threadCount)
+    {
+        if (m_started)
+            return;
+
+        m_started = true;
+
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        if (threadCount > m_queue.size())
+            threadCount = static_cast<unsigned int>(m_queue.size());
+
+        for (unsigned int i = 0; i < threadCount; ++i)
+            m_threads.emplace_back(&ResourcePreloader::processQueue, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::wait()
+    {
+        if (!m_started)
+        {
+            m_started = true;
+            processQueue();
+        }
+
+        for (auto& thread : m_threads)
+            thread.join();
+
+        m_threads.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ResourcePreloader::isFinished() const
+    {
+        return m_loadedCount == m_queue.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ResourcePreloader::getLoadedCount() const
+    {
+        return m_loadedCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ResourcePreloader::getTotalCount() const
+    {
+        return m_queue.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ResourcePreloader::getProgress() const
+    {
+        if (m_queue.empty())
+            return 1;
+
+        return static_cast<float>(m_loadedCount) / static_cast<float>(m_queue.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> ResourcePreloader::takePreloadedFont(const sf::String& filename)
+    {
+        std::lock_guard<std::mutex> lock{m_preloadedFontsMutex};
+
+        const auto it = m_preloadedFonts.find(filename);
+        if (it == m_preloadedFonts.end())
+            return nullptr;
+
+        auto font = std::move(it->second);
+        m_preloadedFonts.erase(it);
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::removePreloadedFonts()
+    {
+        std::lock_guard<std::mutex> lock{m_preloadedFontsMutex};
+        m_preloadedFonts.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::processQueue()
+    {
+        std::size_t index;
+        while ((index = m_nextIndex++) < m_queue.size())
+        {
+            loadFile(index);
+            ++m_loadedCount;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::loadFile(std::size_t index)
+    {
+        const QueuedFile& file = m_queue[index];
+
+        // A file that fails to load is skipped here, the error will be reported when it is actually used
+        try
+        {
+            if (file.isFont)
+            {
+                auto font = std::make_shared<sf::Font>();
+                if (font->loadFromFile(file.filename))
+                {
+                    std::lock_guard<std::mutex> lock{m_preloadedFontsMutex};
+                    m_preloadedFonts[file.filename] = std::move(font);
+                }
+            }
+            else
+            {
+                auto image = Texture::getImageLoader()(file.filename);
+                if (image)
+                    TextureManager::addPreloadedImage(file.filename, std::move(image));
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,9 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/Context.hpp>
+#include <vector>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -268,7 +271,6 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Theme* Theme::m_defaultTheme = nullptr;
     std::shared_ptr<BaseThemeLoader> Theme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,15 +279,17 @@ namespace tgui
         m_primary(primary)
     {
         if (!primary.empty())
+        {
             m_themeLoader->preload(primary);
+            m_revision = m_themeLoader->reloadIfModified(primary);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Theme::~Theme()
     {
-        if (m_defaultTheme == this)
-            setDefault(nullptr);
+        Context::removeDefaultTheme(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,64 +299,94 @@ namespace tgui
         m_primary = primary;
         m_themeLoader->preload(primary);
 
+        // Remember which revision of the cached data is used, so that reloadIfModified only reloads when the data changed
+        m_revision = m_themeLoader->reloadIfModified(primary);
+
         // Update the existing renderers
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
-
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
-
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            auto oldProperties = std::move(renderer->propertyValuePairs);
+            renderer->propertyValuePairs = m_themeLoader->loadProperties(m_primary, pair.first);
 
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
+            // Find out which properties were changed, both new ones and old ones that are now reset to their default value.
+            // Properties that remain the same keep their old value, so that they don't have to be parsed again.
+            std::vector<std::string> changedProperties;
+            auto oldIt = oldProperties.begin();
             auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            while (oldIt != oldProperties.end() && newIt != renderer->propertyValuePairs.end())
             {
                 if (oldIt->first < newIt->first)
                 {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
-
+                    changedProperties.push_back(oldIt->first);
                     ++oldIt;
                 }
+                else if (newIt->first < oldIt->first)
+                {
+                    changedProperties.push_back(newIt->first);
+                    ++newIt;
+                }
                 else
                 {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
+                    if ((oldIt->second.getType() != ObjectConverter::Type::None) && (newIt->second.getType() != ObjectConverter::Type::None)
+                     && (oldIt->second.getString() == newIt->second.getString()))
                     {
-                        ++oldIt;
-                        ++newIt;
+                        newIt->second = std::move(oldIt->second);
                     }
+                    else
+                        changedProperties.push_back(newIt->first);
+
+                    ++oldIt;
+                    ++newIt;
                 }
             }
-            while (oldIt != oldData->propertyValuePairs.end())
+            for (; oldIt != oldProperties.end(); ++oldIt)
+                changedProperties.push_back(oldIt->first);
+            for (; newIt != renderer->propertyValuePairs.end(); ++newIt)
+                changedProperties.push_back(newIt->first);
+
+            // Only tell the widgets that were using this renderer about the properties that actually changed
+            std::lock_guard<std::recursive_mutex> lock{renderer->observersMutex};
+            for (const auto& property : changedProperties)
             {
                 for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
-
-                ++oldIt;
+                    observer.second(property);
             }
-            while (newIt != renderer->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
+        }
+    }
 
-                ++newIt;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Theme::reloadIfModified()
+    {
+        if (m_primary.empty())
+            return false;
+
+        if (m_themeLoader->reloadIfModified(m_primary) == m_revision)
+            return false;
+
+        load(m_primary);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::prewarmFonts(const std::vector<unsigned int>& characterSizes, TextStyle style)
+    {
+        std::set<const sf::Font*> prewarmedFonts;
+        for (auto& pair : m_renderers)
+        {
+            auto it = pair.second->propertyValuePairs.find("font");
+            if ((it == pair.second->propertyValuePairs.end()) || (it->second.getType() == ObjectConverter::Type::None))
+                continue;
+
+            const Font font = it->second.getFont();
+            if (font && prewarmedFonts.insert(font.getFont().get()).second)
+                font.prewarmGlyphs(characterSizes, style);
         }
     }
 
@@ -368,10 +402,7 @@ namespace tgui
             return it->second;
 
         m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
         return m_renderers[lowercaseSecondary];
     }
 
@@ -391,10 +422,7 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
         return m_renderers[lowercaseSecondary];
     }
 
@@ -444,21 +472,24 @@ namespace tgui
 
     void Theme::setDefault(Theme* theme)
     {
-        m_defaultTheme = theme;
+        Context::getCurrent()->m_defaultTheme = theme;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Theme* Theme::getDefault()
     {
-        if (!m_defaultTheme)
+        Context& context = *Context::getCurrent();
+        if (!context.m_defaultTheme)
         {
-            static DefaultTheme defaultTheme;
-            defaultTheme.reset();
-            m_defaultTheme = &defaultTheme;
+            if (!context.m_builtinTheme)
+                context.m_builtinTheme = std::make_shared<DefaultTheme>();
+
+            static_cast<DefaultTheme&>(*context.m_builtinTheme).reset();
+            context.m_defaultTheme = context.m_builtinTheme.get();
         }
 
-        return m_defaultTheme;
+        return context.m_defaultTheme;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
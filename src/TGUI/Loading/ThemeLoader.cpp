@@ -28,6 +28,7 @@
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Global.hpp>
 
+#include <sys/stat.h>
 #include <cassert>
 #include <sstream>
 #include <fstream>
@@ -53,6 +54,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, std::map<std::string, std::map<std::string, ObjectConverter>>> DefaultThemeLoader::m_parsedPropertiesCache;
+    std::map<std::string, DefaultThemeLoader::CachedFileInfo> DefaultThemeLoader::m_cachedFileInfo;
+    std::recursive_mutex DefaultThemeLoader::m_cacheMutex;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,6 +109,40 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Retrieves the modification time (in nanoseconds) and size of a theme file, returns false when the file can't be found on
+        // disk. The modification time is only accurate to the second on Windows, so the size is compared as well.
+        bool getThemeFileInfo(const std::string& filename, long long& modificationTime, long long& fileSize)
+        {
+            if (filename.empty())
+                return false;
+
+            std::string fullFilename;
+        #ifdef SFML_SYSTEM_WINDOWS
+            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+        #else
+            if (filename[0] != '/')
+        #endif
+                fullFilename = getResourcePath() + filename;
+            else
+                fullFilename = filename;
+
+            struct stat fileStatus;
+            if (stat(fullFilename.c_str(), &fileStatus) != 0)
+                return false;
+
+        #if defined(SFML_SYSTEM_WINDOWS)
+            modificationTime = static_cast<long long>(fileStatus.st_mtime) * 1000000000LL;
+        #elif defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
+            modificationTime = static_cast<long long>(fileStatus.st_mtimespec.tv_sec) * 1000000000LL + fileStatus.st_mtimespec.tv_nsec;
+        #else
+            modificationTime = static_cast<long long>(fileStatus.st_mtim.tv_sec) * 1000000000LL + fileStatus.st_mtim.tv_nsec;
+        #endif
+            fileSize = static_cast<long long>(fileStatus.st_size);
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void resolveReferences(std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections, const std::unique_ptr<DataIO::Node>& node)
         {
             for (const auto& pair : node->propertyValuePairs)
@@ -143,17 +181,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, ObjectConverter> BaseThemeLoader::loadProperties(const std::string& primary, const std::string& secondary)
+    {
+        std::map<std::string, ObjectConverter> properties;
+        for (const auto& property : load(primary, secondary))
+            properties[property.first] = ObjectConverter(property.second);
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BaseThemeLoader::reloadIfModified(const std::string&)
+    {
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
+        std::lock_guard<std::recursive_mutex> lock{m_cacheMutex};
+
         if (filename != "")
         {
             auto propertiesCacheIt = m_propertiesCache.find(filename);
             if (propertiesCacheIt != m_propertiesCache.end())
                 m_propertiesCache.erase(propertiesCacheIt);
+
+            auto parsedPropertiesCacheIt = m_parsedPropertiesCache.find(filename);
+            if (parsedPropertiesCacheIt != m_parsedPropertiesCache.end())
+                m_parsedPropertiesCache.erase(parsedPropertiesCacheIt);
+
+            auto cachedFileInfoIt = m_cachedFileInfo.find(filename);
+            if (cachedFileInfoIt != m_cachedFileInfo.end())
+                m_cachedFileInfo.erase(cachedFileInfoIt);
         }
         else
         {
             m_propertiesCache.clear();
+            m_parsedPropertiesCache.clear();
+            m_cachedFileInfo.clear();
         }
     }
 
@@ -161,6 +229,8 @@ namespace tgui
 
     void DefaultThemeLoader::preload(const std::string& filename)
     {
+        std::lock_guard<std::recursive_mutex> lock{m_cacheMutex};
+
         if (filename == "")
             return;
 
@@ -213,6 +283,10 @@ namespace tgui
                     m_propertiesCache[filename][name][toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
                 }
             }
+
+            // Remember which version of the file was loaded, so that reloadIfModified can detect changes
+            auto& fileInfo = m_cachedFileInfo[filename];
+            getThemeFileInfo(filename, fileInfo.modificationTime, fileInfo.fileSize);
         }
     }
 
@@ -220,6 +294,8 @@ namespace tgui
 
     const std::map<sf::String, sf::String>& DefaultThemeLoader::load(const std::string& filename, const std::string& section)
     {
+        std::lock_guard<std::recursive_mutex> lock{m_cacheMutex};
+
         preload(filename);
 
         const std::string lowercaseClassName = toLower(section);
@@ -236,8 +312,100 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, ObjectConverter> DefaultThemeLoader::loadProperties(const std::string& filename, const std::string& section)
+    {
+        std::lock_guard<std::recursive_mutex> lock{m_cacheMutex};
+
+        const auto& properties = load(filename, section);
+
+        // Create the objects the first time the section is requested, they will parse their value only once when they are used
+        auto& parsedProperties = m_parsedPropertiesCache[filename][toLower(section)];
+        if (parsedProperties.empty())
+        {
+            for (const auto& property : properties)
+            {
+                ObjectConverter value{property.second};
+                value.shareParsedValue();
+                parsedProperties.emplace(property.first, std::move(value));
+            }
+        }
+
+        return parsedProperties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DefaultThemeLoader::reloadIfModified(const std::string& filename)
+    {
+        std::lock_guard<std::recursive_mutex> lock{m_cacheMutex};
+
+        auto fileInfoIt = m_cachedFileInfo.find(filename);
+        if (fileInfoIt == m_cachedFileInfo.end())
+            return 0;
+
+        long long modificationTime;
+        long long fileSize;
+        if (!getThemeFileInfo(filename, modificationTime, fileSize)
+         || ((modificationTime == fileInfoIt->second.modificationTime) && (fileSize == fileInfoIt->second.fileSize)))
+        {
+            return fileInfoIt->second.revision;
+        }
+
+        auto oldProperties = std::move(m_propertiesCache[filename]);
+        auto oldParsedProperties = std::move(m_parsedPropertiesCache[filename]);
+        m_propertiesCache.erase(filename);
+        m_parsedPropertiesCache.erase(filename);
+
+        try
+        {
+            preload(filename);
+        }
+        catch (const Exception&)
+        {
+            // Keep using the old contents. The file won't be parsed again until it gets modified again.
+            m_propertiesCache[filename] = std::move(oldProperties);
+            m_parsedPropertiesCache[filename] = std::move(oldParsedProperties);
+            fileInfoIt->second.modificationTime = modificationTime;
+            fileInfoIt->second.fileSize = fileSize;
+            throw;
+        }
+
+        // Properties that didn't change can keep their already parsed value
+        for (const auto& section : m_propertiesCache[filename])
+        {
+            const auto oldParsedSectionIt = oldParsedProperties.find(section.first);
+            if (oldParsedSectionIt == oldParsedProperties.end())
+                continue;
+
+            const auto& oldSection = oldProperties[section.first];
+            auto& parsedSection = m_parsedPropertiesCache[filename][section.first];
+            for (const auto& property : section.second)
+            {
+                const auto oldPropertyIt = oldSection.find(property.first);
+                const auto oldParsedPropertyIt = oldParsedSectionIt->second.find(property.first);
+                if ((oldPropertyIt != oldSection.end()) && (oldPropertyIt->second == property.second)
+                 && (oldParsedPropertyIt != oldParsedSectionIt->second.end()))
+                {
+                    parsedSection.emplace(property.first, oldParsedPropertyIt->second);
+                }
+                else
+                {
+                    ObjectConverter value{property.second};
+                    value.shareParsedValue();
+                    parsedSection.emplace(property.first, std::move(value));
+                }
+            }
+        }
+
+        return ++fileInfoIt->second.revision;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool DefaultThemeLoader::canLoad(const std::string& filename, const std::string& section)
     {
+        std::lock_guard<std::recursive_mutex> lock{m_cacheMutex};
+
         if (filename.empty())
             return true;
         else
@@ -100,16 +100,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::mutex WidgetFactory::m_constructFunctionsMutex;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetFactory::setConstructFunction(const std::string& type, const std::function<Widget::Ptr()>& constructor)
     {
+        std::lock_guard<std::mutex> lock{m_constructFunctionsMutex};
         m_constructFunctions[toLower(type)] = constructor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::function<Widget::Ptr()>& WidgetFactory::getConstructFunction(const std::string& type)
+    std::function<Widget::Ptr()> WidgetFactory::getConstructFunction(const std::string& type)
     {
-        return m_constructFunctions[toLower(type)];
+        std::lock_guard<std::mutex> lock{m_constructFunctionsMutex};
+
+        const auto it = m_constructFunctions.find(toLower(type));
+        if (it != m_constructFunctions.end())
+            return it->second;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,390 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/MappedTextFile.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#ifdef SFML_SYSTEM_WINDOWS
+    #ifndef NOMINMAX // MinGW already defines this which causes a warning without this check
+        #define NOMINMAX
+    #endif
+    #define NOMB
+    #define VC_EXTRALEAN
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Only the offset of every n-th line is stored, the lines in between are found by scanning from there
+        const std::size_t LinesPerCheckpoint = 256;
+
+        // Amount of bytes that the indexing thread scans before publishing the lines it found
+        const std::size_t IndexingChunkSize = 4 * 1024 * 1024;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MappedTextFile::~MappedTextFile()
+    {
+        close();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedTextFile::open(const std::string& filename)
+    {
+        close();
+
+        std::string fullFilename = filename;
+#ifdef SFML_SYSTEM_WINDOWS
+        if (!filename.empty() && (filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+#else
+        if (!filename.empty() && (filename[0] != '/'))
+#endif
+            fullFilename = getResourcePath() + filename;
+
+#ifdef SFML_SYSTEM_WINDOWS
+        HANDLE file = CreateFileW(sf::String(fullFilename).toWideString().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw Exception{"Failed to open '" + fullFilename + "'"};
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || (static_cast<unsigned long long>(fileSize.QuadPart) > std::numeric_limits<std::size_t>::max()))
+        {
+            CloseHandle(file);
+            throw Exception{"Failed to open '" + fullFilename + "'"};
+        }
+
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+        if (m_size > 0)
+        {
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            const void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (!data)
+            {
+                if (mapping)
+                    CloseHandle(mapping);
+                CloseHandle(file);
+                m_size = 0;
+                throw Exception{"Failed to map '" + fullFilename + "' in memory"};
+            }
+
+            m_mappingHandle = mapping;
+            m_data = static_cast<const char*>(data);
+        }
+
+        m_fileHandle = file;
+#else
+        const int file = ::open(fullFilename.c_str(), O_RDONLY);
+        if (file < 0)
+            throw Exception{"Failed to open '" + fullFilename + "'"};
+
+        struct stat fileInfo;
+        if ((fstat(file, &fileInfo) != 0) || !S_ISREG(fileInfo.st_mode))
+        {
+            ::close(file);
+            throw Exception{"Failed to open '" + fullFilename + "'"};
+        }
+
+        m_size = static_cast<std::size_t>(fileInfo.st_size);
+        if (m_size > 0)
+        {
+            void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(file);
+                m_size = 0;
+                throw Exception{"Failed to map '" + fullFilename + "' in memory"};
+            }
+
+            m_data = static_cast<const char*>(data);
+        }
+
+        m_fileDescriptor = file;
+#endif
+
+        m_open = true;
+        m_checkpoints = {0};
+        m_lineCount = 0;
+        m_stopIndexing = false;
+
+        if (m_size > 0)
+        {
+            m_indexingFinished = false;
+            m_indexingThread = std::thread(&MappedTextFile::buildIndex, this);
+        }
+        else // An empty file consists of a single empty line
+        {
+            m_lineCount = 1;
+            m_indexingFinished = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedTextFile::close()
+    {
+        if (m_indexingThread.joinable())
+        {
+            m_stopIndexing = true;
+            m_indexingThread.join();
+        }
+
+#ifdef SFML_SYSTEM_WINDOWS
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mappingHandle)
+            CloseHandle(m_mappingHandle);
+        if (m_fileHandle)
+            CloseHandle(m_fileHandle);
+
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+#else
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+        if (m_fileDescriptor >= 0)
+            ::close(m_fileDescriptor);
+
+        m_fileDescriptor = -1;
+#endif
+
+        m_data = nullptr;
+        m_size = 0;
+        m_open = false;
+
+        {
+            std::lock_guard<std::mutex> lock(m_checkpointsMutex);
+            m_checkpoints.clear();
+            m_lineCount = 0;
+            m_indexingFinished = true;
+        }
+
+        m_indexingFinishedCondition.notify_all();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedTextFile::isOpen() const
+    {
+        return m_open;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::getFileSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedTextFile::isIndexingFinished() const
+    {
+        return m_indexingFinished;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedTextFile::waitForIndexing()
+    {
+        std::unique_lock<std::mutex> lock(m_checkpointsMutex);
+        m_indexingFinishedCondition.wait(lock, [this]{ return m_indexingFinished.load(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::getLineCount() const
+    {
+        return m_lineCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String MappedTextFile::getLine(std::size_t lineIndex) const
+    {
+        const auto lines = getLines(lineIndex, 1);
+        if (lines.empty())
+            return "";
+        else
+            return lines[0];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<sf::String> MappedTextFile::getLines(std::size_t firstLine, std::size_t count) const
+    {
+        const std::size_t lineCount = m_lineCount;
+        if (firstLine >= lineCount)
+            return {};
+
+        count = std::min(count, lineCount - firstLine);
+
+        std::vector<sf::String> lines;
+        lines.reserve(count);
+
+        const std::size_t readableSize = getReadableSize();
+        std::size_t lineStart = findLineStart(firstLine, readableSize);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // The line no longer exists when the file was truncated
+            if (lineStart > readableSize)
+                break;
+
+            const std::size_t lineEnd = findLineEnd(lineStart, readableSize);
+
+            // Windows line endings are shown the same way as a normal newline
+            std::size_t contentEnd = lineEnd;
+            if ((contentEnd > lineStart) && (m_data[contentEnd - 1] == '\r'))
+                --contentEnd;
+
+            lines.push_back(sf::String::fromUtf8(m_data + lineStart, m_data + contentEnd));
+            lineStart = lineEnd + 1;
+        }
+
+        return lines;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::getReadableSize() const
+    {
+#ifdef SFML_SYSTEM_WINDOWS
+        // Windows doesn't allow truncating a file while it is mapped
+        return m_size;
+#else
+        struct stat fileInfo;
+        if (fstat(m_fileDescriptor, &fileInfo) != 0)
+            return 0;
+
+        return std::min(m_size, static_cast<std::size_t>(std::max<off_t>(fileInfo.st_size, 0)));
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::findLineStart(std::size_t lineIndex, std::size_t readableSize) const
+    {
+        std::size_t offset;
+        {
+            std::lock_guard<std::mutex> lock(m_checkpointsMutex);
+            offset = m_checkpoints[lineIndex / LinesPerCheckpoint];
+        }
+
+        for (std::size_t i = 0; (i < lineIndex % LinesPerCheckpoint) && (offset <= readableSize); ++i)
+            offset = findLineEnd(offset, readableSize) + 1;
+
+        return offset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::findLineEnd(std::size_t lineStart, std::size_t readableSize) const
+    {
+        if (lineStart >= readableSize)
+            return readableSize;
+
+        const void* newline = std::memchr(m_data + lineStart, '\n', readableSize - lineStart);
+        if (newline)
+            return static_cast<std::size_t>(static_cast<const char*>(newline) - m_data);
+        else
+            return readableSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedTextFile::buildIndex()
+    {
+        std::size_t lineCount = 0;
+        std::size_t offset = 0;
+        std::vector<std::size_t> newCheckpoints;
+        std::size_t readableSize = m_size;
+        while (offset < readableSize)
+        {
+            if (m_stopIndexing)
+                return;
+
+            // Stop at the new end of the file when it was truncated
+            readableSize = getReadableSize();
+            if (offset >= readableSize)
+                break;
+
+            const std::size_t chunkEnd = std::min(offset + IndexingChunkSize, readableSize);
+            while (offset < chunkEnd)
+            {
+                const void* newline = std::memchr(m_data + offset, '\n', chunkEnd - offset);
+                if (!newline)
+                {
+                    offset = chunkEnd;
+                    break;
+                }
+
+                offset = static_cast<std::size_t>(static_cast<const char*>(newline) - m_data) + 1;
+                ++lineCount;
+
+                if (lineCount % LinesPerCheckpoint == 0)
+                    newCheckpoints.push_back(offset);
+            }
+
+            // The checkpoints have to be available before the lines are counted, as getLines may access them immediately
+            {
+                std::lock_guard<std::mutex> lock(m_checkpointsMutex);
+                m_checkpoints.insert(m_checkpoints.end(), newCheckpoints.begin(), newCheckpoints.end());
+            }
+
+            newCheckpoints.clear();
+            m_lineCount = lineCount;
+        }
+
+        // The last line doesn't end with a newline
+        {
+            std::lock_guard<std::mutex> lock(m_checkpointsMutex);
+            m_lineCount = lineCount + 1;
+            m_indexingFinished = true;
+        }
+
+        m_indexingFinishedCondition.notify_all();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,12 +26,22 @@
 #include <TGUI/ObjectConverter.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/Context.hpp>
 #include <cassert>
+#include <mutex>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    struct ObjectConverter::ParsedValueCache
+    {
+        std::mutex mutex;
+        std::vector<std::pair<std::uint64_t, ObjectConverter>> values; // Parsed value for each context id
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& ObjectConverter::getString()
@@ -53,10 +63,11 @@ namespace tgui
         assert(m_type != Type::None);
         assert(m_type == Type::Font || m_type == Type::String);
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadParsedValue(Type::Font))
         {
             m_value = Font(m_string);
             m_type = Type::Font;
+            storeParsedValue();
         }
 
 #ifdef TGUI_USE_CPP17
@@ -73,10 +84,11 @@ namespace tgui
         assert(m_type != Type::None);
         assert(m_type == Type::Color || m_type == Type::String);
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadParsedValue(Type::Color))
         {
             m_value = Color(m_string);
             m_type = Type::Color;
+            storeParsedValue();
         }
 
 #ifdef TGUI_USE_CPP17
@@ -93,10 +105,11 @@ namespace tgui
         assert(m_type != Type::None);
         assert(m_type == Type::Bool || m_type == Type::String);
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadParsedValue(Type::Bool))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Bool, m_string).getBool();
             m_type = Type::Bool;
+            storeParsedValue();
         }
 
 #ifdef TGUI_USE_CPP17
@@ -113,10 +126,11 @@ namespace tgui
         assert(m_type != Type::None);
         assert(m_type == Type::Number || m_type == Type::String);
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadParsedValue(Type::Number))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Number, m_string).getNumber();
             m_type = Type::Number;
+            storeParsedValue();
         }
 
 #ifdef TGUI_USE_CPP17
@@ -133,10 +147,11 @@ namespace tgui
         assert(m_type != Type::None);
         assert(m_type == Type::Outline || m_type == Type::String);
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadParsedValue(Type::Outline))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Outline, m_string).getOutline();
             m_type = Type::Outline;
+            storeParsedValue();
         }
 
 #ifdef TGUI_USE_CPP17
@@ -153,10 +168,11 @@ namespace tgui
         assert(m_type != Type::None);
         assert(m_type == Type::Texture || m_type == Type::String);
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadParsedValue(Type::Texture))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Texture, m_string).getTexture();
             m_type = Type::Texture;
+            storeParsedValue();
         }
 
 #ifdef TGUI_USE_CPP17
@@ -173,10 +189,11 @@ namespace tgui
         assert(m_type != Type::None);
         assert(m_type == Type::TextStyle || m_type == Type::String);
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadParsedValue(Type::TextStyle))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::TextStyle, m_string).getTextStyle();
             m_type = Type::TextStyle;
+            storeParsedValue();
         }
 
 #ifdef TGUI_USE_CPP17
@@ -195,8 +212,28 @@ namespace tgui
 
         if (m_type == Type::String)
         {
-            m_value = Deserializer::deserialize(ObjectConverter::Type::RendererData, m_string).getRenderer();
-            m_type = Type::RendererData;
+            if (loadParsedValue(Type::RendererData))
+            {
+                // Every user gets its own copy of the renderer data, but the properties inside it won't have to be parsed again.
+                // The cached renderer data itself is never modified, so it can be copied without holding the lock.
+                m_value = RendererData::create(getRenderer()->propertyValuePairs);
+            }
+            else
+            {
+                auto rendererData = Deserializer::deserialize(ObjectConverter::Type::RendererData, m_string).getRenderer();
+                if (m_parsedValues)
+                {
+                    for (auto& pair : rendererData->propertyValuePairs)
+                        pair.second.shareParsedValue();
+
+                    m_value = RendererData::create(rendererData->propertyValuePairs);
+                    m_type = Type::RendererData;
+                    storeParsedValue();
+                }
+
+                m_value = std::move(rendererData);
+                m_type = Type::RendererData;
+            }
         }
 
 #ifdef TGUI_USE_CPP17
@@ -277,6 +314,64 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::shareParsedValue()
+    {
+        if ((m_type == Type::String) && !m_parsedValues)
+            m_parsedValues = std::make_shared<ParsedValueCache>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ObjectConverter::loadParsedValue(Type type)
+    {
+        if (!m_parsedValues)
+            return false;
+
+        const std::uint64_t contextId = Context::getCurrent()->getId();
+
+        std::lock_guard<std::mutex> lock{m_parsedValues->mutex};
+        for (const auto& pair : m_parsedValues->values)
+        {
+            if (pair.first != contextId)
+                continue;
+
+            if (pair.second.m_type != type)
+                return false;
+
+            m_value = pair.second.m_value;
+            m_type = type;
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::storeParsedValue()
+    {
+        if (!m_parsedValues)
+            return;
+
+        const std::uint64_t contextId = Context::getCurrent()->getId();
+
+        std::lock_guard<std::mutex> lock{m_parsedValues->mutex};
+        for (const auto& pair : m_parsedValues->values)
+        {
+            // Only the first parsed value is kept, other threads may already be using it
+            if (pair.first == contextId)
+                return;
+        }
+
+        // The cached object doesn't get the shared pointer, otherwise the cache would keep itself alive
+        ObjectConverter parsedValue;
+        parsedValue.m_value = m_value;
+        parsedValue.m_type = m_type;
+        m_parsedValues->values.emplace_back(contextId, std::move(parsedValue));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
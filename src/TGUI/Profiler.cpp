@@ -0,0 +1,254 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Exception.hpp>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        using ProfilerClock = std::chrono::steady_clock;
+
+        struct TraceEvent
+        {
+            std::string name;
+            Profiler::Category category;
+            long long startTime;
+            long long duration;
+            unsigned int threadId;
+        };
+
+        const unsigned int profilerCategoryCount = 7;
+
+        std::atomic<bool> profilerEnabled{true};
+        std::atomic<bool> profilerTracing{false};
+
+        // Guis on different threads are measured separately, each thread collects the statistics of its own frames
+        thread_local FrameStats currentFrameStats;
+        thread_local unsigned int categoryDepth[profilerCategoryCount] = {};
+        thread_local ProfilerClock::time_point lastFrameEndTime = ProfilerClock::now();
+
+        // The trace contains the scopes of all threads
+        std::mutex traceMutex;
+        ProfilerClock::time_point traceStartTime;
+        std::vector<TraceEvent> traceEvents;
+
+        std::atomic<unsigned int> lastTraceThreadId{0};
+        thread_local const unsigned int traceThreadId = ++lastTraceThreadId;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const char* getCategoryName(Profiler::Category category)
+        {
+            switch (category)
+            {
+                case Profiler::Category::Draw:            return "Draw";
+                case Profiler::Category::WidgetDraw:      return "WidgetDraw";
+                case Profiler::Category::Event:           return "Event";
+                case Profiler::Category::Update:          return "Update";
+                case Profiler::Category::Layout:          return "Layout";
+                case Profiler::Category::RendererChanged: return "RendererChanged";
+                case Profiler::Category::Signal:          return "Signal";
+            };
+
+            return "";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string escapeJsonString(const std::string& str)
+        {
+            std::string result;
+            for (const char c : str)
+            {
+                if ((c == '"') || (c == '\\'))
+                    result.push_back('\\');
+
+                if (static_cast<unsigned char>(c) >= 0x20)
+                    result.push_back(c);
+            }
+
+            return result;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::Scope(Category category, const char* name) :
+        m_category{category},
+        m_active  {profilerEnabled}
+    {
+        if (!m_active)
+            return;
+
+        // The name is copied, because the object that owns it could be destroyed before the scope ends
+        if (profilerTracing)
+            m_name = name;
+
+        ++categoryDepth[static_cast<unsigned int>(category)];
+        if (category == Category::WidgetDraw)
+            ++currentFrameStats.widgetsDrawn;
+
+        m_startTime = ProfilerClock::now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::~Scope()
+    {
+        if (!m_active)
+            return;
+
+        const auto endTime = ProfilerClock::now();
+
+        // Nested scopes of the same category are already included in the time of the outer scope
+        if (--categoryDepth[static_cast<unsigned int>(m_category)] == 0)
+        {
+            const float duration = std::chrono::duration<float, std::milli>(endTime - m_startTime).count();
+            switch (m_category)
+            {
+                case Category::Draw:            currentFrameStats.drawTime += duration; break;
+                case Category::Event:           currentFrameStats.eventTime += duration; break;
+                case Category::Update:          currentFrameStats.updateTime += duration; break;
+                case Category::Layout:          currentFrameStats.layoutTime += duration; break;
+                case Category::RendererChanged: currentFrameStats.rendererChangedTime += duration; break;
+                case Category::Signal:          currentFrameStats.signalTime += duration; break;
+                case Category::WidgetDraw:      break; // Already included in the draw time
+            };
+        }
+
+        if (profilerTracing)
+        {
+            std::lock_guard<std::mutex> lock{traceMutex};
+            traceEvents.push_back({std::move(m_name), m_category,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(m_startTime - traceStartTime).count(),
+                                   std::chrono::duration_cast<std::chrono::microseconds>(endTime - m_startTime).count(),
+                                   traceThreadId});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        profilerEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isEnabled()
+    {
+        return profilerEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::count(Counter counter)
+    {
+        if (!profilerEnabled)
+            return;
+
+        switch (counter)
+        {
+            case Counter::DrawCalls:      ++currentFrameStats.drawCalls; break;
+            case Counter::TextureBinds:   ++currentFrameStats.textureBinds; break;
+            case Counter::ClippingPushes: ++currentFrameStats.clippingPushes; break;
+            case Counter::TextLayouts:    ++currentFrameStats.textLayouts; break;
+            case Counter::Events:         ++currentFrameStats.events; break;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FrameStats Profiler::finishFrame()
+    {
+        const auto now = ProfilerClock::now();
+
+        FrameStats stats = currentFrameStats;
+        stats.frameTime = std::chrono::duration<float, std::milli>(now - lastFrameEndTime).count();
+
+        currentFrameStats = FrameStats{};
+        lastFrameEndTime = now;
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::startTrace()
+    {
+        std::lock_guard<std::mutex> lock{traceMutex};
+        traceEvents.clear();
+        traceStartTime = ProfilerClock::now();
+        profilerTracing = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::stopTrace()
+    {
+        profilerTracing = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isTracing()
+    {
+        return profilerTracing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::saveTrace(const std::string& filename)
+    {
+        std::ofstream out{filename};
+        if (!out.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the trace to it."};
+
+        std::lock_guard<std::mutex> lock{traceMutex};
+        out << "{\"traceEvents\":[\n";
+        for (std::size_t i = 0; i < traceEvents.size(); ++i)
+        {
+            const auto& event = traceEvents[i];
+            out << "{\"name\":\"" << escapeJsonString(event.name) << "\",\"cat\":\"" << getCategoryName(event.category)
+                << "\",\"ph\":\"X\",\"ts\":" << event.startTime << ",\"dur\":" << event.duration << ",\"pid\":1,\"tid\":" << event.threadId << "}"
+                << ((i + 1 < traceEvents.size()) ? ",\n" : "\n");
+        }
+        out << "],\"displayTimeUnit\":\"ms\"}\n";
+
+        traceEvents.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
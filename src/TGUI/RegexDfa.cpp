@@ -0,0 +1,938 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RegexDfa.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <algorithm>
+#include <limits>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const std::uint32_t MaxCodePoint = 0x10FFFF;
+        const unsigned int InfiniteRepetitions = std::numeric_limits<unsigned int>::max();
+
+        // Limits that prevent pathological patterns from using huge amounts of memory. Patterns that exceed them are rejected,
+        // in which case the EditBox falls back to std::regex.
+        const unsigned int MaxRepetitions = 1000;
+        const std::size_t MaxNfaStates = 10000;
+        const std::size_t MaxDfaStates = 2000;
+
+        // Tables for the predefined validators, all sharing the same character classes:
+        //   0: other, 1: '+', 2: ',', 3: '-', 4: '.', 5: '/', 6: '0'-'9', 7: other
+        const std::uint32_t NumberClassBoundaries[] = {0, '+', ',', '-', '.', '/', '0', ':'};
+
+        // [0-9]*
+        const unsigned int UIntTransitions[] = {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 1, 0
+        };
+        const bool UIntAccepting[] = {false, true};
+
+        // [+-]?[0-9]*
+        const unsigned int IntTransitions[] = {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 2, 0, 2, 0, 0, 2, 0,
+            0, 0, 0, 0, 0, 0, 2, 0
+        };
+        const bool IntAccepting[] = {false, true, true};
+
+        // [+-]?[0-9]*\.?[0-9]*
+        const unsigned int FloatTransitions[] = {
+            0, 0, 0, 0, 0, 0, 0, 0,
+            0, 2, 0, 2, 3, 0, 2, 0,
+            0, 0, 0, 0, 3, 0, 2, 0,
+            0, 0, 0, 0, 0, 0, 3, 0
+        };
+        const bool FloatAccepting[] = {false, true, true, true};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <typename T, std::size_t N>
+        std::vector<T> toVector(const T (&values)[N])
+        {
+            return std::vector<T>(values, values + N);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct CodePointRange
+        {
+            std::uint32_t first;
+            std::uint32_t last;
+        };
+
+        using CodePointSet = std::vector<CodePointRange>;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        CodePointSet normalizeSet(CodePointSet set)
+        {
+            std::sort(set.begin(), set.end(), [](const CodePointRange& left, const CodePointRange& right){ return left.first < right.first; });
+
+            CodePointSet result;
+            for (const auto& range : set)
+            {
+                if (!result.empty() && (range.first <= result.back().last + 1))
+                    result.back().last = std::max(result.back().last, range.last);
+                else
+                    result.push_back(range);
+            }
+
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        CodePointSet complementSet(const CodePointSet& set)
+        {
+            CodePointSet result;
+            std::uint32_t next = 0;
+            for (const auto& range : normalizeSet(set))
+            {
+                if (range.first > next)
+                    result.push_back({next, range.first - 1});
+
+                if (range.last >= MaxCodePoint)
+                    return result;
+
+                next = range.last + 1;
+            }
+
+            result.push_back({next, MaxCodePoint});
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct RegexNode
+        {
+            enum class Type
+            {
+                Set,
+                Concatenation,
+                Alternation,
+                Repetition
+            };
+
+            Type type = Type::Concatenation;
+            CodePointSet set;
+            std::vector<std::unique_ptr<RegexNode>> children;
+            unsigned int minRepetitions = 0;
+            unsigned int maxRepetitions = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<RegexNode> makeRegexNode(RegexNode::Type type)
+        {
+            auto node = std::make_unique<RegexNode>();
+            node->type = type;
+            return node;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Recursive descent parser for the supported subset of the ECMAScript grammar. Every parse function returns nullptr
+        // when the pattern is invalid or uses a feature that can't be represented in a DFA.
+        class RegexParser
+        {
+        public:
+
+            explicit RegexParser(const sf::String& pattern) :
+                m_pattern(pattern)
+            {
+            }
+
+            std::unique_ptr<RegexNode> parse()
+            {
+                auto node = parseAlternation();
+                if (!node || !atEnd())
+                    return nullptr;
+
+                return node;
+            }
+
+        private:
+
+            bool atEnd() const
+            {
+                return m_pos >= m_pattern.getSize();
+            }
+
+            std::uint32_t peek() const
+            {
+                return m_pattern[m_pos];
+            }
+
+            std::unique_ptr<RegexNode> parseAlternation()
+            {
+                auto node = parseConcatenation();
+                if (!node || atEnd() || (peek() != '|'))
+                    return node;
+
+                auto alternation = makeRegexNode(RegexNode::Type::Alternation);
+                alternation->children.push_back(std::move(node));
+                while (!atEnd() && (peek() == '|'))
+                {
+                    ++m_pos;
+                    node = parseConcatenation();
+                    if (!node)
+                        return nullptr;
+
+                    alternation->children.push_back(std::move(node));
+                }
+
+                return alternation;
+            }
+
+            std::unique_ptr<RegexNode> parseConcatenation()
+            {
+                auto concatenation = makeRegexNode(RegexNode::Type::Concatenation);
+                while (!atEnd() && (peek() != '|') && (peek() != ')'))
+                {
+                    auto node = parseQuantifiedAtom();
+                    if (!node)
+                        return nullptr;
+
+                    concatenation->children.push_back(std::move(node));
+                }
+
+                return concatenation;
+            }
+
+            std::unique_ptr<RegexNode> parseQuantifiedAtom()
+            {
+                auto atom = parseAtom();
+                if (!atom || atEnd())
+                    return atom;
+
+                unsigned int minRepetitions;
+                unsigned int maxRepetitions;
+                if (peek() == '*')
+                {
+                    minRepetitions = 0;
+                    maxRepetitions = InfiniteRepetitions;
+                    ++m_pos;
+                }
+                else if (peek() == '+')
+                {
+                    minRepetitions = 1;
+                    maxRepetitions = InfiniteRepetitions;
+                    ++m_pos;
+                }
+                else if (peek() == '?')
+                {
+                    minRepetitions = 0;
+                    maxRepetitions = 1;
+                    ++m_pos;
+                }
+                else if (peek() == '{')
+                {
+                    ++m_pos;
+                    if (!parseNumber(minRepetitions))
+                        return nullptr;
+
+                    maxRepetitions = minRepetitions;
+                    if (!atEnd() && (peek() == ','))
+                    {
+                        ++m_pos;
+                        if (!atEnd() && (peek() == '}'))
+                            maxRepetitions = InfiniteRepetitions;
+                        else if (!parseNumber(maxRepetitions) || (maxRepetitions < minRepetitions))
+                            return nullptr;
+                    }
+
+                    if (atEnd() || (peek() != '}'))
+                        return nullptr;
+
+                    ++m_pos;
+                }
+                else
+                    return atom;
+
+                // Whether the quantifier is greedy or lazy makes no difference when the entire text has to match
+                if (!atEnd() && (peek() == '?'))
+                    ++m_pos;
+
+                // A quantifier can't be quantified again
+                if (!atEnd() && ((peek() == '*') || (peek() == '+') || (peek() == '?') || (peek() == '{')))
+                    return nullptr;
+
+                auto repetition = makeRegexNode(RegexNode::Type::Repetition);
+                repetition->minRepetitions = minRepetitions;
+                repetition->maxRepetitions = maxRepetitions;
+                repetition->children.push_back(std::move(atom));
+                return repetition;
+            }
+
+            bool parseNumber(unsigned int& number)
+            {
+                if (atEnd() || (peek() < '0') || (peek() > '9'))
+                    return false;
+
+                number = 0;
+                while (!atEnd() && (peek() >= '0') && (peek() <= '9'))
+                {
+                    number = number * 10 + (peek() - '0');
+                    if (number > MaxRepetitions)
+                        return false;
+
+                    ++m_pos;
+                }
+
+                return true;
+            }
+
+            std::unique_ptr<RegexNode> parseAtom()
+            {
+                const std::uint32_t c = peek();
+                ++m_pos;
+
+                if (c == '(')
+                {
+                    // Only non-capturing groups are supported from all groups with special syntax, lookaheads aren't
+                    if (!atEnd() && (peek() == '?'))
+                    {
+                        if ((m_pos + 1 >= m_pattern.getSize()) || (m_pattern[m_pos + 1] != ':'))
+                            return nullptr;
+
+                        m_pos += 2;
+                    }
+
+                    auto node = parseAlternation();
+                    if (!node || atEnd() || (peek() != ')'))
+                        return nullptr;
+
+                    ++m_pos;
+                    return node;
+                }
+
+                auto node = makeRegexNode(RegexNode::Type::Set);
+                if (c == '.')
+                    node->set = complementSet({{'\n', '\n'}, {'\r', '\r'}, {0x2028, 0x2029}});
+                else if (c == '[')
+                {
+                    if (!parseBracketExpression(node->set))
+                        return nullptr;
+                }
+                else if (c == '\\')
+                {
+                    if (!parseEscape(node->set, false))
+                        return nullptr;
+                }
+                else if ((c == '^') || (c == '$') || (c == '*') || (c == '+') || (c == '?')
+                      || (c == '{') || (c == '}') || (c == ']') || (c == ')'))
+                {
+                    // Anchors aren't supported and the other characters can't be used unescaped
+                    return nullptr;
+                }
+                else
+                    node->set.push_back({c, c});
+
+                return node;
+            }
+
+            bool parseBracketExpression(CodePointSet& set)
+            {
+                bool negated = false;
+                if (!atEnd() && (peek() == '^'))
+                {
+                    negated = true;
+                    ++m_pos;
+                }
+
+                // Empty bracket expressions are treated differently by regex implementations
+                if (atEnd() || (peek() == ']'))
+                    return false;
+
+                CodePointSet members;
+                while (!atEnd() && (peek() != ']'))
+                {
+                    CodePointSet first;
+                    if (!parseBracketElement(first))
+                        return false;
+
+                    if ((m_pos + 1 < m_pattern.getSize()) && (peek() == '-') && (m_pattern[m_pos + 1] != ']'))
+                    {
+                        ++m_pos;
+
+                        CodePointSet last;
+                        if (!parseBracketElement(last))
+                            return false;
+
+                        // Both ends of a range have to be single characters
+                        if ((first.size() != 1) || (first[0].first != first[0].last)
+                         || (last.size() != 1) || (last[0].first != last[0].last)
+                         || (first[0].first > last[0].first))
+                            return false;
+
+                        members.push_back({first[0].first, last[0].first});
+                    }
+                    else
+                        members.insert(members.end(), first.begin(), first.end());
+                }
+
+                if (atEnd())
+                    return false;
+
+                ++m_pos;
+                set = negated ? complementSet(members) : normalizeSet(members);
+                return true;
+            }
+
+            bool parseBracketElement(CodePointSet& set)
+            {
+                const std::uint32_t c = peek();
+                ++m_pos;
+
+                if (c == '\\')
+                    return parseEscape(set, true);
+
+                // Character classes like [:alpha:] and collating elements are not supported
+                if ((c == '[') && !atEnd() && ((peek() == ':') || (peek() == '.') || (peek() == '=')))
+                    return false;
+
+                set.push_back({c, c});
+                return true;
+            }
+
+            bool parseEscape(CodePointSet& set, bool insideBrackets)
+            {
+                if (atEnd())
+                    return false;
+
+                const CodePointSet digits = {{'0', '9'}};
+                const CodePointSet wordCharacters = {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+                const CodePointSet whitespace = {{'\t', '\r'}, {' ', ' '}};
+
+                const std::uint32_t c = peek();
+                ++m_pos;
+                switch (c)
+                {
+                    case 'd': set = digits; return true;
+                    case 'D': set = complementSet(digits); return true;
+                    case 'w': set = wordCharacters; return true;
+                    case 'W': set = complementSet(wordCharacters); return true;
+                    case 's': set = whitespace; return true;
+                    case 'S': set = complementSet(whitespace); return true;
+                    case 't': set = {{'\t', '\t'}}; return true;
+                    case 'n': set = {{'\n', '\n'}}; return true;
+                    case 'v': set = {{'\v', '\v'}}; return true;
+                    case 'f': set = {{'\f', '\f'}}; return true;
+                    case 'r': set = {{'\r', '\r'}}; return true;
+                    case 'x': return parseHexEscape(set, 2);
+                    case 'u': return parseHexEscape(set, 4);
+                    case 'b':
+                    {
+                        // Inside brackets this is a backspace, outside brackets it is a word boundary assertion
+                        if (!insideBrackets)
+                            return false;
+
+                        set = {{'\b', '\b'}};
+                        return true;
+                    }
+                    case '0':
+                    {
+                        // Octal escapes and backreferences aren't supported
+                        if (!atEnd() && (peek() >= '0') && (peek() <= '9'))
+                            return false;
+
+                        set = {{0, 0}};
+                        return true;
+                    }
+                    default:
+                    {
+                        // Backreferences, assertions and unknown escapes are rejected, other characters are escaped literally
+                        if (((c >= '0') && (c <= '9')) || ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')))
+                            return false;
+
+                        set = {{c, c}};
+                        return true;
+                    }
+                }
+            }
+
+            bool parseHexEscape(CodePointSet& set, unsigned int digitCount)
+            {
+                std::uint32_t value = 0;
+                for (unsigned int i = 0; i < digitCount; ++i)
+                {
+                    if (atEnd())
+                        return false;
+
+                    const std::uint32_t c = peek();
+                    if ((c >= '0') && (c <= '9'))
+                        value = value * 16 + (c - '0');
+                    else if ((c >= 'a') && (c <= 'f'))
+                        value = value * 16 + (c - 'a' + 10);
+                    else if ((c >= 'A') && (c <= 'F'))
+                        value = value * 16 + (c - 'A' + 10);
+                    else
+                        return false;
+
+                    ++m_pos;
+                }
+
+                set = {{value, value}};
+                return true;
+            }
+
+        private:
+
+            const sf::String& m_pattern;
+            std::size_t m_pos = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Thompson construction of a nondeterministic automaton. Each state has epsilon transitions and at most one transition
+        // that consumes a character from a set.
+        class NfaBuilder
+        {
+        public:
+
+            struct State
+            {
+                std::vector<unsigned int> epsilonTransitions;
+                int setIndex = -1;
+                unsigned int next = 0;
+            };
+
+            struct Fragment
+            {
+                unsigned int start;
+                unsigned int end;
+            };
+
+            bool build(const RegexNode& root)
+            {
+                const Fragment fragment = buildFragment(root);
+                m_startState = fragment.start;
+                m_acceptingState = fragment.end;
+                return !m_tooLarge;
+            }
+
+            const std::vector<State>& getStates() const
+            {
+                return m_states;
+            }
+
+            const std::vector<CodePointSet>& getSets() const
+            {
+                return m_sets;
+            }
+
+            unsigned int getStartState() const
+            {
+                return m_startState;
+            }
+
+            unsigned int getAcceptingState() const
+            {
+                return m_acceptingState;
+            }
+
+        private:
+
+            unsigned int addState()
+            {
+                if (m_states.size() >= MaxNfaStates)
+                {
+                    m_tooLarge = true;
+                    return 0;
+                }
+
+                m_states.emplace_back();
+                return static_cast<unsigned int>(m_states.size() - 1);
+            }
+
+            Fragment buildFragment(const RegexNode& node)
+            {
+                if (m_tooLarge)
+                    return {0, 0};
+
+                switch (node.type)
+                {
+                    case RegexNode::Type::Set:
+                    {
+                        const unsigned int start = addState();
+                        const unsigned int end = addState();
+                        if (m_tooLarge)
+                            return {0, 0};
+
+                        m_sets.push_back(node.set);
+                        m_states[start].setIndex = static_cast<int>(m_sets.size() - 1);
+                        m_states[start].next = end;
+                        return {start, end};
+                    }
+                    case RegexNode::Type::Concatenation:
+                    {
+                        const unsigned int start = addState();
+                        unsigned int end = start;
+                        for (const auto& child : node.children)
+                        {
+                            const Fragment fragment = buildFragment(*child);
+                            if (m_tooLarge)
+                                return {0, 0};
+
+                            m_states[end].epsilonTransitions.push_back(fragment.start);
+                            end = fragment.end;
+                        }
+
+                        return {start, end};
+                    }
+                    case RegexNode::Type::Alternation:
+                    {
+                        const unsigned int start = addState();
+                        const unsigned int end = addState();
+                        for (const auto& child : node.children)
+                        {
+                            const Fragment fragment = buildFragment(*child);
+                            if (m_tooLarge)
+                                return {0, 0};
+
+                            m_states[start].epsilonTransitions.push_back(fragment.start);
+                            m_states[fragment.end].epsilonTransitions.push_back(end);
+                        }
+
+                        return {start, end};
+                    }
+                    case RegexNode::Type::Repetition:
+                    {
+                        const unsigned int start = addState();
+                        unsigned int current = start;
+                        for (unsigned int i = 0; i < node.minRepetitions; ++i)
+                        {
+                            const Fragment fragment = buildFragment(*node.children[0]);
+                            if (m_tooLarge)
+                                return {0, 0};
+
+                            m_states[current].epsilonTransitions.push_back(fragment.start);
+                            current = fragment.end;
+                        }
+
+                        if (node.maxRepetitions == InfiniteRepetitions)
+                        {
+                            const unsigned int loop = addState();
+                            const Fragment fragment = buildFragment(*node.children[0]);
+                            if (m_tooLarge)
+                                return {0, 0};
+
+                            m_states[current].epsilonTransitions.push_back(loop);
+                            m_states[loop].epsilonTransitions.push_back(fragment.start);
+                            m_states[fragment.end].epsilonTransitions.push_back(loop);
+                            return {start, loop};
+                        }
+
+                        const unsigned int end = addState();
+                        for (unsigned int i = node.minRepetitions; i < node.maxRepetitions; ++i)
+                        {
+                            const Fragment fragment = buildFragment(*node.children[0]);
+                            if (m_tooLarge)
+                                return {0, 0};
+
+                            m_states[current].epsilonTransitions.push_back(end);
+                            m_states[current].epsilonTransitions.push_back(fragment.start);
+                            current = fragment.end;
+                        }
+
+                        if (m_tooLarge)
+                            return {0, 0};
+
+                        m_states[current].epsilonTransitions.push_back(end);
+                        return {start, end};
+                    }
+                }
+
+                return {0, 0};
+            }
+
+        private:
+
+            std::vector<State> m_states;
+            std::vector<CodePointSet> m_sets;
+            unsigned int m_startState = 0;
+            unsigned int m_acceptingState = 0;
+            bool m_tooLarge = false;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t findCharacterClass(const std::vector<std::uint32_t>& classBoundaries, std::uint32_t character)
+        {
+            return static_cast<std::size_t>(std::upper_bound(classBoundaries.begin(), classBoundaries.end(), character) - classBoundaries.begin()) - 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds all states that can be reached through epsilon transitions and sorts the states
+        void addEpsilonClosure(const std::vector<NfaBuilder::State>& nfaStates, std::vector<unsigned int>& states, std::vector<bool>& visited)
+        {
+            std::fill(visited.begin(), visited.end(), false);
+            for (const auto state : states)
+                visited[state] = true;
+
+            std::vector<unsigned int> stack = states;
+            while (!stack.empty())
+            {
+                const unsigned int state = stack.back();
+                stack.pop_back();
+
+                for (const auto next : nfaStates[state].epsilonTransitions)
+                {
+                    if (!visited[next])
+                    {
+                        visited[next] = true;
+                        states.push_back(next);
+                        stack.push_back(next);
+                    }
+                }
+            }
+
+            std::sort(states.begin(), states.end());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RegexDfa::RegexDfa(std::vector<std::uint32_t> classBoundaries, std::vector<unsigned int> transitions, std::vector<bool> accepting) :
+        m_classBoundaries{std::move(classBoundaries)},
+        m_transitions    {std::move(transitions)},
+        m_accepting      {std::move(accepting)}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RegexDfa::ConstPtr RegexDfa::create(const std::string& pattern)
+    {
+        if (pattern == EditBox::Validator::UInt)
+        {
+            static const ConstPtr dfa{new RegexDfa(toVector(NumberClassBoundaries),
+                                                   toVector(UIntTransitions),
+                                                   toVector(UIntAccepting))};
+            return dfa;
+        }
+        else if (pattern == EditBox::Validator::Int)
+        {
+            static const ConstPtr dfa{new RegexDfa(toVector(NumberClassBoundaries),
+                                                   toVector(IntTransitions),
+                                                   toVector(IntAccepting))};
+            return dfa;
+        }
+        else if (pattern == EditBox::Validator::Float)
+        {
+            static const ConstPtr dfa{new RegexDfa(toVector(NumberClassBoundaries),
+                                                   toVector(FloatTransitions),
+                                                   toVector(FloatAccepting))};
+            return dfa;
+        }
+        else
+            return compile(pattern);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RegexDfa::ConstPtr RegexDfa::compile(const std::string& pattern)
+    {
+        const sf::String unicodePattern = sf::String::fromUtf8(pattern.begin(), pattern.end());
+        const auto root = RegexParser{unicodePattern}.parse();
+        if (!root)
+            return nullptr;
+
+        NfaBuilder nfa;
+        if (!nfa.build(*root))
+            return nullptr;
+
+        const auto& nfaStates = nfa.getStates();
+        const auto& sets = nfa.getSets();
+
+        // Split the code points in classes so that each set either contains all or none of the code points in a class
+        std::vector<std::uint32_t> classBoundaries = {0};
+        for (const auto& set : sets)
+        {
+            for (const auto& range : set)
+            {
+                classBoundaries.push_back(range.first);
+                if (range.last < MaxCodePoint)
+                    classBoundaries.push_back(range.last + 1);
+            }
+        }
+        std::sort(classBoundaries.begin(), classBoundaries.end());
+        classBoundaries.erase(std::unique(classBoundaries.begin(), classBoundaries.end()), classBoundaries.end());
+        const std::size_t classCount = classBoundaries.size();
+
+        std::vector<std::vector<bool>> setMembership(sets.size(), std::vector<bool>(classCount, false));
+        for (std::size_t i = 0; i < sets.size(); ++i)
+        {
+            for (const auto& range : sets[i])
+            {
+                const std::size_t lastClass = findCharacterClass(classBoundaries, range.last);
+                for (std::size_t c = findCharacterClass(classBoundaries, range.first); c <= lastClass; ++c)
+                    setMembership[i][c] = true;
+            }
+        }
+
+        // Subset construction, where state 0 is the dead state that corresponds with the empty set of NFA states
+        std::map<std::vector<unsigned int>, unsigned int> stateIds;
+        std::vector<std::vector<unsigned int>> dfaStates;
+        std::vector<unsigned int> transitions;
+        std::vector<bool> visited(nfaStates.size(), false);
+
+        stateIds[{}] = 0;
+        dfaStates.emplace_back();
+
+        std::vector<unsigned int> startStates = {nfa.getStartState()};
+        addEpsilonClosure(nfaStates, startStates, visited);
+        stateIds[startStates] = 1;
+        dfaStates.push_back(std::move(startStates));
+
+        for (std::size_t id = 0; id < dfaStates.size(); ++id)
+        {
+            for (std::size_t c = 0; c < classCount; ++c)
+            {
+                std::vector<unsigned int> nextStates;
+                for (const auto state : dfaStates[id])
+                {
+                    const int setIndex = nfaStates[state].setIndex;
+                    if ((setIndex >= 0) && setMembership[static_cast<std::size_t>(setIndex)][c])
+                        nextStates.push_back(nfaStates[state].next);
+                }
+
+                addEpsilonClosure(nfaStates, nextStates, visited);
+                nextStates.erase(std::unique(nextStates.begin(), nextStates.end()), nextStates.end());
+
+                const auto it = stateIds.find(nextStates);
+                if (it != stateIds.end())
+                    transitions.push_back(it->second);
+                else
+                {
+                    if (dfaStates.size() >= MaxDfaStates)
+                        return nullptr;
+
+                    const auto nextId = static_cast<unsigned int>(dfaStates.size());
+                    stateIds[nextStates] = nextId;
+                    dfaStates.push_back(std::move(nextStates));
+                    transitions.push_back(nextId);
+                }
+            }
+        }
+
+        std::vector<bool> accepting(dfaStates.size(), false);
+        for (std::size_t id = 0; id < dfaStates.size(); ++id)
+            accepting[id] = std::binary_search(dfaStates[id].begin(), dfaStates[id].end(), nfa.getAcceptingState());
+
+        // Find the states from which an accepting state can still be reached, the other states are merged into the dead state
+        std::vector<std::vector<unsigned int>> predecessors(dfaStates.size());
+        for (std::size_t id = 0; id < dfaStates.size(); ++id)
+        {
+            for (std::size_t c = 0; c < classCount; ++c)
+                predecessors[transitions[id * classCount + c]].push_back(static_cast<unsigned int>(id));
+        }
+
+        std::vector<bool> alive = accepting;
+        std::vector<unsigned int> stack;
+        for (std::size_t id = 0; id < dfaStates.size(); ++id)
+        {
+            if (alive[id])
+                stack.push_back(static_cast<unsigned int>(id));
+        }
+        while (!stack.empty())
+        {
+            const unsigned int id = stack.back();
+            stack.pop_back();
+            for (const auto predecessor : predecessors[id])
+            {
+                if (!alive[predecessor])
+                {
+                    alive[predecessor] = true;
+                    stack.push_back(predecessor);
+                }
+            }
+        }
+
+        // The dead and start states always keep their ids
+        std::vector<unsigned int> newIds(dfaStates.size(), DeadState);
+        unsigned int newStateCount = 2;
+        newIds[1] = 1;
+        for (std::size_t id = 2; id < dfaStates.size(); ++id)
+        {
+            if (alive[id])
+                newIds[id] = newStateCount++;
+        }
+
+        std::vector<unsigned int> newTransitions(newStateCount * classCount, DeadState);
+        std::vector<bool> newAccepting(newStateCount, false);
+        for (std::size_t id = 1; id < dfaStates.size(); ++id)
+        {
+            if ((id != 1) && !alive[id])
+                continue;
+
+            newAccepting[newIds[id]] = accepting[id];
+            for (std::size_t c = 0; c < classCount; ++c)
+            {
+                const unsigned int next = transitions[id * classCount + c];
+                newTransitions[newIds[id] * classCount + c] = alive[next] ? newIds[next] : DeadState;
+            }
+        }
+
+        return ConstPtr{new RegexDfa(std::move(classBoundaries), std::move(newTransitions), std::move(newAccepting))};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int RegexDfa::advance(unsigned int state, std::uint32_t character) const
+    {
+        if (character > MaxCodePoint)
+            return DeadState;
+
+        return m_transitions[state * m_classBoundaries.size() + findCharacterClass(m_classBoundaries, character)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RegexDfa::match(const sf::String& text) const
+    {
+        unsigned int state = getStartState();
+        for (const auto character : text)
+        {
+            state = advance(state, character);
+            if (state == DeadState)
+                return false;
+        }
+
+        return isAccepting(state);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RenderBackend.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        thread_local RenderBackend* activeRenderBackend = nullptr;
+
+        Vector2f computeShapeNormal(Vector2f p1, Vector2f p2)
+        {
+            Vector2f normal{p1.y - p2.y, p2.x - p1.x};
+            const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+            if (length != 0)
+                normal /= length;
+            return normal;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBackend::Scope::Scope(RenderBackend* backend) :
+        m_previousBackend{activeRenderBackend}
+    {
+        activeRenderBackend = backend;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBackend::Scope::~Scope()
+    {
+        activeRenderBackend = m_previousBackend;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBackend::invalidateTexture(const sf::Texture&)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBackend* RenderBackend::getActive()
+    {
+        return activeRenderBackend;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBackend::drawVertices(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        if (activeRenderBackend)
+            activeRenderBackend->renderVertices(vertices, vertexCount, type, states);
+        else
+            target.draw(vertices, vertexCount, type, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBackend::drawShape(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+    {
+        if (!activeRenderBackend)
+        {
+            target.draw(shape, states);
+            return;
+        }
+
+        const std::size_t pointCount = shape.getPointCount();
+        if (pointCount < 3)
+            return;
+
+        sf::RenderStates shapeStates = states;
+        shapeStates.transform *= shape.getTransform();
+        shapeStates.texture = nullptr;
+
+        // The inside of the shape is drawn as a triangle fan around the center of the points, like sf::Shape does
+        std::vector<sf::Vertex> vertices(pointCount + 2);
+        Vector2f minPoint = shape.getPoint(0);
+        Vector2f maxPoint = minPoint;
+        for (std::size_t i = 0; i < pointCount; ++i)
+        {
+            const Vector2f point = shape.getPoint(i);
+            vertices[i + 1] = {point, shape.getFillColor()};
+            minPoint = {std::min(minPoint.x, point.x), std::min(minPoint.y, point.y)};
+            maxPoint = {std::max(maxPoint.x, point.x), std::max(maxPoint.y, point.y)};
+        }
+        vertices[0] = {(minPoint + maxPoint) / 2.f, shape.getFillColor()};
+        vertices[pointCount + 1] = vertices[1];
+
+        if (shape.getFillColor().a > 0)
+            activeRenderBackend->renderVertices(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesFan, shapeStates);
+
+        const float outlineThickness = shape.getOutlineThickness();
+        if ((outlineThickness == 0) || (shape.getOutlineColor().a == 0))
+            return;
+
+        // The outline is a triangle strip between the points and the points moved outwards, using the same miter
+        // calculation as sf::Shape so that the result looks identical to drawing the shape on a render target
+        std::vector<sf::Vertex> outline((pointCount + 1) * 2);
+        for (std::size_t i = 0; i < pointCount; ++i)
+        {
+            const Vector2f p0 = vertices[(i == 0) ? pointCount : i].position;
+            const Vector2f p1 = vertices[i + 1].position;
+            const Vector2f p2 = vertices[i + 2].position;
+
+            Vector2f n1 = computeShapeNormal(p0, p1);
+            Vector2f n2 = computeShapeNormal(p1, p2);
+
+            const Vector2f toCenter = Vector2f{vertices[0].position} - p1;
+            if (n1.x * toCenter.x + n1.y * toCenter.y > 0)
+                n1 = -n1;
+            if (n2.x * toCenter.x + n2.y * toCenter.y > 0)
+                n2 = -n2;
+
+            const float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
+            const Vector2f normal = (n1 + n2) / factor;
+
+            outline[i * 2] = {p1, shape.getOutlineColor()};
+            outline[i * 2 + 1] = {p1 + normal * outlineThickness, shape.getOutlineColor()};
+        }
+        outline[pointCount * 2] = outline[0];
+        outline[pointCount * 2 + 1] = outline[1];
+
+        activeRenderBackend->renderVertices(outline.data(), outline.size(), sf::PrimitiveType::TrianglesStrip, shapeStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBackend::drawText(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states)
+    {
+        if (activeRenderBackend)
+            activeRenderBackend->renderText(text, states);
+        else
+            target.draw(text, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
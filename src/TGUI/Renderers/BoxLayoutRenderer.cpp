@@ -41,15 +41,15 @@ namespace tgui
 
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("spacebetweenwidgets");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        ObjectConverter* value = m_data->findProperty("spacebetweenwidgets");
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("padding");
-            if (it != m_data->propertyValuePairs.end())
+            value = m_data->findProperty("padding");
+            if (value)
             {
-                const Padding padding = it->second.getOutline();
+                const Padding padding = value->getOutline();
                 return std::max(std::min(padding.getLeft(), padding.getRight()), std::min(padding.getTop(), padding.getBottom()));
             }
             else
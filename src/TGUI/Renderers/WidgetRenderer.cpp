@@ -30,6 +30,84 @@
 
 namespace tgui
 {
+    RendererData::~RendererData()
+    {
+        if (base)
+        {
+            std::lock_guard<std::recursive_mutex> lock{base->observersMutex};
+            base->observers.erase(this);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> RendererData::createOverlay(const std::shared_ptr<RendererData>& base)
+    {
+        auto overlay = std::make_shared<RendererData>();
+        overlay->base = base;
+        overlay->shared = false;
+
+        // Changes to the base data are only visible in the overlay when the property wasn't overridden
+        RendererData* overlayPtr = overlay.get();
+        std::lock_guard<std::recursive_mutex> lock{base->observersMutex};
+        base->observers[overlayPtr] = [overlayPtr](const std::string& property){
+            if (overlayPtr->propertyValuePairs.find(property) != overlayPtr->propertyValuePairs.end())
+                return;
+
+            std::lock_guard<std::recursive_mutex> overlayLock{overlayPtr->observersMutex};
+            for (const auto& observer : overlayPtr->observers)
+                observer.second(property);
+        };
+
+        return overlay;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter* RendererData::findProperty(const std::string& lowercaseProperty)
+    {
+        RendererData* data = this;
+        do
+        {
+            const auto it = data->propertyValuePairs.find(lowercaseProperty);
+            if (it != data->propertyValuePairs.end())
+                return &it->second;
+
+            data = data->base.get();
+        }
+        while (data);
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, ObjectConverter> RendererData::getAllPropertyValuePairs() const
+    {
+        if (!base)
+            return propertyValuePairs;
+
+        // Properties in the overlay take priority, insert won't overwrite them
+        auto properties = propertyValuePairs;
+        for (const auto& pair : base->getAllPropertyValuePairs())
+            properties.insert(pair);
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererData& RendererData::getRootData()
+    {
+        RendererData* data = this;
+        while (data->base)
+            data = data->base.get();
+
+        return *data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,9 +142,9 @@ namespace tgui
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getFont();
+        ObjectConverter* value = m_data->findProperty("font");
+        if (value)
+            return value->getFont();
         else
             return {};
     }
@@ -81,6 +159,7 @@ namespace tgui
         {
             m_data->propertyValuePairs[lowercaseProperty] = value;
 
+            std::lock_guard<std::recursive_mutex> lock{m_data->observersMutex};
             for (const auto& observer : m_data->observers)
                 observer.second(lowercaseProperty);
         }
@@ -90,24 +169,25 @@ namespace tgui
 
     ObjectConverter WidgetRenderer::getProperty(const std::string& property) const
     {
-        auto it = m_data->propertyValuePairs.find(toLower(property));
-        if (it != m_data->propertyValuePairs.end())
-            return it->second;
+        const ObjectConverter* value = m_data->findProperty(toLower(property));
+        if (value)
+            return *value;
         else
             return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    std::map<std::string, ObjectConverter> WidgetRenderer::getPropertyValuePairs() const
     {
-        return m_data->propertyValuePairs;
+        return m_data->getAllPropertyValuePairs();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
     {
+        std::lock_guard<std::recursive_mutex> lock{m_data->observersMutex};
         m_data->observers[id] = function;
     }
 
@@ -115,6 +195,7 @@ namespace tgui
 
     void WidgetRenderer::unsubscribe(const void* id)
     {
+        std::lock_guard<std::recursive_mutex> lock{m_data->observersMutex};
         m_data->observers.erase(id);
     }
 
@@ -136,8 +217,8 @@ namespace tgui
 
     std::shared_ptr<RendererData> WidgetRenderer::clone() const
     {
-        auto data = std::make_shared<RendererData>(*m_data);
-        data->observers = {};
+        auto data = RendererData::create(m_data->getAllPropertyValuePairs());
+        data->shared = m_data->shared;
         return data;
     }
 
@@ -27,14 +27,22 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <set>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace
 {
-    unsigned int lastId = 0;
+    // Signals of guis on different threads can be connected at the same time
+    std::atomic<unsigned int> lastId{0};
+
+    // Amount of parameters of the signal with the most parameters, which may be emitted on any thread
+    std::atomic<std::size_t> parameterCount{3};
 
     unsigned int generateUniqueId()
     {
@@ -58,7 +66,39 @@ namespace tgui
 {
     namespace internal_signal
     {
-        std::deque<const void*> parameters;
+        std::deque<const void*>& getParameters()
+        {
+            // A signal might be emitted on a thread that didn't construct it, so the storage grows when it is used.
+            // Growing a deque at the end doesn't move the parameters of a signal that is still being emitted.
+            thread_local std::deque<const void*> parameters;
+            const std::size_t count = parameterCount.load(std::memory_order_relaxed);
+            if (parameters.size() < count)
+                parameters.resize(count);
+
+            return parameters;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void reserveParameters(std::size_t count)
+        {
+            std::size_t currentCount = parameterCount.load();
+            while ((currentCount < count) && !parameterCount.compare_exchange_weak(currentCount, count))
+            {
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::string* getUniqueName(std::string&& name)
+        {
+            // Elements in an unordered_set keep their address when the set grows
+            static std::unordered_set<std::string> names;
+            static std::mutex namesMutex;
+
+            std::lock_guard<std::mutex> lock(namesMutex);
+            return &*names.insert(std::move(name)).first;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,7 +118,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -89,7 +129,7 @@ namespace tgui
     unsigned int Signal::connect(const Delegate& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = handler;
+        getHandlers()[id] = handler;
         return id;
     }
 
@@ -98,7 +138,7 @@ namespace tgui
     unsigned int Signal::connect(const DelegateEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name); };
         return id;
     }
 
@@ -106,21 +146,43 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        if (!m_handlers)
+            return true;
+
+        return m_handlers->erase(id) == 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        m_handlers = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::emit(const Widget* widget)
+    {
+        if (!hasHandlers() || !m_enabled)
+            return false;
+
+        TGUI_PROFILE_SCOPE(Signal, m_name->c_str());
+
+        internal_signal::getParameters()[0] = static_cast<const void*>(&widget);
+
+        // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
+        auto handlers = *m_handlers;
+        for (auto& handler : handlers)
+            handler.second();
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Signal::getWidget()
     {
-        return internal_signal::dereference<Widget*>(internal_signal::parameters[0])->shared_from_this();
+        return internal_signal::dereference<Widget*>(internal_signal::getParameters()[0])->shared_from_this();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,7 +192,7 @@ namespace tgui
         if (unboundParameters.size() == 0)
             return 0;
         else
-            throw Exception{"Signal '" + m_name + "' could not provide data for unbound parameters."};
+            throw Exception{"Signal '" + *m_name + "' could not provide data for unbound parameters."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,14 +202,14 @@ namespace tgui
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        getHandlers()[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::getParameters()[1])); }; \
         return id; \
     } \
     \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name, internal_signal::dereference<Type>(internal_signal::getParameters()[1])); }; \
         return id; \
     }
 
@@ -224,7 +286,7 @@ namespace tgui
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        getHandlers()[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::getParameters()[1]), internal_signal::dereference<float>(internal_signal::getParameters()[2])); };
         return id;
     }
 
@@ -233,7 +295,7 @@ namespace tgui
     unsigned int SignalRange::connect(const DelegateRangeEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name, internal_signal::dereference<float>(internal_signal::getParameters()[1]), internal_signal::dereference<float>(internal_signal::getParameters()[2])); };
         return id;
     }
 #endif
@@ -241,11 +303,11 @@ namespace tgui
 
     bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
-        internal_signal::parameters[1] = static_cast<const void*>(&start);
-        internal_signal::parameters[2] = static_cast<const void*>(&end);
+        internal_signal::getParameters()[1] = static_cast<const void*>(&start);
+        internal_signal::getParameters()[2] = static_cast<const void*>(&end);
         return Signal::emit(widget);
     }
 
@@ -264,7 +326,7 @@ namespace tgui
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
+        getHandlers()[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::getParameters()[1])); };
         return id;
     }
 
@@ -273,7 +335,7 @@ namespace tgui
     unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::getParameters()[1])); };
         return id;
     }
 #endif
@@ -281,11 +343,11 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
-        internal_signal::parameters[1] = static_cast<const void*>(&sharedPtr);
+        internal_signal::getParameters()[1] = static_cast<const void*>(&sharedPtr);
         return Signal::emit(childWindow);
     }
 
@@ -304,7 +366,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        getHandlers()[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::getParameters()[1])); };
         return id;
     }
 
@@ -313,7 +375,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name, internal_signal::dereference<sf::String>(internal_signal::getParameters()[1])); };
         return id;
     }
 
@@ -322,7 +384,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        getHandlers()[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::getParameters()[1]), internal_signal::dereference<sf::String>(internal_signal::getParameters()[2])); };
         return id;
     }
 
@@ -331,7 +393,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndIdEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name, internal_signal::dereference<sf::String>(internal_signal::getParameters()[1]), internal_signal::dereference<sf::String>(internal_signal::getParameters()[2])); };
         return id;
     }
 #endif
@@ -356,7 +418,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        getHandlers()[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::getParameters()[1])); };
         return id;
     }
 
@@ -365,7 +427,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name, internal_signal::dereference<sf::String>(internal_signal::getParameters()[1])); };
         return id;
     }
 
@@ -374,7 +436,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFull& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        getHandlers()[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::getParameters()[2])); };
         return id;
     }
 
@@ -383,7 +445,7 @@ namespace tgui
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFullEx& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        getHandlers()[id] = [handler, name=m_name](){ handler(getWidget(), *name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::getParameters()[2])); };
         return id;
     }
 #endif
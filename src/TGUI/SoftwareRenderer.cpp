@@ -0,0 +1,713 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/SoftwareRenderer.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define TGUI_SOFTWARE_RENDERER_SSE2
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Divides by 255 with rounding, exact for every value up to 255 * 255 * 2
+        inline unsigned int divideBy255(unsigned int value)
+        {
+            value += 128;
+            return (value + (value >> 8)) >> 8;
+        }
+
+        // Blends a color on top of a pixel like sf::BlendAlpha does
+        inline void blendPixel(std::uint8_t* pixel, unsigned int red, unsigned int green, unsigned int blue, unsigned int alpha)
+        {
+            const unsigned int inverseAlpha = 255 - alpha;
+            pixel[0] = static_cast<std::uint8_t>(divideBy255(red * alpha + pixel[0] * inverseAlpha));
+            pixel[1] = static_cast<std::uint8_t>(divideBy255(green * alpha + pixel[1] * inverseAlpha));
+            pixel[2] = static_cast<std::uint8_t>(divideBy255(blue * alpha + pixel[2] * inverseAlpha));
+            pixel[3] = static_cast<std::uint8_t>(divideBy255(255 * alpha + pixel[3] * inverseAlpha));
+        }
+
+        // Blends a single color on a row of pixels
+        void blendSpan(std::uint8_t* pixels, std::size_t count, const sf::Color& color)
+        {
+            if (color.a == 0)
+                return;
+
+            if (color.a == 255)
+            {
+                const std::uint8_t rgba[4] = {color.r, color.g, color.b, color.a};
+                for (std::size_t i = 0; i < count; ++i)
+                    std::memcpy(pixels + i * 4, rgba, 4);
+                return;
+            }
+
+            std::size_t i = 0;
+#ifdef TGUI_SOFTWARE_RENDERER_SSE2
+            // Handle 4 pixels at once, with every channel widened to 16 bits. The calculation is the same as in blendPixel.
+            const short alpha = static_cast<short>(color.a);
+            const __m128i sourceTerm = _mm_set_epi16(static_cast<short>(255 * alpha), static_cast<short>(color.b * alpha),
+                                                     static_cast<short>(color.g * alpha), static_cast<short>(color.r * alpha),
+                                                     static_cast<short>(255 * alpha), static_cast<short>(color.b * alpha),
+                                                     static_cast<short>(color.g * alpha), static_cast<short>(color.r * alpha));
+            const __m128i inverseAlpha = _mm_set1_epi16(static_cast<short>(255 - alpha));
+            const __m128i rounding = _mm_set1_epi16(128);
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128i* address = reinterpret_cast<__m128i*>(pixels + i * 4);
+                const __m128i destination = _mm_loadu_si128(address);
+
+                __m128i low = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(destination, zero), inverseAlpha), sourceTerm), rounding);
+                __m128i high = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(destination, zero), inverseAlpha), sourceTerm), rounding);
+                low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+                high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+
+                _mm_storeu_si128(address, _mm_packus_epi16(low, high));
+            }
+#endif
+            for (; i < count; ++i)
+                blendPixel(pixels + i * 4, color.r, color.g, color.b, color.a);
+        }
+
+        // Converts a coordinate to an integer. Values outside the range of an int (or NaN) would be undefined behavior, so they
+        // are clamped to a range that is still far outside any pixel buffer or texture.
+        inline int toInt(float value)
+        {
+            const float limit = 1e9f;
+            if (!(value > -limit))
+                return -static_cast<int>(limit);
+            else if (value > limit)
+                return static_cast<int>(limit);
+            else
+                return static_cast<int>(value);
+        }
+
+        // Returns the index of a texel, taking into account whether the texture is repeated
+        inline unsigned int getTexelCoordinate(int coordinate, unsigned int size, bool repeated)
+        {
+            const int lastTexel = static_cast<int>(size) - 1;
+            if (repeated)
+            {
+                const int wrapped = coordinate % static_cast<int>(size);
+                return static_cast<unsigned int>((wrapped < 0) ? wrapped + lastTexel + 1 : wrapped);
+            }
+            else
+                return static_cast<unsigned int>(std::max(0, std::min(coordinate, lastTexel)));
+        }
+
+        // Reads the color of a texture at the given pixel coordinates
+        void sampleTexture(const sf::Image& image, sf::Vector2u size, bool smooth, bool repeated, float u, float v, float result[4])
+        {
+            const std::uint8_t* pixels = image.getPixelsPtr();
+            if (!smooth)
+            {
+                const unsigned int x = getTexelCoordinate(toInt(std::floor(u)), size.x, repeated);
+                const unsigned int y = getTexelCoordinate(toInt(std::floor(v)), size.y, repeated);
+                const std::uint8_t* texel = pixels + (y * size.x + x) * 4;
+                for (unsigned int i = 0; i < 4; ++i)
+                    result[i] = texel[i];
+                return;
+            }
+
+            // Bilinear interpolation between the 4 nearest texels
+            u -= 0.5f;
+            v -= 0.5f;
+            const float left = std::floor(u);
+            const float top = std::floor(v);
+            const float fractionX = u - left;
+            const float fractionY = v - top;
+            const unsigned int x1 = getTexelCoordinate(toInt(left), size.x, repeated);
+            const unsigned int x2 = getTexelCoordinate(toInt(left) + 1, size.x, repeated);
+            const unsigned int y1 = getTexelCoordinate(toInt(top), size.y, repeated);
+            const unsigned int y2 = getTexelCoordinate(toInt(top) + 1, size.y, repeated);
+            const std::uint8_t* topLeft = pixels + (y1 * size.x + x1) * 4;
+            const std::uint8_t* topRight = pixels + (y1 * size.x + x2) * 4;
+            const std::uint8_t* bottomLeft = pixels + (y2 * size.x + x1) * 4;
+            const std::uint8_t* bottomRight = pixels + (y2 * size.x + x2) * 4;
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                const float topValue = topLeft[i] + (topRight[i] - topLeft[i]) * fractionX;
+                const float bottomValue = bottomLeft[i] + (bottomRight[i] - bottomLeft[i]) * fractionX;
+                result[i] = topValue + (bottomValue - topValue) * fractionY;
+            }
+        }
+
+        // Adds the two triangles of a glyph to the vertices, like sf::Text does
+        void addGlyphQuad(std::vector<sf::Vertex>& vertices, Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+        {
+            const float padding = 1.0;
+
+            const float left = glyph.bounds.left - padding;
+            const float top = glyph.bounds.top - padding;
+            const float right = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+            const sf::Vertex topLeft{{position.x + left - italicShear * top, position.y + top}, color, {u1, v1}};
+            const sf::Vertex topRight{{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}};
+            const sf::Vertex bottomLeft{{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}};
+            const sf::Vertex bottomRight{{position.x + right - italicShear * bottom, position.y + bottom}, color, {u2, v2}};
+
+            vertices.insert(vertices.end(), {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight});
+        }
+
+        // Adds the two triangles of an underline or strike through line, like sf::Text does
+        void addTextLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, const sf::Color& color, float offset, float thickness, float outlineThickness)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+
+            // The fonts contain a white pixel at (1,1), which is used for drawing lines
+            const sf::Vertex topLeft{{-outlineThickness, top - outlineThickness}, color, {1, 1}};
+            const sf::Vertex topRight{{lineLength + outlineThickness, top - outlineThickness}, color, {1, 1}};
+            const sf::Vertex bottomLeft{{-outlineThickness, bottom + outlineThickness}, color, {1, 1}};
+            const sf::Vertex bottomRight{{lineLength + outlineThickness, bottom + outlineThickness}, color, {1, 1}};
+
+            vertices.insert(vertices.end(), {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight});
+        }
+
+        // Identifies a glyph within a font texture
+        std::uint64_t getGlyphKey(std::uint32_t codePoint, bool bold, float outlineThickness)
+        {
+            return (std::uint64_t{codePoint} << 32) | (std::uint64_t{bold} << 31) | (static_cast<std::uint32_t>(toInt(outlineThickness * 64)) & 0x7FFFFFFF);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SoftwareRenderer::TextureKeyHasher::operator()(const TextureKey& key) const
+    {
+        return std::hash<const sf::Texture*>()(key.texture) ^ (std::hash<unsigned int>()(key.nativeHandle) << 1)
+            ^ (std::hash<unsigned int>()(key.size.x) << 2) ^ (std::hash<unsigned int>()(key.size.y) << 3);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SoftwareRenderer::SoftwareRenderer(sf::Vector2u size)
+    {
+        setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SoftwareRenderer::Ptr SoftwareRenderer::create(sf::Vector2u size)
+    {
+        return std::make_shared<SoftwareRenderer>(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::setSize(sf::Vector2u size)
+    {
+        m_size = size;
+        m_pixels.assign(static_cast<std::size_t>(size.x) * size.y * 4, 0);
+        m_previousPixels.assign(m_pixels.size(), 0);
+        m_previousPixelsValid = false;
+        m_dirtyRects.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u SoftwareRenderer::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::setClearColor(Color color)
+    {
+        m_clearColor = color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color SoftwareRenderer::getClearColor() const
+    {
+        return m_clearColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::setTileSize(unsigned int tileSize)
+    {
+        m_tileSize = std::max(1u, tileSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int SoftwareRenderer::getTileSize() const
+    {
+        return m_tileSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* SoftwareRenderer::getPixels() const
+    {
+        return m_pixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<sf::IntRect>& SoftwareRenderer::getDirtyRects() const
+    {
+        return m_dirtyRects;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::clearTextureCache()
+    {
+        m_textureImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::beginFrame(const sf::View& view)
+    {
+        // Calculate the viewport in pixels the same way as sf::RenderTarget::getViewport does
+        const float width = static_cast<float>(m_size.x);
+        const float height = static_cast<float>(m_size.y);
+        const sf::FloatRect& viewport = view.getViewport();
+        const sf::IntRect viewportRect{static_cast<int>(0.5f + width * viewport.left),
+                                       static_cast<int>(0.5f + height * viewport.top),
+                                       static_cast<int>(0.5f + width * viewport.width),
+                                       static_cast<int>(0.5f + height * viewport.height)};
+
+        // The view maps the coordinates to the range [-1, 1], which is then mapped on the viewport
+        const float halfWidth = viewportRect.width / 2.f;
+        const float halfHeight = viewportRect.height / 2.f;
+        m_viewTransform = sf::Transform{halfWidth, 0, viewportRect.left + halfWidth,
+                                        0, -halfHeight, viewportRect.top + halfHeight,
+                                        0, 0, 1};
+        m_viewTransform *= view.getTransform();
+
+        const int clipLeft = std::max(0, viewportRect.left);
+        const int clipTop = std::max(0, viewportRect.top);
+        const int clipRight = std::min(static_cast<int>(m_size.x), viewportRect.left + viewportRect.width);
+        const int clipBottom = std::min(static_cast<int>(m_size.y), viewportRect.top + viewportRect.height);
+        m_clipAreas.assign(1, {clipLeft, clipTop, std::max(0, clipRight - clipLeft), std::max(0, clipBottom - clipTop)});
+
+        const sf::Color clearColor = m_clearColor;
+        const std::uint8_t rgba[4] = {clearColor.r, clearColor.g, clearColor.b, clearColor.a};
+        for (std::size_t i = 0; i < m_pixels.size(); i += 4)
+            std::memcpy(&m_pixels[i], rgba, 4);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::endFrame()
+    {
+        m_dirtyRects.clear();
+
+        const unsigned int tilesX = (m_size.x + m_tileSize - 1) / m_tileSize;
+        const unsigned int tilesY = (m_size.y + m_tileSize - 1) / m_tileSize;
+        for (unsigned int tileY = 0; tileY < tilesY; ++tileY)
+        {
+            const unsigned int top = tileY * m_tileSize;
+            const unsigned int bottom = std::min(top + m_tileSize, m_size.y);
+
+            bool runActive = false;
+            for (unsigned int tileX = 0; tileX < tilesX; ++tileX)
+            {
+                const unsigned int left = tileX * m_tileSize;
+                const unsigned int right = std::min(left + m_tileSize, m_size.x);
+                const std::size_t rowBytes = (right - left) * 4;
+
+                // Compare the rows of the tile with the previous frame and store the new contents when they differ
+                bool dirty = !m_previousPixelsValid;
+                for (unsigned int y = top; y < bottom; ++y)
+                {
+                    const std::size_t offset = (static_cast<std::size_t>(y) * m_size.x + left) * 4;
+                    if (!dirty && (std::memcmp(&m_pixels[offset], &m_previousPixels[offset], rowBytes) == 0))
+                        continue;
+
+                    dirty = true;
+                    std::memcpy(&m_previousPixels[offset], &m_pixels[offset], rowBytes);
+                }
+
+                if (!dirty)
+                    runActive = false;
+                else if (runActive)
+                    m_dirtyRects.back().width = static_cast<int>(right) - m_dirtyRects.back().left;
+                else
+                {
+                    m_dirtyRects.emplace_back(static_cast<int>(left), static_cast<int>(top), static_cast<int>(right - left), static_cast<int>(bottom - top));
+                    runActive = true;
+                }
+            }
+        }
+
+        m_previousPixelsValid = true;
+
+        // Forget the copies of textures that weren't drawn, they might no longer exist
+        for (auto it = m_textureImages.begin(); it != m_textureImages.end();)
+        {
+            if (it->second.used)
+            {
+                it->second.used = false;
+                ++it;
+            }
+            else
+                it = m_textureImages.erase(it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::renderVertices(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        if (m_clipAreas.empty() || (m_clipAreas.back().width <= 0) || (m_clipAreas.back().height <= 0))
+            return;
+
+        const TextureImage* texture = nullptr;
+        if (states.texture)
+        {
+            texture = &getTextureImage(*states.texture);
+            if ((texture->size.x == 0) || (texture->size.y == 0))
+                return;
+        }
+
+        const sf::Transform transform = m_viewTransform * states.transform;
+        m_transformedVertices.assign(vertices, vertices + vertexCount);
+        for (auto& vertex : m_transformedVertices)
+            vertex.position = transform.transformPoint(vertex.position);
+
+        const sf::Vertex* v = m_transformedVertices.data();
+        switch (type)
+        {
+            case sf::PrimitiveType::Triangles:
+                for (std::size_t i = 2; i < vertexCount; i += 3)
+                    rasterizeTriangle(v[i-2], v[i-1], v[i], texture);
+                break;
+
+            case sf::PrimitiveType::TrianglesStrip:
+                for (std::size_t i = 2; i < vertexCount; ++i)
+                    rasterizeTriangle(v[i-2], v[i-1], v[i], texture);
+                break;
+
+            case sf::PrimitiveType::TrianglesFan:
+                for (std::size_t i = 2; i < vertexCount; ++i)
+                    rasterizeTriangle(v[0], v[i-1], v[i], texture);
+                break;
+
+            case sf::PrimitiveType::Quads:
+                for (std::size_t i = 3; i < vertexCount; i += 4)
+                {
+                    rasterizeTriangle(v[i-3], v[i-2], v[i-1], texture);
+                    rasterizeTriangle(v[i-3], v[i-1], v[i], texture);
+                }
+                break;
+
+            default: // Points and lines are never used by the widgets
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::renderText(const sf::Text& text, const sf::RenderStates& states)
+    {
+        const sf::Font* font = text.getFont();
+        const sf::String& string = text.getString();
+        if (!font || string.isEmpty())
+            return;
+
+        const unsigned int characterSize = text.getCharacterSize();
+        m_glyphKeys.clear();
+
+        // Build the glyph quads the same way as sf::Text does
+        const bool bold = (text.getStyle() & sf::Text::Bold) != 0;
+        const bool underlined = (text.getStyle() & sf::Text::Underlined) != 0;
+        const bool strikeThrough = (text.getStyle() & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (text.getStyle() & sf::Text::Italic) ? 0.209f : 0.f;
+        const float underlineOffset = font->getUnderlinePosition(characterSize);
+        const float underlineThickness = font->getUnderlineThickness(characterSize);
+
+        const sf::FloatRect xBounds = font->getGlyph(U'x', characterSize, bold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+
+        float whitespaceWidth = font->getGlyph(U' ', characterSize, bold).advance;
+        const float letterSpacing = (whitespaceWidth / 3.f) * (text.getLetterSpacing() - 1.f);
+        whitespaceWidth += letterSpacing;
+        const float lineSpacing = font->getLineSpacing(characterSize) * text.getLineSpacing();
+
+        const float outlineThickness = text.getOutlineThickness();
+        const sf::Color fillColor = text.getFillColor();
+        const sf::Color outlineColor = text.getOutlineColor();
+
+        std::vector<sf::Vertex> fillVertices;
+        std::vector<sf::Vertex> outlineVertices;
+        const auto addLines = [&](float lineLength, float lineTop){
+            if (underlined)
+            {
+                addTextLine(fillVertices, lineLength, lineTop, fillColor, underlineOffset, underlineThickness, 0);
+                if (outlineThickness != 0)
+                    addTextLine(outlineVertices, lineLength, lineTop, outlineColor, underlineOffset, underlineThickness, outlineThickness);
+            }
+            if (strikeThrough)
+            {
+                addTextLine(fillVertices, lineLength, lineTop, fillColor, strikeThroughOffset, underlineThickness, 0);
+                if (outlineThickness != 0)
+                    addTextLine(outlineVertices, lineLength, lineTop, outlineColor, strikeThroughOffset, underlineThickness, outlineThickness);
+            }
+        };
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        std::uint32_t prevChar = 0;
+        for (const std::uint32_t curChar : string)
+        {
+            if (curChar == U'\r')
+                continue;
+
+            x += font->getKerning(prevChar, curChar, characterSize);
+
+            if ((curChar == U'\n') && (prevChar != U'\n') && (x > 0))
+                addLines(x, y);
+
+            prevChar = curChar;
+
+            if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+            {
+                if (curChar == U' ')
+                    x += whitespaceWidth;
+                else if (curChar == U'\t')
+                    x += whitespaceWidth * 4;
+                else
+                {
+                    y += lineSpacing;
+                    x = 0;
+                }
+
+                continue;
+            }
+
+            if (outlineThickness != 0)
+            {
+                m_glyphKeys.push_back(getGlyphKey(curChar, bold, outlineThickness));
+                addGlyphQuad(outlineVertices, {x, y}, outlineColor, font->getGlyph(curChar, characterSize, bold, outlineThickness), italicShear);
+            }
+
+            m_glyphKeys.push_back(getGlyphKey(curChar, bold, 0));
+
+            const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, bold);
+            addGlyphQuad(fillVertices, {x, y}, fillColor, glyph, italicShear);
+            x += glyph.advance + letterSpacing;
+        }
+
+        if (x > 0)
+            addLines(x, y);
+
+        // Requesting the glyphs may have added them to the texture or even replaced the texture with a larger one, so the
+        // texture is only looked up now. A glyph that wasn't in the texture when we copied it means that the copy is outdated.
+        const sf::Texture& fontTexture = font->getTexture(characterSize);
+        TextureImage& textureImage = findTextureImage(fontTexture);
+        for (const auto glyphKey : m_glyphKeys)
+        {
+            if (textureImage.glyphs.insert(glyphKey).second)
+                textureImage.outdated = true;
+        }
+
+        sf::RenderStates textStates = states;
+        textStates.transform *= text.getTransform();
+        textStates.texture = &fontTexture;
+
+        if (!outlineVertices.empty())
+            renderVertices(outlineVertices.data(), outlineVertices.size(), sf::PrimitiveType::Triangles, textStates);
+        if (!fillVertices.empty())
+            renderVertices(fillVertices.data(), fillVertices.size(), sf::PrimitiveType::Triangles, textStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::pushClipArea(const FloatRect& rect)
+    {
+        const sf::IntRect& previous = m_clipAreas.empty() ? sf::IntRect{0, 0, static_cast<int>(m_size.x), static_cast<int>(m_size.y)} : m_clipAreas.back();
+
+        const Vector2f topLeft = m_viewTransform.transformPoint({rect.left, rect.top});
+        const Vector2f bottomRight = m_viewTransform.transformPoint({rect.left + rect.width, rect.top + rect.height});
+
+        const int left = std::max(previous.left, toInt(std::round(std::min(topLeft.x, bottomRight.x))));
+        const int top = std::max(previous.top, toInt(std::round(std::min(topLeft.y, bottomRight.y))));
+        const int right = std::min(previous.left + previous.width, toInt(std::round(std::max(topLeft.x, bottomRight.x))));
+        const int bottom = std::min(previous.top + previous.height, toInt(std::round(std::max(topLeft.y, bottomRight.y))));
+        m_clipAreas.emplace_back(left, top, std::max(0, right - left), std::max(0, bottom - top));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::popClipArea()
+    {
+        if (m_clipAreas.size() > 1)
+            m_clipAreas.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::invalidateTexture(const sf::Texture& texture)
+    {
+        const auto it = m_textureImages.find({&texture, texture.getNativeHandle(), texture.getSize()});
+        if (it != m_textureImages.end())
+            it->second.outdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SoftwareRenderer::TextureImage& SoftwareRenderer::findTextureImage(const sf::Texture& texture)
+    {
+        TextureImage& textureImage = m_textureImages[{&texture, texture.getNativeHandle(), texture.getSize()}];
+        textureImage.used = true;
+        return textureImage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const SoftwareRenderer::TextureImage& SoftwareRenderer::getTextureImage(const sf::Texture& texture)
+    {
+        TextureImage& textureImage = findTextureImage(texture);
+        if (textureImage.outdated)
+        {
+            textureImage.image = texture.copyToImage();
+            textureImage.size = textureImage.image.getSize();
+            textureImage.smooth = texture.isSmooth();
+            textureImage.repeated = texture.isRepeated();
+            textureImage.outdated = false;
+        }
+
+        return textureImage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderer::rasterizeTriangle(const sf::Vertex& v0, const sf::Vertex& v1, const sf::Vertex& v2, const TextureImage* texture)
+    {
+        const float x0 = v0.position.x;
+        const float y0 = v0.position.y;
+        const float x1 = v1.position.x;
+        const float y1 = v1.position.y;
+        const float x2 = v2.position.x;
+        const float y2 = v2.position.y;
+
+        const float area = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+        if (area == 0)
+            return;
+
+        // A pixel is covered when its center lies inside the triangle. Pixels with their center on the bottom or right edge
+        // are left to the neighbouring triangle, so that the triangles of a strip never blend the same pixel twice.
+        const sf::IntRect& clipArea = m_clipAreas.back();
+        const int minY = std::max(clipArea.top, toInt(std::ceil(std::min({y0, y1, y2}) - 0.5f)));
+        const int maxY = std::min(clipArea.top + clipArea.height, toInt(std::ceil(std::max({y0, y1, y2}) - 0.5f)));
+        if (minY >= maxY)
+            return;
+
+        const bool uniformColor = !texture && (v0.color == v1.color) && (v0.color == v2.color);
+        if (uniformColor && (v0.color.a == 0))
+            return;
+
+        const sf::Vertex* edges[3][2] = {{&v0, &v1}, {&v1, &v2}, {&v2, &v0}};
+        const float weight1StepX = (y2 - y0) / area;
+        const float weight2StepX = -(y1 - y0) / area;
+        for (int y = minY; y < maxY; ++y)
+        {
+            const float centerY = y + 0.5f;
+
+            float spanLeft = std::numeric_limits<float>::max();
+            float spanRight = std::numeric_limits<float>::lowest();
+            for (const auto& edge : edges)
+            {
+                const Vector2f a = edge[0]->position;
+                const Vector2f b = edge[1]->position;
+                if (((a.y <= centerY) && (centerY < b.y)) || ((b.y <= centerY) && (centerY < a.y)))
+                {
+                    const float x = a.x + (centerY - a.y) * (b.x - a.x) / (b.y - a.y);
+                    spanLeft = std::min(spanLeft, x);
+                    spanRight = std::max(spanRight, x);
+                }
+            }
+
+            const int startX = std::max(clipArea.left, toInt(std::ceil(spanLeft - 0.5f)));
+            const int endX = std::min(clipArea.left + clipArea.width, toInt(std::ceil(spanRight - 0.5f)));
+            if (startX >= endX)
+                continue;
+
+            std::uint8_t* pixel = &m_pixels[(static_cast<std::size_t>(y) * m_size.x + static_cast<std::size_t>(startX)) * 4];
+            if (uniformColor)
+            {
+                blendSpan(pixel, static_cast<std::size_t>(endX - startX), v0.color);
+                continue;
+            }
+
+            // The barycentric weights change linearly along the row
+            const float centerX = startX + 0.5f;
+            float weight1 = ((centerX - x0) * (y2 - y0) - (x2 - x0) * (centerY - y0)) / area;
+            float weight2 = ((x1 - x0) * (centerY - y0) - (centerX - x0) * (y1 - y0)) / area;
+            for (int x = startX; x < endX; ++x, pixel += 4, weight1 += weight1StepX, weight2 += weight2StepX)
+            {
+                const float weight0 = 1 - weight1 - weight2;
+                float color[4] = {v0.color.r * weight0 + v1.color.r * weight1 + v2.color.r * weight2,
+                                  v0.color.g * weight0 + v1.color.g * weight1 + v2.color.g * weight2,
+                                  v0.color.b * weight0 + v1.color.b * weight1 + v2.color.b * weight2,
+                                  v0.color.a * weight0 + v1.color.a * weight1 + v2.color.a * weight2};
+
+                if (texture)
+                {
+                    const float u = v0.texCoords.x * weight0 + v1.texCoords.x * weight1 + v2.texCoords.x * weight2;
+                    const float v = v0.texCoords.y * weight0 + v1.texCoords.y * weight1 + v2.texCoords.y * weight2;
+
+                    float texel[4];
+                    sampleTexture(texture->image, texture->size, texture->smooth, texture->repeated, u, v, texel);
+                    for (unsigned int i = 0; i < 4; ++i)
+                        color[i] = color[i] * texel[i] / 255.f;
+                }
+
+                unsigned int channels[4];
+                for (unsigned int i = 0; i < 4; ++i)
+                    channels[i] = static_cast<unsigned int>(std::max(0.f, std::min(255.f, color[i] + 0.5f)));
+
+                if (channels[3] > 0)
+                    blendPixel(pixel, channels[0], channels[1], channels[2], channels[3]);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
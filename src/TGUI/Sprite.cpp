@@ -26,6 +26,8 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -458,7 +460,10 @@ namespace tgui
             states.texture = &m_texture.getData()->texture;
 
         states.shader = m_shader;
-        target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+
+        TGUI_PROFILE_COUNT(DrawCalls);
+        TGUI_PROFILE_COUNT(TextureBinds);
+        RenderBackend::drawVertices(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
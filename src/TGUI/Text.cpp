@@ -24,14 +24,193 @@
 
 
 #include <TGUI/Text.hpp>
+#include <TGUI/DistanceFieldAtlas.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <unordered_map>
+#include <cstring>
 #include <cmath>
+#include <mutex>
+#include <list>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Longer strings (e.g. the contents of a text box) are rarely shown twice and would only push useful layouts out of the cache
+        const std::size_t maxCachedTextLayoutLength = 256;
+
+        struct TextLayoutKey
+        {
+            sf::String string;
+            const sf::Font* font;
+            unsigned int characterSize;
+            std::uint32_t style;
+            float wrapWidth;
+            bool dropLeadingSpace;
+        };
+
+        struct TextLayoutKeyHasher
+        {
+            std::size_t operator()(const TextLayoutKey* key) const
+            {
+                // FNV-1a hash
+                std::size_t hash = 2166136261u;
+                const auto combine = [&hash](std::size_t value){ hash ^= value; hash *= 16777619u; };
+
+                const sf::Uint32* data = key->string.getData();
+                for (std::size_t i = 0; i < key->string.getSize(); ++i)
+                    combine(data[i]);
+
+                std::uint32_t wrapWidthBits;
+                std::memcpy(&wrapWidthBits, &key->wrapWidth, sizeof(wrapWidthBits));
+
+                combine(reinterpret_cast<std::size_t>(key->font));
+                combine(key->characterSize);
+                combine(key->style);
+                combine(wrapWidthBits);
+                combine(key->dropLeadingSpace);
+                return hash;
+            }
+        };
+
+        struct TextLayoutKeyEqual
+        {
+            bool operator()(const TextLayoutKey* left, const TextLayoutKey* right) const
+            {
+                return (left->font == right->font)
+                    && (left->characterSize == right->characterSize)
+                    && (left->style == right->style)
+                    && (left->wrapWidth == right->wrapWidth)
+                    && (left->dropLeadingSpace == right->dropLeadingSpace)
+                    && (left->string == right->string);
+            }
+        };
+
+        // Least recently used cache of layout results. The font is tracked by a weak pointer so that a layout is never returned
+        // for a different font that happens to be allocated at the address of a font that no longer exists.
+        template <typename ValueType>
+        class TextLayoutCache
+        {
+        public:
+
+            bool find(const TextLayoutKey& key, ValueType& value)
+            {
+                const auto it = m_lookup.find(&key);
+                if (it == m_lookup.end())
+                    return false;
+
+                const auto entryIt = it->second;
+                if (entryIt->font.expired())
+                {
+                    m_lookup.erase(it);
+                    m_entries.erase(entryIt);
+                    return false;
+                }
+
+                m_entries.splice(m_entries.begin(), m_entries, entryIt);
+                value = entryIt->value;
+                return true;
+            }
+
+            void insert(TextLayoutKey&& key, const std::shared_ptr<sf::Font>& font, const ValueType& value)
+            {
+                if (m_capacity == 0)
+                    return;
+
+                const auto it = m_lookup.find(&key);
+                if (it != m_lookup.end())
+                {
+                    m_entries.erase(it->second);
+                    m_lookup.erase(it);
+                }
+
+                while (m_entries.size() >= m_capacity)
+                {
+                    m_lookup.erase(&m_entries.back().key);
+                    m_entries.pop_back();
+                }
+
+                m_entries.push_front({std::move(key), font, value});
+                m_lookup[&m_entries.front().key] = m_entries.begin();
+            }
+
+            void setCapacity(std::size_t capacity)
+            {
+                m_capacity = capacity;
+                while (m_entries.size() > m_capacity)
+                {
+                    m_lookup.erase(&m_entries.back().key);
+                    m_entries.pop_back();
+                }
+            }
+
+            void clear()
+            {
+                m_lookup.clear();
+                m_entries.clear();
+            }
+
+        private:
+
+            struct Entry
+            {
+                TextLayoutKey key;
+                std::weak_ptr<sf::Font> font;
+                ValueType value;
+            };
+
+            std::list<Entry> m_entries; // Most recently used entries are in front
+            std::unordered_map<const TextLayoutKey*, typename std::list<Entry>::iterator, TextLayoutKeyHasher, TextLayoutKeyEqual> m_lookup;
+            std::size_t m_capacity = 4096;
+        };
+
+        struct TextLayoutCaches
+        {
+            std::mutex mutex;
+            std::size_t capacity = 4096;
+            TextLayoutCache<Vector2f> sizes;
+            TextLayoutCache<sf::String> wrappedStrings;
+        };
+
+        TextLayoutCaches& getTextLayoutCaches()
+        {
+            static TextLayoutCaches caches;
+            return caches;
+        }
+
+        bool distanceFieldRenderingEnabled = false;
+
+        // Returns the atlas from which the glyph metrics are taken in distance field mode, after adding the characters to it
+        std::shared_ptr<DistanceFieldAtlas> getLayoutDistanceFieldAtlas(const Font& font, const sf::String& string, bool bold)
+        {
+            if (!distanceFieldRenderingEnabled)
+                return nullptr;
+
+            auto atlas = DistanceFieldAtlas::getAtlas(font.getFont());
+            if (atlas)
+            {
+                atlas->addGlyphs(string, bold);
+                atlas->addGlyphs(" ", bold);
+            }
+
+            return atlas;
+        }
+
+        // Returns the advance of a glyph without rasterizing the glyph at the requested size when a distance field atlas is used
+        float getLayoutGlyphAdvance(const Font& font, DistanceFieldAtlas* atlas, std::uint32_t codePoint, unsigned int characterSize, bool bold)
+        {
+            if (atlas)
+                return atlas->getGlyph(codePoint, bold).advance * characterSize / DistanceFieldAtlas::BaseCharacterSize;
+            else
+                return static_cast<float>(font.getGlyph(codePoint, characterSize, bold).advance);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::getSize() const
@@ -74,6 +253,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
+        m_distanceFieldVerticesValid = false;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
@@ -94,6 +274,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
+        m_distanceFieldVerticesValid = false;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
@@ -182,26 +363,68 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        // Distance fields require a shader, which render backends don't support
+        if (distanceFieldRenderingEnabled && m_font && DistanceFieldAtlas::isAvailable() && !RenderBackend::getActive())
+        {
+            if (!m_distanceFieldVerticesValid)
+                updateDistanceFieldVertices();
+
+            if (m_distanceFieldVertices.empty())
+                return;
+
+            states.texture = &m_distanceFieldAtlas->getTexture();
+            states.shader = DistanceFieldAtlas::getShader();
+
+            TGUI_PROFILE_COUNT(DrawCalls);
+            TGUI_PROFILE_COUNT(TextureBinds);
+
+            // The atlas is shared with texts on other threads, which could be adding glyphs to the texture
+            std::lock_guard<std::mutex> lock{m_distanceFieldAtlas->getMutex()};
+            target.draw(m_distanceFieldVertices.data(), m_distanceFieldVertices.size(), sf::Triangles, states);
+            return;
+        }
+
+        TGUI_PROFILE_COUNT(DrawCalls);
+        TGUI_PROFILE_COUNT(TextureBinds);
+        RenderBackend::drawText(target, m_text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::recalculateSize()
     {
+        m_distanceFieldVerticesValid = false;
+
         if (m_font == nullptr)
         {
             m_size = {0, 0};
             return;
         }
 
+        const sf::String& string = m_text.getString();
+        const std::shared_ptr<sf::Font> font = m_font.getFont();
+
+        TextLayoutKey key;
+        auto& caches = getTextLayoutCaches();
+        const bool cacheable = (string.getSize() <= maxCachedTextLayoutLength);
+        if (cacheable)
+        {
+            key = {string, font.get(), m_text.getCharacterSize(), m_text.getStyle(), -1, false};
+
+            std::lock_guard<std::mutex> lock(caches.mutex);
+            if (caches.sizes.find(key, m_size))
+                return;
+        }
+
+        TGUI_PROFILE_COUNT(TextLayouts);
+
         float width = 0;
         float maxWidth = 0;
         unsigned int lines = 1;
         std::uint32_t prevChar = 0;
-        const sf::String& string = m_text.getString();
         const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
         const unsigned int textSize = m_text.getCharacterSize();
+        const auto atlas = getLayoutDistanceFieldAtlas(m_font, string, bold);
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
             const float kerning = m_font.getKerning(prevChar, string[i], textSize);
@@ -212,9 +435,9 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(m_font.getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (getLayoutGlyphAdvance(m_font, atlas.get(), ' ', textSize, bold) * 4) + kerning;
             else
-                width += static_cast<float>(m_font.getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += getLayoutGlyphAdvance(m_font, atlas.get(), string[i], textSize, bold) + kerning;
 
             prevChar = string[i];
         }
@@ -222,6 +445,12 @@ namespace tgui
         const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
         const float height = lines * m_font.getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
         m_size = {std::max(maxWidth, width), height};
+
+        if (cacheable)
+        {
+            std::lock_guard<std::mutex> lock(caches.mutex);
+            caches.sizes.insert(std::move(key), font, m_size);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -316,6 +545,7 @@ namespace tgui
             return 0.0f;
 
         bool bold = (textStyle & sf::Text::Bold) != 0;
+        const auto atlas = getLayoutDistanceFieldAtlas(font, text, bold);
 
         float width = 0.0f;
         std::uint32_t prevChar = 0;
@@ -326,9 +556,9 @@ namespace tgui
             if (curChar == '\n')
                 break;
             else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
+                charWidth = getLayoutGlyphAdvance(font, atlas.get(), ' ', characterSize, bold) * 4.0f;
             else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
+                charWidth = getLayoutGlyphAdvance(font, atlas.get(), curChar, characterSize, bold);
 
             const float kerning = font.getKerning(prevChar, curChar, characterSize);
 
@@ -388,9 +618,19 @@ namespace tgui
         const bool bold = (style & sf::Text::Bold) != 0;
 
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getGlyph('g', characterSize, bold).bounds.top;
+        float lineHeight;
+        const auto atlas = getLayoutDistanceFieldAtlas(font, "g", bold);
+        if (atlas)
+        {
+            const sf::FloatRect& bounds = atlas->getGlyph('g', bold).bounds;
+            lineHeight = characterSize + (bounds.height + bounds.top - DistanceFieldAtlas::Spread) * characterSize / DistanceFieldAtlas::BaseCharacterSize;
+        }
+        else
+        {
+            lineHeight = characterSize
+                         + font.getGlyph('g', characterSize, bold).bounds.height
+                         + font.getGlyph('g', characterSize, bold).bounds.top;
+        }
 
         // Get the line spacing sfml returns
         const float lineSpacing = font.getLineSpacing(characterSize);
@@ -406,6 +646,21 @@ namespace tgui
         if (font == nullptr)
             return "";
 
+        TextLayoutKey key;
+        auto& caches = getTextLayoutCaches();
+        const bool cacheable = (text.getSize() <= maxCachedTextLayoutLength);
+        if (cacheable)
+        {
+            key = {text, font.getFont().get(), textSize, bold ? sf::Text::Bold : sf::Text::Regular, maxWidth, dropLeadingSpace};
+
+            sf::String cachedResult;
+            std::lock_guard<std::mutex> lock(caches.mutex);
+            if (caches.wrappedStrings.find(key, cachedResult))
+                return cachedResult;
+        }
+
+        const auto atlas = getLayoutDistanceFieldAtlas(font, text, bold);
+
         sf::String result;
         std::size_t index = 0;
         while (index < text.getSize())
@@ -425,9 +680,9 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
+                    charWidth = getLayoutGlyphAdvance(font, atlas.get(), ' ', textSize, bold) * 4;
                 else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
+                    charWidth = getLayoutGlyphAdvance(font, atlas.get(), curChar, textSize, bold);
 
                 const float kerning = font.getKerning(prevChar, curChar, textSize);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
@@ -483,10 +738,168 @@ namespace tgui
                 result += "\n";
         }
 
+        if (cacheable)
+        {
+            std::lock_guard<std::mutex> lock(caches.mutex);
+            caches.wrappedStrings.insert(std::move(key), font.getFont(), result);
+        }
+
         return result;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::setLayoutCacheCapacity(std::size_t capacity)
+    {
+        auto& caches = getTextLayoutCaches();
+        std::lock_guard<std::mutex> lock(caches.mutex);
+        caches.capacity = capacity;
+        caches.sizes.setCapacity(capacity);
+        caches.wrappedStrings.setCapacity(capacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Text::getLayoutCacheCapacity()
+    {
+        auto& caches = getTextLayoutCaches();
+        std::lock_guard<std::mutex> lock(caches.mutex);
+        return caches.capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::clearLayoutCache()
+    {
+        auto& caches = getTextLayoutCaches();
+        std::lock_guard<std::mutex> lock(caches.mutex);
+        caches.sizes.clear();
+        caches.wrappedStrings.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::setDistanceFieldRendering(bool enabled)
+    {
+        if (distanceFieldRenderingEnabled == enabled)
+            return;
+
+        // The glyph metrics differ slightly between both modes, so the cached layouts can no longer be used
+        distanceFieldRenderingEnabled = enabled;
+        clearLayoutCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Text::isDistanceFieldRenderingEnabled()
+    {
+        return distanceFieldRenderingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::updateDistanceFieldVertices() const
+    {
+        m_distanceFieldVertices.clear();
+        m_distanceFieldVerticesValid = true;
+
+        m_distanceFieldAtlas = DistanceFieldAtlas::getAtlas(m_font.getFont());
+        if (!m_distanceFieldAtlas)
+            return;
+
+        const sf::String& string = m_text.getString();
+        const TextStyle style = m_text.getStyle();
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const bool underlined = (style & sf::Text::Underlined) != 0;
+        const bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees, the same as sf::Text
+
+        m_distanceFieldAtlas->addGlyphs(string, bold);
+        m_distanceFieldAtlas->addGlyphs(" x", bold);
+
+        const unsigned int characterSize = m_text.getCharacterSize();
+        const float scale = static_cast<float>(characterSize) / DistanceFieldAtlas::BaseCharacterSize;
+        const float whitespaceWidth = m_distanceFieldAtlas->getGlyph(' ', bold).advance * scale;
+        const float lineSpacing = m_font.getLineSpacing(characterSize);
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+
+        const std::shared_ptr<sf::Font> font = m_font.getFont();
+        const float underlineOffset = font->getUnderlinePosition(characterSize);
+        const float lineThickness = font->getUnderlineThickness(characterSize);
+        const sf::FloatRect& xBounds = m_distanceFieldAtlas->getGlyph('x', bold).bounds;
+        const float strikeThroughOffset = (xBounds.top + xBounds.height / 2.f) * scale;
+
+        const auto addQuad = [this,color](float left, float top, float right, float bottom, float shearTop, float shearBottom, sf::FloatRect texRect)
+            {
+                const sf::Vertex topLeft{{left - shearTop, top}, color, {texRect.left, texRect.top}};
+                const sf::Vertex topRight{{right - shearTop, top}, color, {texRect.left + texRect.width, texRect.top}};
+                const sf::Vertex bottomLeft{{left - shearBottom, bottom}, color, {texRect.left, texRect.top + texRect.height}};
+                const sf::Vertex bottomRight{{right - shearBottom, bottom}, color, {texRect.left + texRect.width, texRect.top + texRect.height}};
+                m_distanceFieldVertices.insert(m_distanceFieldVertices.end(), {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight});
+            };
+
+        const sf::FloatRect solidRect = m_distanceFieldAtlas->getSolidTextureRect();
+        const auto addLine = [&](float lineLength, float lineTop, float offset)
+            {
+                const float top = std::floor(lineTop + offset - (lineThickness / 2) + 0.5f);
+                addQuad(0, top, lineLength, top + lineThickness, 0, 0, solidRect);
+            };
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            if (curChar == '\r')
+                continue;
+
+            x += m_font.getKerning(prevChar, curChar, characterSize);
+
+            if ((curChar == '\n') && (prevChar != '\n'))
+            {
+                if (underlined)
+                    addLine(x, y, underlineOffset);
+                if (strikeThrough)
+                    addLine(x, y, strikeThroughOffset);
+            }
+
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                x += whitespaceWidth;
+            else if (curChar == '\t')
+                x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+            }
+            else
+            {
+                const DistanceFieldAtlas::Glyph& glyph = m_distanceFieldAtlas->getGlyph(curChar, bold);
+                if (glyph.textureRect.width > 0)
+                {
+                    const float top = glyph.bounds.top * scale;
+                    const float bottom = (glyph.bounds.top + glyph.bounds.height) * scale;
+                    addQuad(x + glyph.bounds.left * scale, y + top, x + (glyph.bounds.left + glyph.bounds.width) * scale, y + bottom,
+                            italicShear * top, italicShear * bottom, sf::FloatRect{glyph.textureRect});
+                }
+
+                x += glyph.advance * scale;
+            }
+        }
+
+        if (x > 0)
+        {
+            if (underlined)
+                addLine(x, y, underlineOffset);
+            if (strikeThrough)
+                addLine(x, y, strikeThroughOffset);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
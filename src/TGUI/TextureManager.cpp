@@ -32,11 +32,16 @@
 namespace tgui
 {
     std::map<sf::String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::mutex TextureManager::m_imageMapMutex;
+    std::map<sf::String, std::unique_ptr<sf::Image>> TextureManager::m_preloadedImages;
+    std::mutex TextureManager::m_preloadedImagesMutex;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const sf::String& filename, const sf::IntRect& partRect)
     {
+        std::lock_guard<std::mutex> imageMapLock{m_imageMapMutex};
+
         // Look if we already had this image
         auto imageIt = m_imageMap.find(filename);
         if (imageIt != m_imageMap.end())
@@ -85,7 +90,32 @@ namespace tgui
         }
         else // Not an svg
         {
-            data->image = texture.getImageLoader()(filename);
+            // Use the image that was decoded in advance or that was already loaded for a different part rect when available
+            {
+                std::lock_guard<std::mutex> preloadedImagesLock{m_preloadedImagesMutex};
+                auto preloadedIt = m_preloadedImages.find(filename);
+                if (preloadedIt != m_preloadedImages.end())
+                {
+                    data->image = std::move(preloadedIt->second);
+                    m_preloadedImages.erase(preloadedIt);
+                }
+            }
+
+            if (!data->image)
+            {
+                for (const auto& otherDataHolder : imageIt->second)
+                {
+                    if (otherDataHolder.data->image)
+                    {
+                        data->image = std::make_unique<sf::Image>(*otherDataHolder.data->image);
+                        break;
+                    }
+                }
+            }
+
+            if (!data->image)
+                data->image = texture.getImageLoader()(filename);
+
             if (data->image != nullptr)
             {
                 // Create a texture from the image
@@ -118,6 +148,8 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
+        std::lock_guard<std::mutex> lock{m_imageMapMutex};
+
         // Loop all our textures to check if we already have this one
         for (auto& dataHolder : m_imageMap)
         {
@@ -140,6 +172,8 @@ namespace tgui
 
     void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
     {
+        std::lock_guard<std::mutex> lock{m_imageMapMutex};
+
         // Loop all our textures to check which one it is
         for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
         {
@@ -165,6 +199,22 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addPreloadedImage(const sf::String& filename, std::unique_ptr<sf::Image> image)
+    {
+        std::lock_guard<std::mutex> lock{m_preloadedImagesMutex};
+        m_preloadedImages[filename] = std::move(image);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removePreloadedImages()
+    {
+        std::lock_guard<std::mutex> lock{m_preloadedImagesMutex};
+        m_preloadedImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,8 +26,11 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/Context.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
@@ -39,24 +42,28 @@ namespace tgui
 
     namespace
     {
-        void addAnimation(std::vector<std::shared_ptr<priv::Animation>>& existingAnimations, std::shared_ptr<priv::Animation> newAnimation)
+        // Only overlays need to be merged with their base data, other renderer data is used without making a copy
+        const std::map<std::string, ObjectConverter>& getRendererDataProperties(const RendererData& data, std::map<std::string, ObjectConverter>& mergedProperties)
         {
-            const auto type = newAnimation->getType();
+            if (!data.base)
+                return data.propertyValuePairs;
 
-            // If another animation is already running with the same type then instantly finish it
-            unsigned int i = 0;
-            while (i < existingAnimations.size())
-            {
-                if (existingAnimations[i]->getType() == type)
-                {
-                    existingAnimations[i]->finish();
-                    existingAnimations.erase(existingAnimations.begin() + i);
-                }
-                else
-                    ++i;
-            }
+            mergedProperties = data.getAllPropertyValuePairs();
+            return mergedProperties;
+        }
+
+        // Widgets inside a gui are animated by the tween engine of the gui, other widgets use the engine of the current context.
+        // That context is remembered, as the widget could later be added to a gui that uses a different context.
+        TweenEngine& getWidgetTweenEngine(Widget* widget, std::weak_ptr<Context>& tweenContext)
+        {
+            while (widget->getParent())
+                widget = widget->getParent();
 
-            existingAnimations.push_back(newAnimation);
+            if (auto guiContainer = dynamic_cast<GuiContainer*>(widget))
+                return guiContainer->getTweenEngine();
+
+            tweenContext = Context::getCurrent();
+            return Context::getCurrent()->getTweenEngine();
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,11 +132,17 @@ namespace tgui
         if (m_renderer)
             m_renderer->unsubscribe(this);
 
-        for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+        if (m_boundPositionLayouts)
+        {
+            for (auto& layout : *m_boundPositionLayouts)
+                layout->unbindWidget(this);
+        }
 
-        for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+        if (m_boundSizeLayouts)
+        {
+            for (auto& layout : *m_boundSizeLayouts)
+                layout->unbindWidget(this);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,7 +162,6 @@ namespace tgui
         m_containerWidget              {other.m_containerWidget},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
@@ -188,7 +200,6 @@ namespace tgui
         m_containerWidget              {std::move(other.m_containerWidget)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)}
     {
@@ -224,8 +235,8 @@ namespace tgui
             m_type                 = other.m_type;
             m_position             = other.m_position;
             m_size                 = other.m_size;
-            m_boundPositionLayouts = {};
-            m_boundSizeLayouts     = {};
+            m_boundPositionLayouts = nullptr;
+            m_boundSizeLayouts     = nullptr;
             m_enabled              = other.m_enabled;
             m_visible              = other.m_visible;
             m_parent               = nullptr;
@@ -237,10 +248,11 @@ namespace tgui
             m_containerWidget      = other.m_containerWidget;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
-            m_showAnimations       = {};
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
 
+            m_absolutePositionCached = false;
+
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
@@ -286,10 +298,11 @@ namespace tgui
             m_containerWidget      = std::move(other.m_containerWidget);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
-            m_showAnimations       = std::move(other.m_showAnimations);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
 
+            m_absolutePositionCached = false;
+
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
@@ -310,6 +323,8 @@ namespace tgui
         if (rendererData == nullptr)
             rendererData = RendererData::create();
 
+        TGUI_PROFILE_SCOPE(RendererChanged, "Widget::setRenderer");
+
         std::shared_ptr<RendererData> oldData = m_renderer->getData();
 
         // Update the data
@@ -318,10 +333,17 @@ namespace tgui
         m_renderer->subscribe(this, m_rendererChangedCallback);
         rendererData->shared = true;
 
+        invalidateAbsolutePosition();
+
         // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
+        std::map<std::string, ObjectConverter> oldMergedProperties;
+        std::map<std::string, ObjectConverter> newMergedProperties;
+        const auto& oldProperties = getRendererDataProperties(*oldData, oldMergedProperties);
+        const auto& newProperties = getRendererDataProperties(*rendererData, newMergedProperties);
+
+        auto oldIt = oldProperties.begin();
+        auto newIt = newProperties.begin();
+        while (oldIt != oldProperties.end() && newIt != newProperties.end())
         {
             if (oldIt->first < newIt->first)
             {
@@ -343,12 +365,12 @@ namespace tgui
                 }
             }
         }
-        while (oldIt != oldData->propertyValuePairs.end())
+        while (oldIt != oldProperties.end())
         {
             rendererChanged(oldIt->first);
             ++oldIt;
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+        while (newIt != newProperties.end())
         {
             rendererChanged(newIt->first);
             ++newIt;
@@ -377,9 +399,8 @@ namespace tgui
         if (m_renderer->getData()->shared)
         {
             m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
+            m_renderer->setData(RendererData::createOverlay(m_renderer->getData()));
             m_renderer->subscribe(this, m_rendererChangedCallback);
-            m_renderer->getData()->shared = false;
         }
 
         // You should not be allowed to call setters on the renderer when the widget is const
@@ -393,9 +414,8 @@ namespace tgui
         if (m_renderer->getData()->shared)
         {
             m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
+            m_renderer->setData(RendererData::createOverlay(m_renderer->getData()));
             m_renderer->subscribe(this, m_rendererChangedCallback);
-            m_renderer->getData()->shared = false;
         }
 
         return m_renderer.get();
@@ -412,10 +432,14 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
+            invalidateAbsolutePosition();
             onPositionChange.emit(this, getPosition());
 
-            for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+            if (m_boundPositionLayouts)
+            {
+                for (auto& layout : *m_boundPositionLayouts)
+                    layout->recalculateValue();
+            }
         }
     }
 
@@ -432,8 +456,11 @@ namespace tgui
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            if (m_boundSizeLayouts)
+            {
+                for (auto& layout : *m_boundSizeLayouts)
+                    layout->recalculateValue();
+            }
         }
     }
 
@@ -448,10 +475,17 @@ namespace tgui
 
     Vector2f Widget::getAbsolutePosition() const
     {
-        if (m_parent)
-            return m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + getPosition();
-        else
-            return getPosition();
+        if (!m_absolutePositionCached)
+        {
+            if (m_parent)
+                m_absolutePositionCache = m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + getPosition();
+            else
+                m_absolutePositionCache = getPosition();
+
+            m_absolutePositionCached = true;
+        }
+
+        return m_absolutePositionCache;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,25 +501,27 @@ namespace tgui
     {
         setVisible(true);
 
+        TweenEngine& tweens = getWidgetTweenEngine(this, m_tweenContext);
+
         switch (type)
         {
             case ShowAnimationType::Fade:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, getInheritedOpacity(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                tweens.fadeWidget(shared_from_this(), 0.f, getInheritedOpacity(), duration, Easing::Linear, [=]{onAnimationFinished.emit(this, type, true); });
                 setInheritedOpacity(0);
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                tweens.moveWidget(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration);
+                tweens.resizeWidget(shared_from_this(), Vector2f{0, 0}, getSize(), duration, Easing::Linear, [=]{onAnimationFinished.emit(this, type, true); });
                 setPosition(getPosition() + (getSize() / 2.f));
                 setSize(0, 0);
                 break;
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                tweens.moveWidget(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, Easing::Linear, [=]{onAnimationFinished.emit(this, type, true); });
                 setPosition({-getFullSize().x, getPosition().y});
                 break;
             }
@@ -493,7 +529,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                    tweens.moveWidget(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, Easing::Linear, [=]{onAnimationFinished.emit(this, type, true); });
                     setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
                 }
                 else
@@ -505,7 +541,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                tweens.moveWidget(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, Easing::Linear, [=]{onAnimationFinished.emit(this, type, true); });
                 setPosition({getPosition().x, -getFullSize().y});
                 break;
             }
@@ -513,7 +549,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                    tweens.moveWidget(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, Easing::Linear, [=]{onAnimationFinished.emit(this, type, true); });
                     setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
                 }
                 else
@@ -533,28 +569,30 @@ namespace tgui
         const auto position = getPosition();
         const auto size = getSize();
 
+        TweenEngine& tweens = getWidgetTweenEngine(this, m_tweenContext);
+
         switch (type)
         {
             case ShowAnimationType::Fade:
             {
                 float opacity = getInheritedOpacity();
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), getInheritedOpacity(), 0.f, duration,
-                    [=](){ setVisible(false); setInheritedOpacity(opacity); onAnimationFinished.emit(this, type, false); }));
+                tweens.fadeWidget(shared_from_this(), getInheritedOpacity(), 0.f, duration, Easing::Linear,
+                    [=](){ setVisible(false); setInheritedOpacity(opacity); onAnimationFinished.emit(this, type, false); });
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
-                    [=](){ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); }));
+                tweens.moveWidget(shared_from_this(), position, position + (size / 2.f), duration, Easing::Linear, [=](){ setVisible(false); setPosition(position); setSize(size); });
+                tweens.resizeWidget(shared_from_this(), size, Vector2f{0, 0}, duration, Easing::Linear,
+                    [=](){ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); });
                 break;
             }
             case ShowAnimationType::SlideToRight:
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
-                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                    tweens.moveWidget(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration, Easing::Linear,
+                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 }
                 else
                 {
@@ -565,19 +603,19 @@ namespace tgui
             }
             case ShowAnimationType::SlideToLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
-                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                tweens.moveWidget(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration, Easing::Linear,
+                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 break;
             }
             case ShowAnimationType::SlideToBottom:
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
-                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                    tweens.moveWidget(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration, Easing::Linear,
+                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 }
                 else
-                {
+                {
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToBottom) does not work before widget has a parent.");
                 }
 
@@ -585,8 +623,8 @@ namespace tgui
             }
             case ShowAnimationType::SlideToTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
-                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                tweens.moveWidget(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration, Easing::Linear,
+                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); });
                 break;
             }
         }
@@ -733,6 +771,7 @@ namespace tgui
     void Widget::setParent(Container* parent)
     {
         m_parent = parent;
+        invalidateAbsolutePosition();
 
         // Give the layouts another chance to find widgets to which it refers
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
@@ -747,12 +786,12 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        for (unsigned int i = 0; i < m_showAnimations.size();)
+        // Tweens that were started while the widget wasn't part of a gui aren't advanced by the gui
+        if (const auto tweenContext = m_tweenContext.lock())
         {
-            if (m_showAnimations[i]->update(elapsedTime))
-                m_showAnimations.erase(m_showAnimations.begin() + i);
-            else
-                i++;
+            TweenEngine& tweens = tweenContext->getTweenEngine();
+            if (tweens.getTweenCount() > 0)
+                tweens.updateWidget(this, elapsedTime);
         }
     }
 
@@ -836,28 +875,36 @@ namespace tgui
 
     void Widget::bindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.insert(layout);
+        if (!m_boundPositionLayouts)
+            m_boundPositionLayouts = std::make_unique<std::unordered_set<Layout*>>();
+
+        m_boundPositionLayouts->insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.erase(layout);
+        if (m_boundPositionLayouts)
+            m_boundPositionLayouts->erase(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::bindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.insert(layout);
+        if (!m_boundSizeLayouts)
+            m_boundSizeLayouts = std::make_unique<std::unordered_set<Layout*>>();
+
+        m_boundSizeLayouts->insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.erase(layout);
+        if (m_boundSizeLayouts)
+            m_boundSizeLayouts->erase(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -891,7 +938,7 @@ namespace tgui
             if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
                 m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
             else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
         else if (property == "font")
         {
@@ -1000,7 +1047,7 @@ namespace tgui
                         throw Exception{"ToolTip section contained multiple children."};
 
                     const auto& toolTipWidgetNode = childNode->children[0];
-                    const auto& constructor = WidgetFactory::getConstructFunction(toolTipWidgetNode->name);
+                    const auto constructor = WidgetFactory::getConstructFunction(toolTipWidgetNode->name);
                     if (constructor)
                     {
                         Widget::Ptr toolTip = constructor();
@@ -1041,11 +1088,20 @@ namespace tgui
 
     void Widget::rendererChangedCallback(const std::string& property)
     {
+        TGUI_PROFILE_SCOPE(RendererChanged, "Widget::rendererChanged");
+        invalidateAbsolutePosition();
         rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidateAbsolutePosition()
+    {
+        m_absolutePositionCached = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::drawRectangleShape(sf::RenderTarget& target,
                                     const sf::RenderStates& states,
                                     Vector2f size,
@@ -1058,7 +1114,8 @@ namespace tgui
         else
             shape.setFillColor(color);
 
-        target.draw(shape, states);
+        TGUI_PROFILE_COUNT(DrawCalls);
+        RenderBackend::drawShape(target, shape, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1077,7 +1134,8 @@ namespace tgui
             sf::RectangleShape border;
             border.setFillColor(color);
             border.setSize({size.x, size.y});
-            target.draw(border, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, border, states);
         }
         else // Draw borders in the normal way
         {
@@ -1104,7 +1162,8 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawVertices(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
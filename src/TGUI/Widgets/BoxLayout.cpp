@@ -95,6 +95,7 @@ namespace tgui
 
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgetNames.insert(m_widgetNames.begin() + index, widgetName);
+            m_widgetNameIndexValid = false;
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
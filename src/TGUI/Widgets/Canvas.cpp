@@ -24,6 +24,9 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
+#include <cstdlib>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -174,7 +177,37 @@ namespace tgui
             return;
 
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        TGUI_PROFILE_COUNT(DrawCalls);
+        TGUI_PROFILE_COUNT(TextureBinds);
+
+        RenderBackend* backend = RenderBackend::getActive();
+        if (!backend)
+        {
+            target.draw(m_sprite, states);
+            return;
+        }
+
+        // The canvas can be redrawn at any time, so the backend can't keep using an old copy of the texture
+        const sf::Texture& texture = m_renderTexture.getTexture();
+        backend->invalidateTexture(texture);
+
+        const sf::IntRect& rect = m_sprite.getTextureRect();
+        const float left = static_cast<float>(rect.left);
+        const float top = static_cast<float>(rect.top);
+        const float right = static_cast<float>(rect.left + rect.width);
+        const float bottom = static_cast<float>(rect.top + rect.height);
+        const float width = static_cast<float>(std::abs(rect.width));
+        const float height = static_cast<float>(std::abs(rect.height));
+        const sf::Vertex vertices[] = {
+            {{0, 0}, m_sprite.getColor(), {left, top}},
+            {{0, height}, m_sprite.getColor(), {left, bottom}},
+            {{width, 0}, m_sprite.getColor(), {right, top}},
+            {{width, height}, m_sprite.getColor(), {right, bottom}}
+        };
+
+        states.transform *= m_sprite.getTransform();
+        states.texture = &texture;
+        backend->renderVertices(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,7 +108,19 @@ namespace tgui
         m_scroll->setSize({m_scroll->getSize().x, getInnerSize().y});
         m_scroll->setViewportSize(static_cast<unsigned int>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()));
 
-        recalculateAllLines();
+        if (m_deferredReflow.sizeChanged())
+            recalculateAllLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::setVisible(bool visible)
+    {
+        Widget::setVisible(visible);
+
+        // Hidden widgets aren't updated, so a layout that was postponed while the widget was hidden has to be done now
+        if (visible)
+            m_deferredReflow.flush([this]{ recalculateAllLines(); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -611,6 +623,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        m_deferredReflow.update(elapsedTime, [this]{ recalculateAllLines(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
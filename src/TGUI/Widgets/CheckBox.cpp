@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/CheckBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
 
@@ -258,7 +260,8 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                TGUI_PROFILE_COUNT(DrawCalls);
+                RenderBackend::drawVertices(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
@@ -28,6 +28,8 @@
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -347,14 +349,15 @@ namespace tgui
 
     bool ComboBox::removeItemById(const sf::String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        const bool ret = m_listBox->removeItemById(id);
 
-        return false;
+        m_text.setString(m_listBox->getSelectedItem());
+
+        // Shrink the list size
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+            updateListBoxHeight();
+
+        return ret;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,6 +419,11 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        // The changed item may have been shown or hidden by the filter
+        if (!m_listBox->getFilter().isEmpty())
+            updateListBoxHeight();
+
         return ret;
     }
 
@@ -425,6 +433,11 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        // The changed item may have been shown or hidden by the filter
+        if (!m_listBox->getFilter().isEmpty())
+            updateListBoxHeight();
+
         return ret;
     }
 
@@ -434,6 +447,11 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        // The changed item may have been shown or hidden by the filter
+        if (!m_listBox->getFilter().isEmpty())
+            updateListBoxHeight();
+
         return ret;
     }
 
@@ -453,6 +471,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::setItemModel(ItemModel::ConstPtr model)
+    {
+        m_text.setString("");
+        m_listBox->setItemModel(std::move(model));
+
+        updateListBoxHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemModel::ConstPtr ComboBox::getItemModel() const
+    {
+        return m_listBox->getItemModel();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
         m_listBox->setMaximumItems(maximumItems);
@@ -513,16 +548,43 @@ namespace tgui
 
     bool ComboBox::contains(const sf::String& item) const
     {
-        const auto& items = getItems();
-        return std::find(items.begin(), items.end(), item) != items.end();
+        return m_listBox->contains(item);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::containsId(const sf::String& id) const
     {
-        const auto& ids = getItemIds();
-        return std::find(ids.begin(), ids.end(), id) != ids.end();
+        return m_listBox->containsId(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setItemIndexEnabled(bool enabled)
+    {
+        m_listBox->setItemIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isItemIndexEnabled() const
+    {
+        return m_listBox->isItemIndexEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setFilter(const sf::String& filter)
+    {
+        m_listBox->setFilter(filter);
+        updateListBoxHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ComboBox::getFilter() const
+    {
+        return m_listBox->getFilter();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -859,10 +921,10 @@ namespace tgui
         const Padding padding = m_listBox->getSharedRenderer()->getPadding();
 
         if (m_nrOfItemsToDisplay > 0)
-            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * (std::min<std::size_t>(m_nrOfItemsToDisplay, std::max<std::size_t>(m_listBox->getItemCount(), 1))))
+            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * (std::min<std::size_t>(m_nrOfItemsToDisplay, std::max<std::size_t>(m_listBox->getFilteredItemCount(), 1))))
                                              + borders.getTop() + borders.getBottom() + padding.getTop() + padding.getBottom()});
         else
-            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1))
+            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getFilteredItemCount(), 1))
                                              + borders.getTop() + borders.getBottom() + padding.getTop() + padding.getBottom()});
 
     }
@@ -995,7 +1057,8 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, arrow, states);
         }
 
         // Draw the selected item
@@ -170,11 +170,15 @@ namespace tgui
         // Change the text if allowed
         if (m_regexString == ".*")
             m_text = text;
+        else if (m_regexDfa)
+            m_text = m_regexDfa->match(text) ? text : "";
         else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
+            m_text = text.toAnsiString(); // Unicode is not supported when using std::regex because it can't be checked
         else // Clear the text
             m_text = "";
 
+        invalidateValidatorStates(0);
+
         // Remove all the excess characters if there is a character limit
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
             m_text.erase(m_maxChars, sf::String::InvalidPos);
@@ -212,6 +216,7 @@ namespace tgui
                 m_text.erase(m_text.getSize()-1);
             }
 
+            invalidateValidatorStates(m_text.getSize());
             m_textBeforeSelection.setString(m_textFull.getString());
         }
         else // There is no text cropping
@@ -321,6 +326,7 @@ namespace tgui
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
             displayedText.erase(m_maxChars, sf::String::InvalidPos);
+            invalidateValidatorStates(m_maxChars);
 
             // If we passed here then the text has changed.
             m_textBeforeSelection.setString(displayedText);
@@ -377,6 +383,7 @@ namespace tgui
                 m_text.erase(m_text.getSize()-1);
             }
 
+            invalidateValidatorStates(m_text.getSize());
             m_textBeforeSelection.setString(m_textFull.getString());
 
             // There is no clipping
@@ -434,15 +441,24 @@ namespace tgui
 
     bool EditBox::setInputValidator(const std::string& regex)
     {
-        try
-        {
-            m_regex = regex;
-        }
-        catch (const std::regex_error&)
+        RegexDfa::ConstPtr regexDfa;
+        if (regex != ".*")
+            regexDfa = RegexDfa::create(regex);
+
+        if (!regexDfa)
         {
-            return false;
+            try
+            {
+                m_regex = regex;
+            }
+            catch (const std::regex_error&)
+            {
+                return false;
+            }
         }
 
+        m_regexDfa = std::move(regexDfa);
+        m_regexDfaStates.clear();
         m_regexString = regex;
         setText(m_text);
         return true;
@@ -770,6 +786,7 @@ namespace tgui
                     displayedString.erase(m_selEnd-1, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd-1, 1);
+                    invalidateValidatorStates(m_selEnd-1);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd - 1);
@@ -809,6 +826,7 @@ namespace tgui
                     displayedString.erase(m_selEnd, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd, 1);
+                    invalidateValidatorStates(m_selEnd);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd);
@@ -904,7 +922,13 @@ namespace tgui
             return;
 
         // Only add the character when the regex matches
-        if (m_regexString != ".*")
+        if (m_regexDfa)
+        {
+            const std::size_t pos = std::min(m_selStart, m_selEnd);
+            if (!isAcceptedByValidator(pos, m_selChars, key))
+                return;
+        }
+        else if (m_regexString != ".*")
         {
             sf::String text = m_text;
 
@@ -932,6 +956,7 @@ namespace tgui
 
         // Insert our character
         m_text.insert(m_selEnd, key);
+        invalidateValidatorStates(m_selEnd);
 
         // Change the displayed text
         sf::String displayedText = m_textFull.getString();
@@ -950,6 +975,7 @@ namespace tgui
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_text.erase(m_selEnd, 1);
+                invalidateValidatorStates(m_selEnd);
                 displayedText.erase(m_selEnd, 1);
                 m_textFull.setString(displayedText);
                 return;
@@ -1327,6 +1353,7 @@ namespace tgui
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
         m_text.erase(pos, m_selChars);
+        invalidateValidatorStates(pos);
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
@@ -1345,6 +1372,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isAcceptedByValidator(std::size_t pos, std::size_t removedChars, std::uint32_t key)
+    {
+        // Find the state after the text in front of the insertion position, reusing the states of earlier calls
+        if (m_regexDfaStates.empty())
+            m_regexDfaStates.push_back(m_regexDfa->getStartState());
+
+        while (m_regexDfaStates.size() <= pos)
+            m_regexDfaStates.push_back(m_regexDfa->advance(m_regexDfaStates.back(), m_text[m_regexDfaStates.size() - 1]));
+
+        // Only the typed character and the text behind it still have to be processed
+        unsigned int state = m_regexDfa->advance(m_regexDfaStates[pos], key);
+        for (std::size_t i = pos + removedChars; (i < m_text.getSize()) && (state != RegexDfa::DeadState); ++i)
+            state = m_regexDfa->advance(state, m_text[i]);
+
+        return m_regexDfa->isAccepting(state);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::invalidateValidatorStates(std::size_t pos)
+    {
+        if (m_regexDfaStates.size() > pos + 1)
+            m_regexDfaStates.resize(pos + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         const float textOffset = m_textFull.getExtraHorizontalPadding();
@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -576,7 +578,8 @@ namespace tgui
             bordersShape.setFillColor(Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, bordersShape, states);
         }
 
         // Draw the background
@@ -586,7 +589,8 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, background, states);
         }
 
         // Draw the foreground
@@ -608,7 +612,8 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, thumb, states);
         }
     }
 
@@ -107,7 +107,20 @@ namespace tgui
 
         // You are no longer auto-sizing
         m_autoSize = false;
-        rearrangeText();
+
+        if (m_deferredReflow.sizeChanged())
+            rearrangeText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::setVisible(bool visible)
+    {
+        Widget::setVisible(visible);
+
+        // Hidden widgets aren't updated, so a layout that was postponed while the widget was hidden has to be done now
+        if (visible)
+            m_deferredReflow.flush([this]{ rearrangeText(); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -536,6 +549,8 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
+        m_deferredReflow.update(elapsedTime, [this]{ rearrangeText(); });
+
         if (m_animationTimeElapsed >= sf::milliseconds(getDoubleClickTime()))
         {
             m_animationTimeElapsed = {};
@@ -30,7 +30,39 @@
 
 namespace tgui
 {
-   /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        sf::Uint32 toLowerAscii(sf::Uint32 c)
+        {
+            if ((c >= 'A') && (c <= 'Z'))
+                return c + ('a' - 'A');
+            else
+                return c;
+        }
+
+        // Checks whether the text contains the filter, ignoring the case of ASCII letters
+        bool listBoxItemMatchesFilter(const sf::String& text, const sf::String& filter)
+        {
+            if (filter.getSize() > text.getSize())
+                return false;
+
+            const sf::Uint32* textData = text.getData();
+            const sf::Uint32* filterData = filter.getData();
+            for (std::size_t start = 0; start + filter.getSize() <= text.getSize(); ++start)
+            {
+                std::size_t i = 0;
+                while ((i < filter.getSize()) && (toLowerAscii(textData[start + i]) == toLowerAscii(filterData[i])))
+                    ++i;
+
+                if (i == filter.getSize())
+                    return true;
+            }
+
+            return false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox()
     {
@@ -98,8 +130,7 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
+        updateItemPositions();
 
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
@@ -125,14 +156,32 @@ namespace tgui
 
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
+        detachItemModel();
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
         {
-            m_scroll->setMaximum(static_cast<unsigned int>((m_items.size() + 1) * m_itemHeight));
+            // Items that don't pass the filter are added without being shown
+            const bool shown = m_filter.isEmpty() || listBoxItemMatchesFilter(itemName, m_filter);
+            const std::size_t row = getFilteredItemCount();
+            if (shown)
+            {
+                m_scroll->setMaximum(static_cast<unsigned int>((row + 1) * m_itemHeight));
 
-            // Scroll down when auto-scrolling is enabled
-            if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
-                m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+                // Scroll down when auto-scrolling is enabled
+                if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
+                    m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+
+                if (!m_filter.isEmpty())
+                    m_filteredItems.push_back(m_items.size());
+            }
+
+            // Keep the index up-to-date, the new item can't come before an existing item with the same name or id
+            if (m_itemIndexEnabled && m_itemIndexValid)
+            {
+                m_itemIndex.emplace(itemName, m_items.size());
+                m_itemIdIndex.emplace(id, m_items.size());
+            }
 
             // Create the new item
             Text newItem;
@@ -142,7 +191,7 @@ namespace tgui
             newItem.setStyle(m_textStyleCached);
             newItem.setCharacterSize(m_textSize);
             newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
+            newItem.setPosition({0, (row * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
 
             // Add the new item to the list
             m_items.push_back(std::move(newItem));
@@ -157,11 +206,9 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = findItem(itemName);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -172,11 +219,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = findItemById(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -187,7 +232,7 @@ namespace tgui
 
     bool ListBox::setSelectedItemByIndex(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             deselectItem();
             return false;
@@ -195,11 +240,15 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
-        // Move the scrollbar
-        if (m_selectedItem * getItemHeight() < m_scroll->getValue())
-            m_scroll->setValue(m_selectedItem * getItemHeight());
-        else if ((m_selectedItem + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
-            m_scroll->setValue((m_selectedItem + 1) * getItemHeight() - m_scroll->getViewportSize());
+        // Move the scrollbar (unless the item is hidden by the filter)
+        const int row = getRowOfItem(m_selectedItem);
+        if (row >= 0)
+        {
+            if (row * getItemHeight() < m_scroll->getValue())
+                m_scroll->setValue(row * getItemHeight());
+            else if ((row + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
+                m_scroll->setValue((row + 1) * getItemHeight() - m_scroll->getViewportSize());
+        }
 
         return true;
     }
@@ -215,11 +264,9 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        const int index = findItem(itemName);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -228,11 +275,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        const int index = findItemById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -241,9 +286,11 @@ namespace tgui
 
     bool ListBox::removeItemByIndex(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
             return false;
 
+        detachItemModel();
+
         // Keep it simple and forget hover when an item is removed
         updateHoveringItem(-1);
 
@@ -259,8 +306,20 @@ namespace tgui
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
+        m_itemIndexValid = false;
+
+        // The items behind the removed one move up
+        if (!m_filter.isEmpty())
+        {
+            auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index);
+            if ((it != m_filteredItems.end()) && (*it == index))
+                it = m_filteredItems.erase(it);
 
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+            for (; it != m_filteredItems.end(); ++it)
+                --(*it);
+        }
+
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
         setPosition(m_position);
 
         return true;
@@ -277,6 +336,10 @@ namespace tgui
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        m_itemModel = nullptr;
+        m_visibleItems.clear();
+        m_filteredItems.clear();
+        m_itemIndexValid = false;
 
         m_scroll->setMaximum(0);
     }
@@ -285,11 +348,9 @@ namespace tgui
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
+        const int index = findItemById(id);
+        if (index >= 0)
+            return getItemString(static_cast<std::size_t>(index));
 
         return "";
     }
@@ -298,24 +359,24 @@ namespace tgui
 
     sf::String ListBox::getItemByIndex(std::size_t index) const
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
             return "";
 
-        return m_items[index].getString();
+        return getItemString(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? getItemString(m_selectedItem) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItemId() const
     {
-        return (m_selectedItem >= 0) ? m_itemIds[m_selectedItem] : "";
+        return (m_selectedItem >= 0) ? getItemIdString(m_selectedItem) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,11 +390,9 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = findItem(originalValue);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -342,11 +401,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = findItemById(id);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -355,10 +412,32 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
             return false;
 
+        detachItemModel();
         m_items[index].setString(newValue);
+        m_itemIndexValid = false;
+
+        // The new value may cause the item to be shown or hidden
+        if (!m_filter.isEmpty())
+        {
+            const bool shown = listBoxItemMatchesFilter(newValue, m_filter);
+            const auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index);
+            const bool wasShown = (it != m_filteredItems.end()) && (*it == index);
+            if (shown != wasShown)
+            {
+                if (shown)
+                    m_filteredItems.insert(it, index);
+                else
+                    m_filteredItems.erase(it);
+
+                updateHoveringItem(-1);
+                m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
+                updateItemPositions();
+            }
+        }
+
         return true;
     }
 
@@ -366,13 +445,19 @@ namespace tgui
 
     std::size_t ListBox::getItemCount() const
     {
-        return m_items.size();
+        if (m_itemModel)
+            return m_itemModel->getItemCount();
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<sf::String> ListBox::getItems() const
     {
+        if (m_itemModel)
+            return m_itemModel->getItems();
+
         std::vector<sf::String> items;
         for (const auto& item : m_items)
             items.push_back(item.getString());
@@ -384,7 +469,41 @@ namespace tgui
 
     const std::vector<sf::String>& ListBox::getItemIds() const
     {
-        return m_itemIds;
+        if (m_itemModel)
+            return m_itemModel->getItemIds();
+        else
+            return m_itemIds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemModel(ItemModel::ConstPtr model)
+    {
+        removeAllItems();
+        m_itemModel = std::move(model);
+        if (!m_itemModel || (m_itemModel->getItemCount() == 0))
+        {
+            m_itemModel = nullptr;
+            return;
+        }
+
+        // Find the items that pass the filter, setFilter only does this when the filter changes
+        sf::String filter;
+        std::swap(filter, m_filter);
+        setFilter(filter);
+
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
+        m_visibleItemsValid = false;
+
+        // The model can't be shortened, so it has to be copied when it contains too many items
+        setMaximumItems(m_maxItems);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemModel::ConstPtr ListBox::getItemModel() const
+    {
+        return m_itemModel;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -401,7 +520,7 @@ namespace tgui
         }
 
         m_scroll->setScrollAmount(m_itemHeight);
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
         setPosition(m_position);
     }
 
@@ -444,13 +563,17 @@ namespace tgui
         m_maxItems = maximumItems;
 
         // Check if we already passed the limit
-        if ((m_maxItems > 0) && (m_maxItems < m_items.size()))
+        if ((m_maxItems > 0) && (m_maxItems < getItemCount()))
         {
+            detachItemModel();
+
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            m_filteredItems.erase(std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), m_maxItems), m_filteredItems.end());
+            m_itemIndexValid = false;
 
-            m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+            m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
             setPosition(m_position);
         }
     }
@@ -480,14 +603,83 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return findItem(item) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const sf::String& id) const
     {
-        return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
+        return findItemById(id) >= 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemIndexEnabled(bool enabled)
+    {
+        m_itemIndexEnabled = enabled;
+        m_itemIndexValid = false;
+        m_itemIndex.clear();
+        m_itemIdIndex.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isItemIndexEnabled() const
+    {
+        return m_itemIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilter(const sf::String& filter)
+    {
+        if (filter == m_filter)
+            return;
+
+        if (filter.isEmpty())
+            m_filteredItems.clear();
+        else if (!m_filter.isEmpty() && listBoxItemMatchesFilter(filter, m_filter))
+        {
+            // The new filter is stricter than the previous one, so only the items that are currently shown can still match
+            m_filteredItems.erase(std::remove_if(m_filteredItems.begin(), m_filteredItems.end(),
+                                                 [&](std::size_t i){ return !listBoxItemMatchesFilter(getItemString(i), filter); }),
+                                  m_filteredItems.end());
+        }
+        else
+        {
+            m_filteredItems.clear();
+            const std::size_t itemCount = getItemCount();
+            for (std::size_t i = 0; i < itemCount; ++i)
+            {
+                if (listBoxItemMatchesFilter(getItemString(i), filter))
+                    m_filteredItems.push_back(i);
+            }
+        }
+
+        m_filter = filter;
+
+        updateHoveringItem(-1);
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
+        m_scroll->setValue(0);
+        updateItemPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ListBox::getFilter() const
+    {
+        return m_filter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getFilteredItemCount() const
+    {
+        if (m_filter.isEmpty())
+            return getItemCount();
+        else
+            return m_filteredItems.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -522,14 +714,14 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if (hoveringRow < static_cast<int>(getFilteredItemCount()))
+                    updateHoveringItem(static_cast<int>(getItemIndexOfRow(static_cast<std::size_t>(hoveringRow))));
                 else
                     updateHoveringItem(-1);
 
                 if (m_hoveringItem >= 0)
-                    onMousePress.emit(this, m_items[m_hoveringItem].getString(), m_itemIds[m_hoveringItem]);
+                    onMousePress.emit(this, getItemString(m_hoveringItem), getItemIdString(m_hoveringItem));
 
                 if (m_selectedItem != m_hoveringItem)
                 {
@@ -548,7 +740,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll->isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onMouseRelease.emit(this, getItemString(m_selectedItem), getItemIdString(m_selectedItem));
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -556,7 +748,7 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                    onDoubleClick.emit(this, getItemString(m_selectedItem), getItemIdString(m_selectedItem));
             }
             else // This is the first click
             {
@@ -594,9 +786,9 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if (hoveringRow < static_cast<int>(getFilteredItemCount()))
+                    updateHoveringItem(static_cast<int>(getItemIndexOfRow(static_cast<std::size_t>(hoveringRow))));
                 else
                     updateHoveringItem(-1);
 
@@ -670,6 +862,8 @@ namespace tgui
 
     void ListBox::rendererChanged(const std::string& property)
     {
+        m_visibleItemsValid = false;
+
         if (property == "borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
@@ -711,14 +905,14 @@ namespace tgui
             for (auto& item : m_items)
                 item.setStyle(m_textStyleCached);
 
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
+            if ((m_selectedItem >= 0) && !m_itemModel && m_selectedTextStyleCached.isSet())
                 m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
         }
         else if (property == "selectedtextstyle")
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
 
-            if (m_selectedItem >= 0)
+            if ((m_selectedItem >= 0) && !m_itemModel)
             {
                 if (m_selectedTextStyleCached.isSet())
                     m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
@@ -896,6 +1090,13 @@ namespace tgui
 
     void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
     {
+        // The texts of the visible rows are recreated with the right colors the next time they are drawn
+        if (m_itemModel)
+        {
+            m_visibleItemsValid = false;
+            return;
+        }
+
         if (m_selectedItem >= 0)
         {
             if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
@@ -933,7 +1134,7 @@ namespace tgui
     {
         if (m_hoveringItem != item)
         {
-            if (m_hoveringItem >= 0)
+            if ((m_hoveringItem >= 0) && !m_itemModel)
             {
                 if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
                     m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
@@ -953,7 +1154,7 @@ namespace tgui
     {
         if (m_selectedItem != item)
         {
-            if (m_selectedItem >= 0)
+            if ((m_selectedItem >= 0) && !m_itemModel)
             {
                 if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
                     m_items[m_selectedItem].setColor(m_textColorHoverCached);
@@ -965,7 +1166,7 @@ namespace tgui
 
             m_selectedItem = item;
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onItemSelect.emit(this, getItemString(m_selectedItem), getItemIdString(m_selectedItem));
             else
                 onItemSelect.emit(this, "", "");
 
@@ -975,6 +1176,205 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    int ListBox::findItem(const sf::String& itemName) const
+    {
+        if (m_itemModel)
+            return m_itemModel->findItem(itemName);
+
+        if (m_itemIndexEnabled)
+        {
+            if (!m_itemIndexValid)
+                rebuildItemIndex();
+
+            const auto it = m_itemIndex.find(itemName);
+            return (it != m_itemIndex.end()) ? static_cast<int>(it->second) : -1;
+        }
+
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            if (m_items[i].getString() == itemName)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemById(const sf::String& id) const
+    {
+        if (m_itemModel)
+            return m_itemModel->findItemById(id);
+
+        if (m_itemIndexEnabled)
+        {
+            if (!m_itemIndexValid)
+                rebuildItemIndex();
+
+            const auto it = m_itemIdIndex.find(id);
+            return (it != m_itemIdIndex.end()) ? static_cast<int>(it->second) : -1;
+        }
+
+        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
+        {
+            if (m_itemIds[i] == id)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::rebuildItemIndex() const
+    {
+        m_itemIndex.clear();
+        m_itemIdIndex.clear();
+        m_itemIndex.reserve(m_items.size());
+        m_itemIdIndex.reserve(m_itemIds.size());
+
+        // Emplace doesn't overwrite existing keys, so the first item with a given name or id is stored
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            m_itemIndex.emplace(m_items[i].getString(), i);
+            m_itemIdIndex.emplace(m_itemIds[i], i);
+        }
+
+        m_itemIndexValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getItemIndexOfRow(std::size_t row) const
+    {
+        if (m_filter.isEmpty())
+            return row;
+        else
+            return m_filteredItems[row];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::getRowOfItem(int item) const
+    {
+        if ((item < 0) || m_filter.isEmpty())
+            return item;
+
+        const auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), static_cast<std::size_t>(item));
+        if ((it != m_filteredItems.end()) && (*it == static_cast<std::size_t>(item)))
+            return static_cast<int>(it - m_filteredItems.begin());
+        else
+            return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemPositions()
+    {
+        if (m_itemModel)
+        {
+            m_visibleItemsValid = false;
+            return;
+        }
+
+        for (std::size_t row = 0; row < getFilteredItemCount(); ++row)
+        {
+            Text& item = m_items[getItemIndexOfRow(row)];
+            item.setPosition({0, (row * m_itemHeight) + ((m_itemHeight - item.getSize().y) / 2.0f)});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& ListBox::getItemString(std::size_t index) const
+    {
+        if (m_itemModel)
+            return m_itemModel->getItem(index);
+        else
+            return m_items[index].getString();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& ListBox::getItemIdString(std::size_t index) const
+    {
+        if (m_itemModel)
+            return m_itemModel->getItemId(index);
+        else
+            return m_itemIds[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::detachItemModel()
+    {
+        if (!m_itemModel)
+            return;
+
+        const auto model = std::move(m_itemModel);
+        m_visibleItems.clear();
+        m_itemIndexValid = false;
+
+        m_items.resize(model->getItemCount());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            m_items[i].setFont(m_fontCached);
+            m_items[i].setOpacity(m_opacityCached);
+            m_items[i].setCharacterSize(m_textSize);
+            m_items[i].setString(model->getItem(i));
+        }
+
+        m_itemIds = model->getItemIds();
+
+        updateItemColorsAndStyle();
+        updateItemPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItems(std::size_t firstRow, std::size_t lastRow) const
+    {
+        lastRow = std::min(lastRow, getFilteredItemCount());
+        firstRow = std::min(firstRow, lastRow);
+        if (m_visibleItemsValid && (m_visibleItemsFirstRow == firstRow) && (m_visibleItems.size() == lastRow - firstRow))
+            return;
+
+        m_visibleItems.resize(lastRow - firstRow);
+        for (std::size_t row = firstRow; row < lastRow; ++row)
+        {
+            const int index = static_cast<int>(getItemIndexOfRow(row));
+
+            Color color = m_textColorCached;
+            TextStyle style = m_textStyleCached;
+            if (index == m_selectedItem)
+            {
+                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
+                    color = m_selectedTextColorHoverCached;
+                else if (m_selectedTextColorCached.isSet())
+                    color = m_selectedTextColorCached;
+
+                if (m_selectedTextStyleCached.isSet())
+                    style = m_selectedTextStyleCached;
+            }
+            else if ((index == m_hoveringItem) && m_textColorHoverCached.isSet())
+                color = m_textColorHoverCached;
+
+            Text& text = m_visibleItems[row - firstRow];
+            text.setFont(m_fontCached);
+            text.setColor(color);
+            text.setOpacity(m_opacityCached);
+            text.setStyle(style);
+            text.setCharacterSize(m_textSize);
+            text.setString(m_itemModel->getItem(static_cast<std::size_t>(index)));
+            text.setPosition({0, (row * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+        }
+
+        m_visibleItemsFirstRow = firstRow;
+        m_visibleItemsValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
@@ -1016,7 +1416,7 @@ namespace tgui
 
             // Find out which items are visible
             std::size_t firstItem = 0;
-            std::size_t lastItem = m_items.size();
+            std::size_t lastItem = getFilteredItemCount();
             if (m_scroll->getViewportSize() < m_scroll->getMaximum())
             {
                 firstItem = m_scroll->getValue() / m_itemHeight;
@@ -1030,9 +1430,10 @@ namespace tgui
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll->getValue()});
 
             // Draw the background of the selected item
-            if (m_selectedItem >= 0)
+            const int selectedRow = getRowOfItem(m_selectedItem);
+            if (selectedRow >= 0)
             {
-                states.transform.translate({0, m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, selectedRow * static_cast<float>(m_itemHeight)});
 
                 const Vector2f size = {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)};
                 if ((m_selectedItem == m_hoveringItem) && m_selectedBackgroundColorHoverCached.isSet())
@@ -1040,21 +1441,31 @@ namespace tgui
                 else
                     drawRectangleShape(target, states, size, m_selectedBackgroundColorCached);
 
-                states.transform.translate({0, -m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -selectedRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveringItem >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
+            const int hoveringRow = getRowOfItem(m_hoveringItem);
+            if ((hoveringRow >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, hoveringRow * static_cast<float>(m_itemHeight)});
                 drawRectangleShape(target, states, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
-                states.transform.translate({0, -m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -hoveringRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the items
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+            if (m_itemModel)
+            {
+                updateVisibleItems(firstItem, lastItem);
+                for (const auto& item : m_visibleItems)
+                    item.draw(target, states);
+            }
+            else
+            {
+                for (std::size_t i = firstItem; i < lastItem; ++i)
+                    m_items[getItemIndexOfRow(i)].draw(target, states);
+            }
         }
 
         // Draw the scrollbar
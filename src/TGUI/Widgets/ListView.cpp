@@ -25,12 +25,104 @@
 
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <thread>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        const sf::String& getListViewCellText(const ListView::Item& item, std::size_t column)
+        {
+            static const sf::String emptyString;
+            if (column < item.texts.size())
+                return item.texts[column].getString();
+            else
+                return emptyString;
+        }
+
+        // Parses the number at the start of the text, without allocating memory as this is done for every item when sorting
+        double parseListViewNumber(const sf::String& text)
+        {
+            std::size_t i = 0;
+            while ((i < text.getSize()) && ((text[i] == ' ') || (text[i] == '\t')))
+                ++i;
+
+            bool negative = false;
+            if ((i < text.getSize()) && ((text[i] == '-') || (text[i] == '+')))
+            {
+                negative = (text[i] == '-');
+                ++i;
+            }
+
+            bool digitFound = false;
+            double value = 0;
+            while ((i < text.getSize()) && (text[i] >= '0') && (text[i] <= '9'))
+            {
+                value = (value * 10) + (text[i] - '0');
+                digitFound = true;
+                ++i;
+            }
+
+            if ((i < text.getSize()) && (text[i] == '.'))
+            {
+                ++i;
+                double scale = 0.1;
+                while ((i < text.getSize()) && (text[i] >= '0') && (text[i] <= '9'))
+                {
+                    value += (text[i] - '0') * scale;
+                    scale /= 10;
+                    digitFound = true;
+                    ++i;
+                }
+            }
+
+            if (!digitFound)
+                return -std::numeric_limits<double>::infinity();
+
+            return negative ? -value : value;
+        }
+
+        // Sorts parts of the list on different threads and then merges them
+        template <typename Compare>
+        void sortListViewItemsInParallel(std::vector<std::size_t>& indices, const Compare& compare)
+        {
+            const std::size_t minItemsPerThread = 16384;
+            const std::size_t threadCount = std::min<std::size_t>(std::thread::hardware_concurrency(), indices.size() / minItemsPerThread);
+            if (threadCount <= 1)
+            {
+                std::sort(indices.begin(), indices.end(), compare);
+                return;
+            }
+
+            std::vector<std::size_t> bounds;
+            for (std::size_t i = 0; i <= threadCount; ++i)
+                bounds.push_back(indices.size() * i / threadCount);
+
+            std::vector<std::thread> threads;
+            for (std::size_t i = 1; i < threadCount; ++i)
+                threads.emplace_back([&indices,&bounds,&compare,i]{ std::sort(indices.begin() + bounds[i], indices.begin() + bounds[i+1], compare); });
+
+            std::sort(indices.begin(), indices.begin() + bounds[1], compare);
+            for (auto& thread : threads)
+                thread.join();
+
+            for (std::size_t width = 1; width < threadCount; width *= 2)
+            {
+                for (std::size_t i = 0; i + width < threadCount; i += 2 * width)
+                {
+                    std::inplace_merge(indices.begin() + bounds[i], indices.begin() + bounds[i + width],
+                                       indices.begin() + bounds[std::min(i + 2 * width, threadCount)], compare);
+                }
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListView::ListView()
@@ -288,6 +380,7 @@ namespace tgui
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
+        insertItemIntoRows(m_items.size() - 1);
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -313,6 +406,7 @@ namespace tgui
 
         item.icon.setOpacity(m_opacityCached);
 
+        insertItemIntoRows(m_items.size() - 1);
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -326,6 +420,7 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<sf::String>>& items)
     {
+        const std::size_t oldItemCount = m_items.size();
         for (unsigned int i = 0; i < items.size(); ++i)
         {
 #ifdef TGUI_USE_CPP17
@@ -341,6 +436,18 @@ namespace tgui
             item.icon.setOpacity(m_opacityCached);
         }
 
+        // Sorting everything at once is faster than inserting the items one by one
+        if (m_sortColumn >= 0)
+        {
+            sortAllItems();
+            updateRows();
+        }
+        else
+        {
+            for (std::size_t i = oldItemCount; i < m_items.size(); ++i)
+                insertItemIntoRows(i);
+        }
+
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -355,12 +462,20 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
+        removeItemFromRows(index);
+
         Item& item = m_items[index];
         item.texts.clear();
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
             item.texts.push_back(createText(text));
 
+        if (isSortedOrFiltered())
+        {
+            insertItemIntoRows(index);
+            updateVerticalScrollbarMaximum();
+        }
+
         return true;
     }
 
@@ -371,11 +486,20 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
+        removeItemFromRows(index);
+
         Item& item = m_items[index];
         if (column >= item.texts.size())
             item.texts.resize(column + 1);
 
         item.texts[column] = createText(itemText);
+
+        if (isSortedOrFiltered())
+        {
+            insertItemIntoRows(index);
+            updateVerticalScrollbarMaximum();
+        }
+
         return true;
     }
 
@@ -407,6 +531,25 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
+        if (isSortedOrFiltered())
+        {
+            // Remove the item from the rows and let the indices of the items behind it point to the correct item again
+            removeItemFromRows(index);
+            m_itemRows.erase(m_itemRows.begin() + index);
+
+            for (auto& itemIndex : m_sortedItems)
+            {
+                if (itemIndex > index)
+                    --itemIndex;
+            }
+
+            for (auto& itemIndex : m_rowItems)
+            {
+                if (itemIndex > index)
+                    --itemIndex;
+            }
+        }
+
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + index);
 
@@ -443,6 +586,9 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_sortedItems.clear();
+        m_rowItems.clear();
+        m_itemRows.clear();
 
         m_iconCount = 0;
         m_maxIconWidth = 0;
@@ -462,11 +608,15 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
-        // Move the scrollbar
-        if (m_selectedItem * getItemHeight() < m_verticalScrollbar->getValue())
-            m_verticalScrollbar->setValue(m_selectedItem * getItemHeight());
-        else if ((m_selectedItem + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
-            m_verticalScrollbar->setValue((m_selectedItem + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+        // Move the scrollbar (unless the item is hidden by the filter)
+        const int row = getRowOfItem(m_selectedItem);
+        if (row < 0)
+            return;
+
+        if (row * getItemHeight() < m_verticalScrollbar->getValue())
+            m_verticalScrollbar->setValue(row * getItemHeight());
+        else if ((row + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
+            m_verticalScrollbar->setValue((row + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -574,6 +724,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::String ListView::getItemCell(std::size_t index, std::size_t column) const
+    {
+        if (index >= m_items.size())
+            return "";
+
+        return getListViewCellText(m_items[index], column);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<sf::String> ListView::getItems() const
     {
         std::vector<sf::String> items;
@@ -610,6 +770,68 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::sortItems(std::size_t column, SortMode mode, bool ascending)
+    {
+        m_sortColumn = static_cast<int>(column);
+        m_sortMode = mode;
+        m_sortAscending = ascending;
+        m_sortComparator = nullptr;
+
+        sortAllItems();
+        updateRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortItems(std::size_t column, const std::function<bool(const sf::String&, const sf::String&)>& comparator)
+    {
+        m_sortColumn = static_cast<int>(column);
+        m_sortMode = SortMode::Lexical;
+        m_sortAscending = true;
+        m_sortComparator = comparator;
+
+        sortAllItems();
+        updateRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::resetSorting()
+    {
+        m_sortColumn = -1;
+        m_sortComparator = nullptr;
+        m_sortedItems.clear();
+
+        updateRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getSortColumn() const
+    {
+        return m_sortColumn;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setFilter(const std::function<bool(std::size_t)>& filter)
+    {
+        m_filter = filter;
+        updateRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getFilteredItemCount() const
+    {
+        if (isSortedOrFiltered())
+            return m_rowItems.size();
+        else
+            return m_items.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setItemHeight(unsigned int itemHeight)
     {
         // Set the new heights
@@ -882,6 +1104,30 @@ namespace tgui
         {
             m_horizontalScrollbar->leftMousePressed(pos);
         }
+        else if ((getCurrentHeaderHeight() > 0) && !m_columns.empty()
+              && FloatRect{m_bordersCached.getLeft() + m_paddingCached.getLeft(), m_bordersCached.getTop() + m_paddingCached.getTop(),
+                           getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), getHeaderHeight()}.contains(pos))
+        {
+            unsigned int separatorWidth = m_separatorWidth;
+            if (m_showVerticalGridLines && (m_gridLinesWidth > separatorWidth))
+                separatorWidth = m_gridLinesWidth;
+
+            // Find out on which column header the mouse is standing
+            float left = pos.x - m_bordersCached.getLeft() - m_paddingCached.getLeft();
+            if (m_horizontalScrollbar->isShown())
+                left += m_horizontalScrollbar->getValue();
+
+            for (std::size_t col = 0; col < m_columns.size(); ++col)
+            {
+                if ((left < m_columns[col].width + separatorWidth) || (m_expandLastColumn && (col + 1 == m_columns.size())))
+                {
+                    onHeaderClick.emit(this, static_cast<int>(col));
+                    break;
+                }
+
+                left -= m_columns[col].width + separatorWidth;
+            }
+        }
         else if (FloatRect{m_bordersCached.getLeft() + m_paddingCached.getLeft(), m_bordersCached.getTop() + m_paddingCached.getTop() + getCurrentHeaderHeight(),
                            getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}.contains(pos))
         {
@@ -1041,6 +1287,8 @@ namespace tgui
             return onDoubleClick;
         else if (signalName == toLower(onRightClick.getName()))
             return onRightClick;
+        else if (signalName == toLower(onHeaderClick.getName()))
+            return onHeaderClick;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -1539,8 +1787,8 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
-            updateHoveredItem(hoveredItem);
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getFilteredItemCount())))
+            updateHoveredItem(static_cast<int>(getItemIndexOfRow(static_cast<std::size_t>(hoveredItem))));
         else
             updateHoveredItem(-1);
     }
@@ -1591,9 +1839,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t rowCount = getFilteredItemCount();
+        unsigned int maximum = static_cast<unsigned int>(rowCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (rowCount > 0))
+            maximum += static_cast<unsigned int>((rowCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -1680,16 +1929,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = m_items[getItemIndexOfRow(i)];
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                m_items[i].icon.draw(target, states);
+                item.icon.draw(target, states);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -1705,7 +1955,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = m_items[getItemIndexOfRow(i)];
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -1715,18 +1966,182 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            m_items[i].texts[column].draw(target, states);
+            item.texts[column].draw(target, states);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListView::isSortedOrFiltered() const
+    {
+        return (m_sortColumn >= 0) || m_filter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::compareItems(std::size_t left, std::size_t right) const
+    {
+        const sf::String& leftText = getListViewCellText(m_items[left], static_cast<std::size_t>(m_sortColumn));
+        const sf::String& rightText = getListViewCellText(m_items[right], static_cast<std::size_t>(m_sortColumn));
+
+        // Items that compare equal are kept in the order in which they were added
+        if (m_sortComparator)
+        {
+            if (m_sortComparator(leftText, rightText))
+                return true;
+            else if (m_sortComparator(rightText, leftText))
+                return false;
+        }
+        else if (m_sortMode == SortMode::Numeric)
+        {
+            const double leftValue = parseListViewNumber(leftText);
+            const double rightValue = parseListViewNumber(rightText);
+            if (leftValue != rightValue)
+                return m_sortAscending ? (leftValue < rightValue) : (leftValue > rightValue);
+        }
+        else
+        {
+            if (leftText != rightText)
+                return m_sortAscending ? (leftText < rightText) : (rightText < leftText);
+        }
+
+        return left < right;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortAllItems()
+    {
+        m_sortedItems.resize(m_items.size());
+        std::iota(m_sortedItems.begin(), m_sortedItems.end(), std::size_t{0});
+
+        if (!m_sortComparator && (m_sortMode == SortMode::Numeric))
+        {
+            // Parse every number only once instead of on every comparison
+            std::vector<double> values(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                values[i] = parseListViewNumber(getListViewCellText(m_items[i], static_cast<std::size_t>(m_sortColumn)));
+
+            const bool ascending = m_sortAscending;
+            sortListViewItemsInParallel(m_sortedItems, [&values,ascending](std::size_t left, std::size_t right){
+                if (values[left] != values[right])
+                    return ascending ? (values[left] < values[right]) : (values[left] > values[right]);
+                else
+                    return left < right;
+            });
+        }
+        else
+            sortListViewItemsInParallel(m_sortedItems, [this](std::size_t left, std::size_t right){ return compareItems(left, right); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateRows()
+    {
+        m_rowItems.clear();
+        m_itemRows.clear();
+
+        if (isSortedOrFiltered())
+        {
+            m_itemRows.resize(m_items.size(), -1);
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+            {
+                const std::size_t index = (m_sortColumn >= 0) ? m_sortedItems[i] : i;
+                if (m_filter && !m_filter(index))
+                    continue;
+
+                m_itemRows[index] = static_cast<int>(m_rowItems.size());
+                m_rowItems.push_back(index);
+            }
+        }
+
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::insertItemIntoRows(std::size_t index)
+    {
+        if (!isSortedOrFiltered())
+            return;
+
+        if (m_itemRows.size() < m_items.size())
+            m_itemRows.resize(m_items.size(), -1);
+
+        const auto compare = [this](std::size_t left, std::size_t right){ return compareItems(left, right); };
+        if (m_sortColumn >= 0)
+            m_sortedItems.insert(std::upper_bound(m_sortedItems.begin(), m_sortedItems.end(), index, compare), index);
+
+        if (m_filter && !m_filter(index))
+            return;
+
+        std::vector<std::size_t>::iterator rowIt;
+        if (m_sortColumn >= 0)
+            rowIt = std::upper_bound(m_rowItems.begin(), m_rowItems.end(), index, compare);
+        else
+            rowIt = std::lower_bound(m_rowItems.begin(), m_rowItems.end(), index);
+
+        // The rows below the inserted item move down
+        const std::size_t row = static_cast<std::size_t>(rowIt - m_rowItems.begin());
+        m_rowItems.insert(rowIt, index);
+        for (std::size_t i = row; i < m_rowItems.size(); ++i)
+            m_itemRows[m_rowItems[i]] = static_cast<int>(i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeItemFromRows(std::size_t index)
+    {
+        if (!isSortedOrFiltered())
+            return;
+
+        if (m_sortColumn >= 0)
+        {
+            const auto it = std::find(m_sortedItems.begin(), m_sortedItems.end(), index);
+            if (it != m_sortedItems.end())
+                m_sortedItems.erase(it);
+        }
+
+        // The rows below the removed item move up
+        const int row = m_itemRows[index];
+        if (row >= 0)
+        {
+            m_rowItems.erase(m_rowItems.begin() + row);
+            for (std::size_t i = static_cast<std::size_t>(row); i < m_rowItems.size(); ++i)
+                m_itemRows[m_rowItems[i]] = static_cast<int>(i);
+        }
+
+        m_itemRows[index] = -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getItemIndexOfRow(std::size_t row) const
+    {
+        if (isSortedOrFiltered())
+            return m_rowItems[row];
+        else
+            return row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getRowOfItem(int item) const
+    {
+        if ((item < 0) || !isSortedOrFiltered())
+            return item;
+        else
+            return m_itemRows[item];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
@@ -1758,14 +2173,15 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t rowCount = getFilteredItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = rowCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > rowCount)
+                lastItem = rowCount;
         }
 
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
@@ -1810,7 +2226,7 @@ namespace tgui
             const Clipping clipping{target, states, {}, {availableWidth, innerHeight - totalHeaderHeight}};
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (rowCount > 0))
             {
                 sf::Transform transformBeforeGridLines = states.transform;
 
@@ -1827,24 +2243,26 @@ namespace tgui
             }
 
             // Draw the background of the selected item
-            if (m_selectedItem >= 0)
+            const int selectedRow = getRowOfItem(m_selectedItem);
+            if (selectedRow >= 0)
             {
-                states.transform.translate({0, m_selectedItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                states.transform.translate({0, selectedRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
 
                 if ((m_selectedItem == m_hoveredItem) && m_selectedBackgroundColorHoverCached.isSet())
                     drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_selectedBackgroundColorHoverCached);
                 else
                     drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_selectedBackgroundColorCached);
 
-                states.transform.translate({0, -m_selectedItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -selectedRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveredItem >= 0) && (m_hoveredItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
+            const int hoveredRow = getRowOfItem(m_hoveredItem);
+            if ((hoveredRow >= 0) && (m_hoveredItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveredItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                states.transform.translate({0, hoveredRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
                 drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
-                states.transform.translate({0, -m_hoveredItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -hoveredRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // We haven't drawn the header yet, so move back up
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/MenuBar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1355,7 +1357,8 @@ namespace tgui
                 else
                     arrow.setFillColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
 
-                target.draw(arrow, states);
+                TGUI_PROFILE_COUNT(DrawCalls);
+                RenderBackend::drawShape(target, arrow, states);
                 states.transform = textTransform;
             }
 
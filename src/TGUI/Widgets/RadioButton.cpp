@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
@@ -663,7 +665,8 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, circle, states);
         }
 
         // Draw the box
@@ -697,7 +700,8 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -705,7 +709,8 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * 0.4f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                TGUI_PROFILE_COUNT(DrawCalls);
+                RenderBackend::drawShape(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
@@ -47,6 +47,7 @@ namespace tgui
         m_renderer = aurora::makeCopied<ScrollablePanelRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
 
+        connectScrollbars();
         setContentSize(contentSize);
     }
 
@@ -62,6 +63,8 @@ namespace tgui
         m_horizontalScrollbarPolicy{other.m_horizontalScrollbarPolicy},
         m_connectedCallbacks       {}
     {
+        connectScrollbars();
+
         if (m_contentSize == Vector2f{0, 0})
         {
             for (auto& widget : m_widgets)
@@ -81,6 +84,7 @@ namespace tgui
         m_horizontalScrollbarPolicy{std::move(other.m_horizontalScrollbarPolicy)},
         m_connectedCallbacks       {std::move(other.m_connectedCallbacks)}
     {
+        connectScrollbars();
         disconnectAllChildWidgets();
 
         if (m_contentSize == Vector2f{0, 0})
@@ -104,6 +108,7 @@ namespace tgui
             m_verticalScrollbarPolicy   = other.m_verticalScrollbarPolicy;
             m_horizontalScrollbarPolicy = other.m_horizontalScrollbarPolicy;
 
+            connectScrollbars();
             disconnectAllChildWidgets();
 
             if (m_contentSize == Vector2f{0, 0})
@@ -130,6 +135,7 @@ namespace tgui
             m_verticalScrollbarPolicy   = std::move(other.m_verticalScrollbarPolicy);
             m_horizontalScrollbarPolicy = std::move(other.m_horizontalScrollbarPolicy);
 
+            connectScrollbars();
             disconnectAllChildWidgets();
 
             if (m_contentSize == Vector2f{0, 0})
@@ -755,6 +761,19 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::connectScrollbars()
+    {
+        // Moved scrollbars still have handlers bound to the old panel, while copied ones don't have any handlers
+        m_verticalScrollbar->onValueChange.disconnectAll();
+        m_horizontalScrollbar->onValueChange.disconnectAll();
+
+        // Scrolling moves the child widgets without changing their position
+        m_verticalScrollbar->onValueChange.connect([this]{ invalidateAbsolutePosition(); });
+        m_horizontalScrollbar->onValueChange.connect([this]{ invalidateAbsolutePosition(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
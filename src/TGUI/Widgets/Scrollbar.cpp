@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,7 +142,6 @@ namespace tgui
         if (m_value != value)
         {
             m_value = value;
-
             onValueChange.emit(this, m_value);
 
             // Recalculate the size and position of the thumb image
@@ -964,7 +965,8 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, arrow, states);
         }
 
         // Draw the track
@@ -1038,7 +1040,8 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, arrow, states);
         }
     }
 
@@ -23,6 +23,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -469,8 +471,10 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, arrowBack, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, arrow, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -535,8 +539,10 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, arrowBack, states);
+            TGUI_PROFILE_COUNT(DrawCalls);
+            RenderBackend::drawShape(target, arrow, states);
         }
     }
 
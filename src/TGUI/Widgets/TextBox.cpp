@@ -26,9 +26,11 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/MappedTextFile.hpp>
 #include <TGUI/Clipping.hpp>
 
 #include <cmath>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -121,13 +123,28 @@ namespace tgui
         updateScrollbars();
 
         // The size of the text box has changed, update the text
-        rearrangeText(true);
+        if (m_deferredReflow.sizeChanged())
+            rearrangeText(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::setVisible(bool visible)
+    {
+        Widget::setVisible(visible);
+
+        // Hidden widgets aren't updated, so a layout that was postponed while the widget was hidden has to be done now
+        if (visible)
+            m_deferredReflow.flush([this]{ rearrangeText(true); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::setText(const sf::String& text)
     {
+        // Changing the text closes the document that was being shown
+        m_document = nullptr;
+
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.getSize() > m_maxChars))
             m_text = text.substring(0, m_maxChars);
@@ -374,7 +391,65 @@ namespace tgui
 
     std::size_t TextBox::getLinesCount() const
     {
-        return m_lines.size();
+        // The layout may have been postponed while the widget wasn't being updated (e.g. because it is hidden)
+        if (m_deferredReflow.isPending())
+        {
+            auto* self = const_cast<TextBox*>(this);
+            self->m_deferredReflow.flush([self]{ self->rearrangeText(true); });
+        }
+
+        if (m_document)
+            return m_document->getLineCount();
+        else
+            return m_lines.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::openDocument(const std::string& filename)
+    {
+        auto document = std::make_shared<MappedTextFile>();
+        document->open(filename);
+
+        m_document = std::move(document);
+        m_text.clear();
+        m_lines = {""};
+        m_selStart = {0, 0};
+        m_selEnd = {0, 0};
+        m_selectionRects.clear();
+        m_maxLineWidth = 0;
+        m_documentLineCount = 0;
+        m_documentFirstLine = 0;
+        m_documentShownLines = 0;
+
+        m_textSelection1.setString("");
+        m_textSelection2.setString("");
+        m_textAfterSelection1.setString("");
+        m_textAfterSelection2.setString("");
+
+        m_verticalScrollbar->setValue(0);
+        m_horizontalScrollbar->setValue(0);
+
+        rearrangeText(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::closeDocument()
+    {
+        if (!m_document)
+            return;
+
+        m_verticalScrollbar->setValue(0);
+        m_horizontalScrollbar->setValue(0);
+        setText("");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::isDocumentOpen() const
+    {
+        return m_document != nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,8 +519,8 @@ namespace tgui
         }
         else // The click occurred on the text box
         {
-            // Don't continue when line height is 0
-            if (m_lineHeight == 0)
+            // Don't continue when line height is 0 or when showing a document, as its text can't be selected
+            if ((m_lineHeight == 0) || m_document)
                 return;
 
             const auto caretPosition = findCaretPosition(pos);
@@ -561,7 +636,7 @@ namespace tgui
         }
 
         // If the mouse is held down then you are selecting text
-        else if (m_mouseDown)
+        else if (m_mouseDown && !m_document)
         {
             const sf::Vector2<std::size_t> caretPosition = findCaretPosition(pos);
             if (caretPosition != m_selEnd)
@@ -621,6 +696,12 @@ namespace tgui
 
     void TextBox::keyPressed(const sf::Event::KeyEvent& event)
     {
+        if (m_document)
+        {
+            documentKeyPressed(event);
+            return;
+        }
+
         switch (event.code)
         {
             case sf::Keyboard::Up:
@@ -1034,7 +1115,7 @@ namespace tgui
 
     void TextBox::textEntered(std::uint32_t key)
     {
-        if (m_readOnly)
+        if (m_readOnly || m_document)
             return;
 
         // Make sure we don't exceed our maximum characters limit
@@ -1232,6 +1313,15 @@ namespace tgui
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
+        // A document is never word-wrapped, only the visible lines have to be laid out again
+        if (m_document)
+        {
+            m_textBeforeSelection.setString("");
+            m_documentShownLines = 0;
+            rearrangeDocument();
+            return;
+        }
+
         sf::String string;
         if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
             string = m_text;
@@ -1414,6 +1504,10 @@ namespace tgui
 
     void TextBox::updateSelectionTexts()
     {
+        // The text of a document is laid out by updateDocumentLines and can't be selected
+        if (m_document)
+            return;
+
         // If there is no selection then just put the whole text in m_textBeforeSelection
         if (m_selStart == m_selEnd)
         {
@@ -1539,6 +1633,12 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
+        m_deferredReflow.update(elapsedTime, [this]{ rearrangeText(true); });
+
+        // Update the scrollbars when the background thread found more lines in the document
+        if (m_document && (m_document->getLineCount() != m_documentLineCount))
+            rearrangeDocument();
+
         // Only show/hide the caret every half second
         if (m_animationTimeElapsed >= sf::milliseconds(500))
         {
@@ -1661,7 +1761,8 @@ namespace tgui
             m_horizontalScrollbar->setPosition(m_bordersCached.getLeft(), getSize().y - m_bordersCached.getBottom() - m_horizontalScrollbar->getSize().y);
         }
 
-        m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
+        const std::size_t lineCount = m_document ? m_documentLineCount : m_lines.size();
+        m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), lineCount);
 
         // Store which area is visible
         if (m_verticalScrollbar->isShown())
@@ -1677,12 +1778,137 @@ namespace tgui
         else // There is no scrollbar
         {
             m_topLine = 0;
-            m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
+            m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), lineCount);
+        }
+
+        if (m_document)
+            updateDocumentLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rearrangeDocument()
+    {
+        m_documentLineCount = m_document->getLineCount();
+
+        updateScrollbars();
+
+        const bool verticalScrollbarShown = m_verticalScrollbar->isShown();
+        const bool horizontalScrollbarShown = m_horizontalScrollbar->isShown();
+
+        // The scrollbar can't go further than the largest unsigned int, so the end of an extremely large file can't be reached
+        const double textHeight = static_cast<double>(m_documentLineCount) * m_lineHeight
+                                  + static_cast<double>(Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
+                                                        + Text::getExtraVerticalPadding(m_textSize));
+        m_verticalScrollbar->setMaximum(static_cast<unsigned int>(std::min<double>(textHeight, std::numeric_limits<unsigned int>::max())));
+
+        m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxLineWidth
+                                                                    + Text::getExtraHorizontalPadding(m_fontCached, m_textSize) * 2));
+
+        if ((verticalScrollbarShown != m_verticalScrollbar->isShown()) || (horizontalScrollbarShown != m_horizontalScrollbar->isShown()))
+            updateScrollbars();
+
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateDocumentLines()
+    {
+        const std::size_t firstLine = std::min(m_topLine, m_documentLineCount);
+        const std::size_t shownLines = std::min(m_visibleLines + 1, m_documentLineCount - firstLine);
+        if ((firstLine == m_documentFirstLine) && (shownLines == m_documentShownLines))
+            return;
+
+        m_documentFirstLine = firstLine;
+        m_documentShownLines = shownLines;
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        float maxLineWidth = m_maxLineWidth;
+
+        sf::String displayedText;
+        for (const auto& line : m_document->getLines(firstLine, shownLines))
+        {
+            // The width of the document is only known for the lines that have been shown
+            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+                maxLineWidth = std::max(maxLineWidth, Text::getLineWidth(line, m_fontCached, m_textSize));
+
+            displayedText += line + "\n";
+        }
+
+        m_textBeforeSelection.setString(displayedText);
+        m_textBeforeSelection.setPosition({textOffset, 0});
+
+        if (maxLineWidth > m_maxLineWidth)
+        {
+            m_maxLineWidth = maxLineWidth;
+
+            const bool horizontalScrollbarShown = m_horizontalScrollbar->isShown();
+            m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxLineWidth + textOffset * 2));
+
+            // The horizontal scrollbar takes away space for the lines when it appears
+            if (horizontalScrollbarShown != m_horizontalScrollbar->isShown())
+            {
+                updateScrollbars();
+                recalculateVisibleLines();
+            }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::documentKeyPressed(const sf::Event::KeyEvent& event)
+    {
+        const unsigned int verticalValue = m_verticalScrollbar->getValue();
+        const unsigned int horizontalValue = m_horizontalScrollbar->getValue();
+        const unsigned int pageHeight = std::max(m_verticalScrollbar->getViewportSize(), m_lineHeight);
+
+        switch (event.code)
+        {
+            case sf::Keyboard::Up:
+                m_verticalScrollbar->setValue(verticalValue - std::min(verticalValue, m_lineHeight));
+                break;
+
+            case sf::Keyboard::Down:
+                m_verticalScrollbar->setValue(verticalValue + std::min(m_lineHeight, std::numeric_limits<unsigned int>::max() - verticalValue));
+                break;
+
+            case sf::Keyboard::PageUp:
+                m_verticalScrollbar->setValue(verticalValue - std::min(verticalValue, pageHeight));
+                break;
+
+            case sf::Keyboard::PageDown:
+                m_verticalScrollbar->setValue(verticalValue + std::min(pageHeight, std::numeric_limits<unsigned int>::max() - verticalValue));
+                break;
+
+            case sf::Keyboard::Left:
+                m_horizontalScrollbar->setValue(horizontalValue - std::min(horizontalValue, m_textSize));
+                break;
+
+            case sf::Keyboard::Right:
+                m_horizontalScrollbar->setValue(horizontalValue + m_textSize);
+                break;
+
+            case sf::Keyboard::Home:
+                if (event.control)
+                    m_verticalScrollbar->setValue(0);
+                m_horizontalScrollbar->setValue(0);
+                break;
+
+            case sf::Keyboard::End:
+                if (event.control)
+                    m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum());
+                break;
+
+            default:
+                return;
+        }
+
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& TextBox::getSignal(std::string signalName)
     {
         if (signalName == toLower(onTextChange.getName()))
@@ -1910,7 +2136,15 @@ namespace tgui
             const Clipping clipping{target, states, {}, {clipWidth, clipHeight}};
 
             // Move the text according to the scrollars
-            states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()), -static_cast<float>(m_verticalScrollbar->getValue())});
+            if (m_document)
+            {
+                // Only the visible lines of a document are in the text, which starts at the first shown line.
+                // The offset is calculated before converting to float to not lose precision in very large documents.
+                const double verticalOffset = static_cast<double>(m_documentFirstLine) * m_lineHeight - m_verticalScrollbar->getValue();
+                states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()), static_cast<float>(verticalOffset)});
+            }
+            else
+                states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()), -static_cast<float>(m_verticalScrollbar->getValue())});
 
             // Draw the background of the selected text
             for (const auto& selectionRect : m_selectionRects)
@@ -1931,7 +2165,7 @@ namespace tgui
             }
 
             // Only draw the caret when needed
-            if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
+            if (m_focused && m_caretVisible && (m_caretWidthCached > 0) && !m_document)
             {
                 const float caretHeight = m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
                 states.transform.translate({std::ceil(m_caretPosition.x - (m_caretWidthCached / 2.f)), m_caretPosition.y});
@@ -199,4 +199,196 @@ TEST_CASE("[Animation]") {
 
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("TweenEngine") {
+        tgui::TweenEngine tweens;
+        REQUIRE(tweens.getTweenCount() == 0);
+
+        SECTION("Easing") {
+            for (auto easing : {tgui::Easing::Linear, tgui::Easing::QuadraticIn, tgui::Easing::QuadraticOut, tgui::Easing::QuadraticInOut,
+                                tgui::Easing::CubicIn, tgui::Easing::CubicOut, tgui::Easing::CubicInOut})
+            {
+                REQUIRE(tgui::TweenEngine::applyEasing(easing, 0) == 0);
+                REQUIRE(tgui::TweenEngine::applyEasing(easing, 1) == 1);
+            }
+
+            REQUIRE(tgui::TweenEngine::applyEasing(tgui::Easing::Linear, 0.25f) == 0.25f);
+            REQUIRE(tgui::TweenEngine::applyEasing(tgui::Easing::QuadraticIn, 0.5f) == 0.25f);
+            REQUIRE(tgui::TweenEngine::applyEasing(tgui::Easing::QuadraticOut, 0.5f) == 0.75f);
+            REQUIRE(tgui::TweenEngine::applyEasing(tgui::Easing::CubicIn, 0.5f) == 0.125f);
+            REQUIRE(tgui::TweenEngine::applyEasing(tgui::Easing::CubicOut, 0.5f) == 0.875f);
+        }
+
+        SECTION("Custom tween") {
+            float value = 0;
+            unsigned int finishedCount = 0;
+            const auto id = tweens.tween(10, 50, sf::milliseconds(400), [&](float v){ value = v; },
+                                         tgui::Easing::QuadraticIn, [&]{ finishedCount++; });
+            REQUIRE(tweens.isRunning(id));
+            REQUIRE(tweens.getTweenCount() == 1);
+
+            tweens.update(sf::milliseconds(200));
+            REQUIRE(value == 20);
+            REQUIRE(finishedCount == 0);
+
+            tweens.update(sf::milliseconds(200));
+            REQUIRE(value == 50);
+            REQUIRE(finishedCount == 1);
+            REQUIRE(!tweens.isRunning(id));
+            REQUIRE(tweens.getTweenCount() == 0);
+
+            tweens.update(sf::milliseconds(200));
+            REQUIRE(value == 50);
+            REQUIRE(finishedCount == 1);
+        }
+
+        SECTION("Finish and cancel") {
+            sf::Vector2f value;
+            unsigned int finishedCount = 0;
+            const auto id1 = tweens.tween({0, 0}, {100, 200}, sf::milliseconds(300), [&](sf::Vector2f v){ value = v; },
+                                          tgui::Easing::Linear, [&]{ finishedCount++; });
+            const auto id2 = tweens.tween(0, 1, sf::milliseconds(300), [](float){}, tgui::Easing::Linear, [&]{ finishedCount += 10; });
+            REQUIRE(id1 != id2);
+            REQUIRE(tweens.getTweenCount() == 2);
+
+            tweens.update(sf::milliseconds(100));
+            REQUIRE(compareVector2f(value, {100/3.f, 200/3.f}));
+
+            tweens.cancel(id2);
+            REQUIRE(!tweens.isRunning(id2));
+            REQUIRE(tweens.getTweenCount() == 1);
+            REQUIRE(finishedCount == 0);
+
+            tweens.finish(id1);
+            REQUIRE(!tweens.isRunning(id1));
+            REQUIRE(value == sf::Vector2f(100, 200));
+            REQUIRE(tweens.getTweenCount() == 0);
+            REQUIRE(finishedCount == 1);
+        }
+
+        SECTION("Widget tweens") {
+            tweens.moveWidget(widget, {0, 0}, {90, 60}, sf::milliseconds(300));
+            tweens.resizeWidget(widget, {0, 0}, {300, 150}, sf::milliseconds(300));
+            tweens.fadeWidget(widget, 0, 0.6f, sf::milliseconds(300));
+            REQUIRE(tweens.getTweenCount() == 3);
+
+            tweens.update(sf::milliseconds(100));
+            REQUIRE(compareVector2f(widget->getPosition(), {30, 20}));
+            REQUIRE(compareVector2f(widget->getSize(), {100, 50}));
+            REQUIRE(std::abs(widget->getInheritedOpacity() - 0.2f) < 0.0001f);
+
+            // Starting a new tween on the same property finishes the previous one
+            tweens.moveWidget(widget, {0, 0}, {10, 10}, sf::milliseconds(300));
+            REQUIRE(widget->getPosition() == sf::Vector2f(90, 60));
+            REQUIRE(tweens.getTweenCount() == 3);
+
+            tweens.update(sf::milliseconds(200));
+            REQUIRE(widget->getSize() == sf::Vector2f(300, 150));
+            REQUIRE(widget->getInheritedOpacity() == 0.6f);
+            REQUIRE(tweens.getTweenCount() == 1);
+        }
+
+        SECTION("Tweens of hidden widgets are paused") {
+            tweens.moveWidget(widget, {0, 0}, {90, 60}, sf::milliseconds(300));
+
+            widget->setVisible(false);
+            tweens.update(sf::milliseconds(100));
+            REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+
+            widget->setVisible(true);
+            tweens.update(sf::milliseconds(100));
+            REQUIRE(compareVector2f(widget->getPosition(), {30, 20}));
+
+            parent->setVisible(false);
+            tweens.update(sf::milliseconds(100));
+            REQUIRE(compareVector2f(widget->getPosition(), {30, 20}));
+            parent->setVisible(true);
+
+            parent->remove(widget);
+            tweens.update(sf::milliseconds(100));
+            REQUIRE(compareVector2f(widget->getPosition(), {30, 20}));
+            REQUIRE(tweens.getTweenCount() == 1);
+
+            parent->add(widget);
+            tweens.update(sf::milliseconds(200));
+            REQUIRE(widget->getPosition() == sf::Vector2f(90, 60));
+            REQUIRE(tweens.getTweenCount() == 0);
+        }
+
+        SECTION("Tweens of destroyed widgets are dropped") {
+            unsigned int finishedCount = 0;
+            tweens.moveWidget(widget, {0, 0}, {90, 60}, sf::milliseconds(300), tgui::Easing::Linear, [&]{ finishedCount++; });
+
+            std::weak_ptr<tgui::Widget> weakWidget = widget;
+            parent->remove(widget);
+            widget = nullptr;
+            REQUIRE(weakWidget.expired());
+
+            tweens.update(sf::milliseconds(300));
+            REQUIRE(tweens.getTweenCount() == 0);
+            REQUIRE(finishedCount == 0);
+        }
+    }
+
+    SECTION("Effects inside gui") {
+        sf::RenderTexture target;
+        target.create(480, 360);
+        tgui::Gui gui{target};
+        gui.setAutomaticTimeUpdateEnabled(false);
+        gui.add(parent);
+
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        REQUIRE(gui.getTweenEngine().getTweenCount() == 1);
+
+        gui.updateTime(sf::milliseconds(100));
+        REQUIRE(std::abs(widget->getInheritedOpacity() - 0.3f) < 0.0001f);
+
+        gui.updateTime(sf::milliseconds(200));
+        REQUIRE(widget->getInheritedOpacity() == 0.9f);
+        REQUIRE(gui.getTweenEngine().getTweenCount() == 0);
+
+        SECTION("Widget is released when removed during animation") {
+            bool finished = false;
+            widget->connect("AnimationFinished", [&]{ finished = true; });
+            widget->hideWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+            gui.updateTime(sf::milliseconds(100));
+
+            std::weak_ptr<tgui::Widget> weakWidget = widget;
+            parent->remove(widget);
+            widget = nullptr;
+            REQUIRE(weakWidget.expired());
+
+            gui.updateTime(sf::milliseconds(300));
+            REQUIRE(gui.getTweenEngine().getTweenCount() == 0);
+            REQUIRE(!finished);
+        }
+    }
+
+    SECTION("Effect started before adding to gui with its own context") {
+        parent->remove(widget);
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        REQUIRE(widget->getInheritedOpacity() == 0);
+
+        sf::RenderTexture target;
+        target.create(480, 360);
+        tgui::Context::Scope scope{tgui::Context::create()};
+        tgui::Gui gui{target};
+        gui.setAutomaticTimeUpdateEnabled(false);
+        gui.add(widget);
+
+        gui.updateTime(sf::milliseconds(100));
+        REQUIRE(std::abs(widget->getInheritedOpacity() - 0.3f) < 0.0001f);
+
+        gui.updateTime(sf::milliseconds(200));
+        REQUIRE(widget->getInheritedOpacity() == 0.9f);
+    }
+
+    SECTION("Widget that is animated before being added is released") {
+        parent->remove(widget);
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+
+        std::weak_ptr<tgui::Widget> weakWidget = widget;
+        widget = nullptr;
+        REQUIRE(weakWidget.expired());
+    }
 }
@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/CommandQueue.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("[CommandQueue]")
+{
+    tgui::CommandQueue queue;
+
+    SECTION("Empty")
+    {
+        REQUIRE(queue.execute() == 0);
+
+        const tgui::CommandQueueStats stats = queue.getStats();
+        REQUIRE(stats.postedCommands == 0);
+        REQUIRE(stats.executedCommands == 0);
+        REQUIRE(stats.pendingCommands == 0);
+    }
+
+    SECTION("Order")
+    {
+        std::vector<int> values;
+        for (int i = 0; i < 5; ++i)
+            queue.post([&values,i]{ values.push_back(i); });
+
+        REQUIRE(queue.getStats().pendingCommands == 5);
+        REQUIRE(values.empty());
+
+        REQUIRE(queue.execute() == 5);
+        REQUIRE(values == std::vector<int>{0, 1, 2, 3, 4});
+        REQUIRE(queue.getStats().pendingCommands == 0);
+        REQUIRE(queue.getStats().peakPendingCommands == 5);
+
+        // Commands may post new commands
+        queue.post([&]{ queue.post([&values]{ values.push_back(6); }); values.push_back(5); });
+        REQUIRE(queue.execute() == 2);
+        REQUIRE(values == std::vector<int>{0, 1, 2, 3, 4, 5, 6});
+    }
+
+    SECTION("Batches")
+    {
+        unsigned int count = 0;
+        for (int i = 0; i < 10; ++i)
+            queue.post([&count]{ count++; });
+
+        REQUIRE(queue.execute(4) == 4);
+        REQUIRE(queue.execute(4) == 4);
+        REQUIRE(queue.execute(4) == 2);
+        REQUIRE(count == 10);
+
+        const tgui::CommandQueueStats stats = queue.getStats();
+        REQUIRE(stats.postedCommands == 10);
+        REQUIRE(stats.executedCommands == 10);
+        REQUIRE(stats.throttledBatches == 2);
+    }
+
+    SECTION("Multiple producers")
+    {
+        const int threadCount = 4;
+        const int commandsPerThread = 1000;
+
+        std::vector<std::vector<int>> values(threadCount);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&queue,&values,t]{
+                for (int i = 0; i < commandsPerThread; ++i)
+                    queue.post([&values,t,i]{ values[t].push_back(i); });
+            });
+        }
+
+        // Execute while the producers are still posting
+        std::size_t executed = 0;
+        while (executed < threadCount * commandsPerThread)
+            executed += queue.execute(100);
+
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(queue.execute() == 0);
+        for (int t = 0; t < threadCount; ++t)
+        {
+            REQUIRE(values[t].size() == commandsPerThread);
+            for (int i = 0; i < commandsPerThread; ++i)
+                REQUIRE(values[t][i] == i);
+        }
+    }
+
+    SECTION("Pending commands are discarded on destruction")
+    {
+        auto value = std::make_shared<int>(0);
+        {
+            tgui::CommandQueue otherQueue;
+            otherQueue.post([value]{ (*value)++; });
+            REQUIRE(value.use_count() == 2);
+        }
+
+        REQUIRE(value.use_count() == 1);
+        REQUIRE(*value == 0);
+    }
+}
@@ -130,6 +130,55 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("renaming")
+        {
+            REQUIRE(container->get("w1") == widget1);
+            container->setWidgetName(widget1, "renamed");
+            REQUIRE(container->get("w1") == nullptr);
+            REQUIRE(container->get("renamed") == widget1);
+
+            widget2->setWidgetName(widget5, "w4");
+            REQUIRE(container->get("w4") == widget4);
+            widget2->remove(widget4);
+            REQUIRE(container->get("w4") == widget5);
+        }
+
+        SECTION("path")
+        {
+            auto panel = tgui::Panel::create();
+            auto label = tgui::Label::create();
+            widget2->add(panel, "Settings");
+            panel->add(label, "Volume");
+
+            REQUIRE(container->get("w2/w4") == widget4);
+            REQUIRE(container->get("w2/Settings") == panel);
+            REQUIRE(container->get("w2/Settings/Volume") == label);
+            REQUIRE(container->get<tgui::Label>("w2/Settings/Volume") == label);
+            REQUIRE(widget2->get("Settings/Volume") == label);
+
+            REQUIRE(container->get("w2/Volume") == nullptr);
+            REQUIRE(container->get("w1/w4") == nullptr);
+            REQUIRE(container->get("w2/Settings/") == nullptr);
+            REQUIRE(container->get("/w1") == nullptr);
+
+            // Names containing a slash can still be found directly
+            panel->add(tgui::Label::create(), "a/b");
+            REQUIRE(container->get("a/b") == panel->get("a/b"));
+            REQUIRE(container->get("w2/Settings/a/b") == nullptr);
+            REQUIRE(container->get("a/b") != nullptr);
+        }
+
+        SECTION("BoxLayout insert")
+        {
+            auto layout = tgui::VerticalLayout::create();
+            layout->add(tgui::Label::create(), "name");
+            REQUIRE(layout->get("name") == layout->getWidgets()[0]);
+
+            auto inserted = tgui::Label::create();
+            layout->insert(0, inserted, "name");
+            REQUIRE(layout->get("name") == inserted);
+        }
     }
 
     SECTION("remove")
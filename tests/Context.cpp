@@ -0,0 +1,189 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Context.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <thread>
+
+TEST_CASE("[Context]")
+{
+    REQUIRE(tgui::Context::getCurrent() == tgui::Context::getDefault());
+
+    SECTION("Scope")
+    {
+        auto context = tgui::Context::create();
+        REQUIRE(context != tgui::Context::getDefault());
+        {
+            tgui::Context::Scope scope{context};
+            REQUIRE(tgui::Context::getCurrent() == context);
+
+            {
+                tgui::Context::Scope innerScope{tgui::Context::getDefault()};
+                REQUIRE(tgui::Context::getCurrent() == tgui::Context::getDefault());
+            }
+
+            REQUIRE(tgui::Context::getCurrent() == context);
+        }
+        REQUIRE(tgui::Context::getCurrent() == tgui::Context::getDefault());
+    }
+
+    SECTION("TextSize")
+    {
+        auto context = tgui::Context::create();
+        REQUIRE(context->getTextSize() == 13);
+
+        {
+            tgui::Context::Scope scope{context};
+            tgui::setGlobalTextSize(20);
+            REQUIRE(tgui::getGlobalTextSize() == 20);
+            REQUIRE(tgui::Label::create()->getTextSize() == 20);
+        }
+
+        REQUIRE(context->getTextSize() == 20);
+        REQUIRE(tgui::getGlobalTextSize() == 13);
+        REQUIRE(tgui::Label::create()->getTextSize() == 13);
+    }
+
+    SECTION("Font")
+    {
+        auto context = tgui::Context::create();
+        REQUIRE(context->getFont() != nullptr);
+        REQUIRE(context->getInternalFont() != tgui::getInternalGlobalFont());
+
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        context->setFont(font);
+        REQUIRE(context->getInternalFont() == font.getFont());
+        REQUIRE(tgui::getInternalGlobalFont() != font.getFont());
+    }
+
+    SECTION("Default theme")
+    {
+        tgui::Theme theme;
+        auto context = tgui::Context::create();
+
+        {
+            tgui::Context::Scope scope{context};
+            tgui::Theme::setDefault(&theme);
+            REQUIRE(tgui::Theme::getDefault() == &theme);
+        }
+
+        REQUIRE(tgui::Theme::getDefault() != &theme);
+
+        {
+            tgui::Context::Scope scope{context};
+            REQUIRE(tgui::Theme::getDefault() == &theme);
+            tgui::Theme::setDefault(nullptr);
+        }
+    }
+
+    SECTION("Destroyed default theme")
+    {
+        auto context = tgui::Context::create();
+        tgui::Context::Scope scope{context};
+
+        auto theme = std::make_unique<tgui::Theme>();
+        tgui::Theme::setDefault(theme.get());
+        theme = nullptr;
+        REQUIRE(tgui::Theme::getDefault() != nullptr);
+    }
+
+    SECTION("Gui")
+    {
+        auto context = tgui::Context::create();
+        context->setTextSize(17);
+
+        std::unique_ptr<tgui::Gui> gui;
+        {
+            tgui::Context::Scope scope{context};
+            gui = std::make_unique<tgui::Gui>();
+        }
+
+        REQUIRE(gui->getContext() == context);
+        REQUIRE(std::make_shared<tgui::Gui>()->getContext() == tgui::Context::getDefault());
+    }
+
+    SECTION("Thread")
+    {
+        unsigned int workerTextSize = 0;
+        unsigned int labelTextSize = 0;
+        bool defaultContextInWorker = true;
+        std::thread worker([&]{
+            // Each thread starts with the default context until it selects another one
+            defaultContextInWorker = (tgui::Context::getCurrent() == tgui::Context::getDefault());
+
+            tgui::Context::setCurrent(tgui::Context::create());
+            tgui::setGlobalTextSize(30);
+            workerTextSize = tgui::getGlobalTextSize();
+            labelTextSize = tgui::Label::create()->getTextSize();
+            tgui::Context::setCurrent(nullptr);
+        });
+        worker.join();
+
+        REQUIRE(defaultContextInWorker);
+        REQUIRE(workerTextSize == 30);
+        REQUIRE(labelTextSize == 30);
+        REQUIRE(tgui::getGlobalTextSize() == 13);
+    }
+
+    SECTION("Theme file shared between threads")
+    {
+        // Both threads parse the same cached theme properties, but every context has to get its own font
+        const unsigned int threadCount = 2;
+        std::shared_ptr<sf::Font> fonts[threadCount];
+        bool fontsSharedInContext[threadCount] = {};
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&fonts,&fontsSharedInContext,t]{
+                tgui::Context::Scope scope{tgui::Context::create()};
+                tgui::Gui gui;
+                tgui::Theme theme1{"resources/ThemeFont.txt"};
+                tgui::Theme theme2{"resources/ThemeFont.txt"};
+                for (unsigned int i = 0; i < 10; ++i)
+                {
+                    auto label = tgui::Label::create("Text");
+                    label->setRenderer(((i % 2) ? theme1 : theme2).getRenderer("Label"));
+                    gui.add(label, "Label" + tgui::to_string(i));
+                }
+
+                fonts[t] = gui.get<tgui::Label>("Label0")->getSharedRenderer()->getFont().getFont();
+                fontsSharedInContext[t] = (gui.get<tgui::Label>("Label1")->getSharedRenderer()->getFont().getFont() == fonts[t]);
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (unsigned int t = 0; t < threadCount; ++t)
+        {
+            REQUIRE(fonts[t] != nullptr);
+            REQUIRE(fontsSharedInContext[t]);
+        }
+        REQUIRE(fonts[0] != fonts[1]);
+    }
+}
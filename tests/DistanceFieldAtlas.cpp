@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <TGUI/Text.hpp>
+#include <thread>
+
+TEST_CASE("[DistanceFieldAtlas]")
+{
+    tgui::Font font{"resources/DejaVuSans.ttf"};
+
+    SECTION("Shared per font")
+    {
+        REQUIRE(tgui::DistanceFieldAtlas::getAtlas(nullptr) == nullptr);
+
+        auto atlas = tgui::DistanceFieldAtlas::getAtlas(font.getFont());
+        REQUIRE(atlas != nullptr);
+        REQUIRE(tgui::DistanceFieldAtlas::getAtlas(font.getFont()) == atlas);
+
+        tgui::Font otherFont{"resources/DejaVuSans.ttf"};
+        REQUIRE(tgui::DistanceFieldAtlas::getAtlas(otherFont.getFont()) != atlas);
+
+        // Other threads share the same atlas
+        std::shared_ptr<tgui::DistanceFieldAtlas> workerAtlas;
+        std::thread worker([&]{ workerAtlas = tgui::DistanceFieldAtlas::getAtlas(font.getFont()); });
+        worker.join();
+        REQUIRE(workerAtlas == atlas);
+
+        // A font that is created after the previous one was destroyed gets its own atlas, even at the same address
+        std::shared_ptr<tgui::DistanceFieldAtlas> temporaryAtlas;
+        {
+            auto temporaryFont = std::make_shared<sf::Font>(*font.getFont());
+            temporaryAtlas = tgui::DistanceFieldAtlas::getAtlas(temporaryFont);
+        }
+        auto newFont = std::make_shared<sf::Font>(*font.getFont());
+        REQUIRE(tgui::DistanceFieldAtlas::getAtlas(newFont) != temporaryAtlas);
+    }
+
+    SECTION("Glyphs")
+    {
+        auto atlas = tgui::DistanceFieldAtlas::getAtlas(font.getFont());
+        atlas->addGlyphs("ab", false);
+
+        const sf::Glyph& fontGlyph = font.getGlyph('a', tgui::DistanceFieldAtlas::BaseCharacterSize, false);
+        const tgui::DistanceFieldAtlas::Glyph& glyph = atlas->getGlyph('a', false);
+        REQUIRE(glyph.advance == fontGlyph.advance);
+        REQUIRE(glyph.textureRect.width == fontGlyph.textureRect.width + 2 * static_cast<int>(tgui::DistanceFieldAtlas::Spread));
+        REQUIRE(glyph.textureRect.height == fontGlyph.textureRect.height + 2 * static_cast<int>(tgui::DistanceFieldAtlas::Spread));
+        REQUIRE(glyph.bounds.left == fontGlyph.bounds.left - tgui::DistanceFieldAtlas::Spread);
+
+        // Glyphs don't overlap each other or the solid block used for underlines
+        const sf::IntRect& otherRect = atlas->getGlyph('b', false).textureRect;
+        REQUIRE(!glyph.textureRect.intersects(otherRect));
+        REQUIRE(!glyph.textureRect.intersects(sf::IntRect{atlas->getSolidTextureRect()}));
+
+        REQUIRE(atlas->getGlyph('a', true).advance >= glyph.advance);
+        REQUIRE(atlas->getGlyph(' ', false).textureRect.width == 0);
+    }
+
+    SECTION("Text")
+    {
+        REQUIRE(!tgui::Text::isDistanceFieldRenderingEnabled());
+
+        tgui::Text text;
+        text.setFont(font);
+        text.setCharacterSize(tgui::DistanceFieldAtlas::BaseCharacterSize);
+        text.setString("Some text");
+        const sf::Vector2f size = text.getSize();
+
+        tgui::Text::setDistanceFieldRendering(true);
+        REQUIRE(tgui::Text::isDistanceFieldRenderingEnabled());
+
+        // At the base size the metrics are identical, at other sizes they scale with the character size
+        tgui::Text text2;
+        text2.setFont(font);
+        text2.setCharacterSize(tgui::DistanceFieldAtlas::BaseCharacterSize);
+        text2.setString("Some text");
+        REQUIRE(text2.getSize() == size);
+
+        text2.setCharacterSize(tgui::DistanceFieldAtlas::BaseCharacterSize * 2);
+        REQUIRE(text2.getSize().x == Approx(size.x * 2).epsilon(0.02));
+
+        tgui::Text::setDistanceFieldRendering(false);
+    }
+}
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/EventRecording.hpp>
+#include <sstream>
+
+TEST_CASE("[EventRecording]")
+{
+    tgui::EventRecording recording;
+
+    SECTION("Entries")
+    {
+        REQUIRE(recording.getEntries().empty());
+        REQUIRE(recording.getFrameCount() == 0);
+
+        sf::Event event;
+        event.type = sf::Event::TextEntered;
+        event.text.unicode = 'a';
+        recording.addEvent(sf::milliseconds(5), event);
+        recording.addUpdate(sf::milliseconds(16), sf::milliseconds(16));
+
+        REQUIRE(recording.getEntries().size() == 2);
+        REQUIRE(recording.getFrameCount() == 1);
+        REQUIRE(recording.getEntries()[0].timestamp == sf::milliseconds(5));
+        REQUIRE(recording.getEntries()[0].event.text.unicode == 'a');
+        REQUIRE(recording.getEntries()[1].elapsedTime == sf::milliseconds(16));
+
+        recording.clear();
+        REQUIRE(recording.getEntries().empty());
+    }
+
+    SECTION("Saving and loading")
+    {
+        recording.setTargetSize({800, 600});
+        recording.setView({10, 20, 400, 300});
+
+        sf::Event event;
+        event.type = sf::Event::KeyPressed;
+        event.key.code = sf::Keyboard::Left;
+        event.key.alt = false;
+        event.key.control = true;
+        event.key.shift = true;
+        event.key.system = false;
+        recording.addEvent(sf::microseconds(1500), event);
+
+        event.type = sf::Event::MouseWheelScrolled;
+        event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+        event.mouseWheelScroll.delta = -2.5f;
+        event.mouseWheelScroll.x = -30;
+        event.mouseWheelScroll.y = 70000;
+        recording.addEvent(sf::milliseconds(10), event);
+
+        event.type = sf::Event::LostFocus;
+        recording.addEvent(sf::milliseconds(12), event);
+
+        recording.addUpdate(sf::milliseconds(16), sf::milliseconds(16));
+        recording.addViewChange(sf::milliseconds(20), {0, 0, 1024, 768}, {1024, 768});
+
+        std::stringstream stream;
+        recording.saveToStream(stream);
+
+        tgui::EventRecording loadedRecording;
+        loadedRecording.loadFromStream(stream);
+        REQUIRE(loadedRecording.getTargetSize() == sf::Vector2u(800, 600));
+        REQUIRE(loadedRecording.getView() == sf::FloatRect(10, 20, 400, 300));
+
+        const auto& entries = loadedRecording.getEntries();
+        REQUIRE(entries.size() == 5);
+        REQUIRE(entries[0].timestamp == sf::microseconds(1500));
+        REQUIRE(entries[0].event.type == sf::Event::KeyPressed);
+        REQUIRE(entries[0].event.key.code == sf::Keyboard::Left);
+        REQUIRE(!entries[0].event.key.alt);
+        REQUIRE(entries[0].event.key.control);
+        REQUIRE(entries[0].event.key.shift);
+        REQUIRE(!entries[0].event.key.system);
+        REQUIRE(entries[1].timestamp == sf::milliseconds(10));
+        REQUIRE(entries[1].event.type == sf::Event::MouseWheelScrolled);
+        REQUIRE(entries[1].event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel);
+        REQUIRE(entries[1].event.mouseWheelScroll.delta == -2.5f);
+        REQUIRE(entries[1].event.mouseWheelScroll.x == -30);
+        REQUIRE(entries[1].event.mouseWheelScroll.y == 70000);
+        REQUIRE(entries[2].event.type == sf::Event::LostFocus);
+        REQUIRE(entries[3].type == tgui::EventRecording::Entry::Type::Update);
+        REQUIRE(entries[3].timestamp == sf::milliseconds(16));
+        REQUIRE(entries[3].elapsedTime == sf::milliseconds(16));
+        REQUIRE(entries[4].type == tgui::EventRecording::Entry::Type::View);
+        REQUIRE(entries[4].timestamp == sf::milliseconds(20));
+        REQUIRE(entries[4].view == sf::FloatRect(0, 0, 1024, 768));
+        REQUIRE(entries[4].targetSize == sf::Vector2u(1024, 768));
+
+        // The file format is compact, small events only take a few bytes
+        REQUIRE(stream.str().size() <= 96);
+    }
+
+    SECTION("Invalid data")
+    {
+        std::stringstream stream1{"not a recording"};
+        REQUIRE_THROWS_AS(recording.loadFromStream(stream1), tgui::Exception);
+
+        recording.addUpdate(sf::milliseconds(16), sf::milliseconds(16));
+        std::stringstream stream2;
+        recording.saveToStream(stream2);
+
+        // Truncated data
+        std::stringstream stream3{stream2.str().substr(0, stream2.str().size() - 1)};
+        REQUIRE_THROWS_AS(recording.loadFromStream(stream3), tgui::Exception);
+
+        // The recording isn't changed when loading fails
+        REQUIRE(recording.getEntries().size() == 1);
+
+        REQUIRE_THROWS_AS(recording.loadFromFile("NonExistentFile.rec"), tgui::Exception);
+    }
+}
@@ -35,4 +35,33 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("Prewarming glyphs")
+    {
+        tgui::Font::processGlyphPrewarming(sf::Time::Zero);
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 0);
+
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        font.prewarmGlyphs({20}, sf::Text::Regular, "abc");
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 3);
+
+        font.prewarmGlyphs({20, 30}, sf::Text::Bold | sf::Text::Italic, "ab");
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 3 + 4);
+
+        font.prewarmGlyphs({20}, "Underlined");
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 3 + 4 + 95);
+
+        // Nothing is queued without a font or sizes
+        tgui::Font().prewarmGlyphs({20});
+        font.prewarmGlyphs({});
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 3 + 4 + 95);
+
+        REQUIRE(!tgui::Font::processGlyphPrewarming(sf::Time::Zero));
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 0);
+
+        // Glyphs of fonts that were destroyed are skipped
+        tgui::Font{"resources/DejaVuSans.ttf"}.prewarmGlyphs({20});
+        REQUIRE(!tgui::Font::processGlyphPrewarming(sf::Time::Zero));
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 0);
+    }
 }
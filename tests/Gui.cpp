@@ -0,0 +1,386 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/DeferredReflow.hpp>
+#include <thread>
+
+namespace
+{
+    // Remembers the wheel scroll events that reach the widget
+    struct WheelRecordingWidget : public tgui::ClickableWidget
+    {
+        bool mouseWheelScrolled(float delta, tgui::Vector2f pos) override
+        {
+            scrolls.emplace_back(delta, pos);
+            return true;
+        }
+
+        std::vector<std::pair<float, sf::Vector2f>> scrolls;
+    };
+
+    sf::Event makeMouseMoveEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+
+    sf::Event makeMouseButtonEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = x;
+        event.mouseButton.y = y;
+        return event;
+    }
+
+    sf::Event makeMouseWheelEvent(float delta, int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseWheelScrolled;
+        event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+        event.mouseWheelScroll.delta = delta;
+        event.mouseWheelScroll.x = x;
+        event.mouseWheelScroll.y = y;
+        return event;
+    }
+}
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(200, 200);
+    tgui::Gui gui{target};
+
+    auto widget = tgui::ClickableWidget::create();
+    widget->setPosition(50, 50);
+    widget->setSize(100, 100);
+    gui.add(widget);
+
+    SECTION("handleEvents")
+    {
+        unsigned int mouseEnteredCount = 0;
+        unsigned int mouseLeftCount = 0;
+        unsigned int clickedCount = 0;
+        widget->connect("MouseEntered", [&]{ mouseEnteredCount++; });
+        widget->connect("MouseLeft", [&]{ mouseLeftCount++; });
+        widget->connect("Clicked", [&]{ clickedCount++; });
+
+        SECTION("Empty")
+        {
+            const tgui::EventBatchStats stats = gui.handleEvents({});
+            REQUIRE(stats.processedEvents == 0);
+            REQUIRE(stats.droppedEvents == 0);
+            REQUIRE(stats.consumedEvents == 0);
+        }
+
+        SECTION("Consecutive moves are merged")
+        {
+            // The intermediate position on top of the widget is never seen
+            const tgui::EventBatchStats stats = gui.handleEvents({makeMouseMoveEvent(10, 10), makeMouseMoveEvent(60, 60), makeMouseMoveEvent(20, 20)});
+            REQUIRE(stats.processedEvents == 1);
+            REQUIRE(stats.droppedEvents == 2);
+            REQUIRE(mouseEnteredCount == 0);
+
+            gui.handleEvents({makeMouseMoveEvent(10, 10), makeMouseMoveEvent(70, 70)});
+            REQUIRE(mouseEnteredCount == 1);
+        }
+
+        SECTION("Button events keep their order")
+        {
+            const tgui::EventBatchStats stats = gui.handleEvents({
+                    makeMouseMoveEvent(60, 60),
+                    makeMouseMoveEvent(70, 70),
+                    makeMouseButtonEvent(sf::Event::MouseButtonPressed, 70, 70),
+                    makeMouseMoveEvent(75, 75),
+                    makeMouseMoveEvent(80, 80),
+                    makeMouseButtonEvent(sf::Event::MouseButtonReleased, 80, 80),
+                    makeMouseButtonEvent(sf::Event::MouseButtonPressed, 80, 80),
+                    makeMouseMoveEvent(180, 180),
+                    makeMouseButtonEvent(sf::Event::MouseButtonReleased, 180, 180)
+                });
+
+            REQUIRE(stats.processedEvents == 7);
+            REQUIRE(stats.droppedEvents == 2);
+            REQUIRE(mouseEnteredCount == 1);
+            REQUIRE(mouseLeftCount == 1);
+            REQUIRE(clickedCount == 1);
+        }
+
+        SECTION("Wheel events are summed")
+        {
+            auto wheelWidget = std::make_shared<WheelRecordingWidget>();
+            wheelWidget->setPosition(50, 50);
+            wheelWidget->setSize(100, 100);
+            gui.add(wheelWidget);
+
+            const tgui::EventBatchStats stats = gui.handleEvents({
+                    makeMouseWheelEvent(1, 60, 60),
+                    makeMouseWheelEvent(2, 60, 60),
+                    makeMouseWheelEvent(-1, 70, 70),
+                    makeMouseMoveEvent(80, 80),
+                    makeMouseWheelEvent(1, 80, 80)
+                });
+
+            REQUIRE(stats.processedEvents == 4);
+            REQUIRE(stats.droppedEvents == 1);
+
+            // Only the events at the same position are summed
+            REQUIRE(wheelWidget->scrolls.size() == 3);
+            REQUIRE(wheelWidget->scrolls[0].first == 3);
+            REQUIRE(wheelWidget->scrolls[0].second == sf::Vector2f(60, 60));
+            REQUIRE(wheelWidget->scrolls[1].first == -1);
+            REQUIRE(wheelWidget->scrolls[1].second == sf::Vector2f(70, 70));
+            REQUIRE(wheelWidget->scrolls[2].first == 1);
+            REQUIRE(wheelWidget->scrolls[2].second == sf::Vector2f(80, 80));
+        }
+    }
+
+    SECTION("Posted commands")
+    {
+        REQUIRE(gui.getCommandBatchSize() == 1024);
+        gui.setCommandBatchSize(2);
+        REQUIRE(gui.getCommandBatchSize() == 2);
+
+        std::thread thread([&gui,widget]{
+            for (int i = 1; i <= 3; ++i)
+                gui.post([widget,i]{ widget->setPosition(i * 10.f, 0); });
+        });
+        thread.join();
+
+        REQUIRE(gui.getCommandQueueStats().pendingCommands == 3);
+        REQUIRE(widget->getPosition() == sf::Vector2f(50, 50));
+
+        gui.draw();
+        REQUIRE(widget->getPosition() == sf::Vector2f(20, 0));
+        REQUIRE(gui.getCommandQueueStats().pendingCommands == 1);
+
+        gui.draw();
+        REQUIRE(widget->getPosition() == sf::Vector2f(30, 0));
+        REQUIRE(gui.getCommandQueueStats().throttledBatches == 1);
+    }
+
+    SECTION("Resize reflow")
+    {
+        const sf::String text = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore";
+
+        auto textBox = tgui::TextBox::create();
+        textBox->setSize({"100%", "100%"});
+        textBox->setText(text);
+        gui.add(textBox);
+
+        // Text box with a fixed size that is never affected by the view, to find out how many lines the text should have
+        auto reference = tgui::TextBox::create();
+        reference->setSize(100, 200);
+        reference->setText(text);
+        gui.add(reference);
+
+        const std::size_t linesCount = textBox->getLinesCount();
+        const std::size_t narrowLinesCount = reference->getLinesCount();
+        REQUIRE(linesCount > 1);
+        REQUIRE(narrowLinesCount > linesCount);
+
+        REQUIRE(gui.getResizeReflowDelay() == sf::Time::Zero);
+        REQUIRE(gui.getResizeReflowTimeBudget() == sf::Time::Zero);
+
+        SECTION("No delay")
+        {
+            gui.setView(sf::View{{0, 0, 100, 200}});
+            REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+        }
+
+        SECTION("Delay")
+        {
+            gui.setResizeReflowDelay(sf::milliseconds(100));
+            gui.setResizeReflowTimeBudget(sf::milliseconds(5));
+            REQUIRE(gui.getResizeReflowDelay() == sf::milliseconds(100));
+            REQUIRE(gui.getResizeReflowTimeBudget() == sf::milliseconds(5));
+
+            SECTION("Postponing")
+            {
+                tgui::DeferredReflow deferredReflow;
+                unsigned int reflowCount = 0;
+                const auto reflow = [&]{ ++reflowCount; };
+
+                // Size changes that aren't made by the view are never postponed
+                REQUIRE(deferredReflow.sizeChanged());
+                REQUIRE(!deferredReflow.isPending());
+
+                gui.getContext()->setResizingView(true);
+                REQUIRE(!deferredReflow.sizeChanged());
+                gui.getContext()->setResizingView(false);
+                REQUIRE(deferredReflow.isPending());
+
+                deferredReflow.update(sf::milliseconds(60), reflow);
+                REQUIRE(reflowCount == 0);
+
+                // Another resize restarts the delay
+                gui.getContext()->setResizingView(true);
+                REQUIRE(!deferredReflow.sizeChanged());
+                gui.getContext()->setResizingView(false);
+
+                deferredReflow.update(sf::milliseconds(60), reflow);
+                REQUIRE(reflowCount == 0);
+
+                deferredReflow.update(sf::milliseconds(60), reflow);
+                REQUIRE(reflowCount == 1);
+                REQUIRE(!deferredReflow.isPending());
+
+                deferredReflow.flush(reflow);
+                REQUIRE(reflowCount == 1);
+            }
+
+            SECTION("Text box")
+            {
+                gui.setView(sf::View{{0, 0, 100, 200}});
+                REQUIRE(textBox->getSize() == sf::Vector2f(100, 200));
+
+                // Asking for the lines does the postponed layout instead of returning the old amount of lines
+                REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+
+                gui.updateTime(sf::milliseconds(200));
+                REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+            }
+
+            SECTION("Hidden text box")
+            {
+                // Hidden widgets aren't updated, the layout is done when the widget is shown again
+                textBox->setVisible(false);
+                gui.setView(sf::View{{0, 0, 100, 200}});
+                gui.updateTime(sf::milliseconds(200));
+                textBox->setVisible(true);
+                REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+            }
+
+            // Size changes made directly on the widget are never postponed
+            textBox->setSize(200, 200);
+            reference->setSize(200, 200);
+            REQUIRE(reference->getLinesCount() < narrowLinesCount);
+            REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+        }
+    }
+
+    SECTION("Recording")
+    {
+        unsigned int clickedCount = 0;
+        widget->connect("Clicked", [&]{ clickedCount++; });
+
+        REQUIRE(!gui.isRecording());
+        REQUIRE(gui.stopRecording().getEntries().empty());
+
+        gui.setView(sf::View{{0, 0, 100, 100}});
+        gui.startRecording();
+        REQUIRE(gui.isRecording());
+
+        // Merged events are recorded as they are passed to the widgets
+        gui.handleEvents({makeMouseMoveEvent(10, 10), makeMouseMoveEvent(120, 120)});
+        gui.handleEvent(makeMouseButtonEvent(sf::Event::MouseButtonPressed, 120, 120));
+        gui.updateTime(sf::milliseconds(20));
+        gui.handleEvent(makeMouseButtonEvent(sf::Event::MouseButtonReleased, 120, 120));
+        REQUIRE(clickedCount == 1);
+
+        const tgui::EventRecording recording = gui.stopRecording();
+        REQUIRE(!gui.isRecording());
+        REQUIRE(recording.getTargetSize() == sf::Vector2u(200, 200));
+        REQUIRE(recording.getView() == sf::FloatRect(0, 0, 100, 100));
+        REQUIRE(recording.getFrameCount() == 1);
+
+        const auto& entries = recording.getEntries();
+        REQUIRE(entries.size() == 4);
+        REQUIRE(entries[0].type == tgui::EventRecording::Entry::Type::Event);
+        REQUIRE(entries[0].event.type == sf::Event::MouseMoved);
+        REQUIRE(entries[0].event.mouseMove.x == 120);
+        REQUIRE(entries[1].event.type == sf::Event::MouseButtonPressed);
+        REQUIRE(entries[2].type == tgui::EventRecording::Entry::Type::Update);
+        REQUIRE(entries[2].elapsedTime == sf::milliseconds(20));
+        REQUIRE(entries[3].event.type == sf::Event::MouseButtonReleased);
+
+        // Replaying the recording on the same layout gives the same result
+        for (const auto& entry : entries)
+        {
+            if (entry.type == tgui::EventRecording::Entry::Type::Event)
+                gui.handleEvent(entry.event);
+            else
+                gui.updateTime(entry.elapsedTime);
+        }
+        REQUIRE(clickedCount == 2);
+    }
+
+    SECTION("Recording view changes")
+    {
+        unsigned int clickedCount = 0;
+        widget->connect("Clicked", [&]{ clickedCount++; });
+
+        gui.startRecording();
+
+        // After zooming out, the mouse position no longer lies on top of the widget
+        gui.setView(sf::View{{0, 0, 400, 400}});
+        gui.handleEvent(makeMouseButtonEvent(sf::Event::MouseButtonPressed, 120, 120));
+        gui.handleEvent(makeMouseButtonEvent(sf::Event::MouseButtonReleased, 120, 120));
+        REQUIRE(clickedCount == 0);
+
+        const tgui::EventRecording recording = gui.stopRecording();
+        const auto& entries = recording.getEntries();
+        REQUIRE(entries.size() == 3);
+        REQUIRE(entries[0].type == tgui::EventRecording::Entry::Type::View);
+        REQUIRE(entries[0].view == sf::FloatRect(0, 0, 400, 400));
+        REQUIRE(entries[0].targetSize == sf::Vector2u(200, 200));
+
+        // Replaying from the original view gives the same result because the view change is part of the recording
+        gui.setView(sf::View{recording.getView()});
+        for (const auto& entry : entries)
+        {
+            if (entry.type == tgui::EventRecording::Entry::Type::Event)
+                gui.handleEvent(entry.event);
+            else if (entry.type == tgui::EventRecording::Entry::Type::View)
+                gui.setView(sf::View{entry.view});
+        }
+        REQUIRE(gui.getView().getSize() == sf::Vector2f(400, 400));
+        REQUIRE(clickedCount == 0);
+    }
+
+    SECTION("Automatic time update")
+    {
+        REQUIRE(gui.isAutomaticTimeUpdateEnabled());
+        gui.setAutomaticTimeUpdateEnabled(false);
+        REQUIRE(!gui.isAutomaticTimeUpdateEnabled());
+
+        gui.startRecording();
+        gui.draw();
+        REQUIRE(gui.stopRecording().getFrameCount() == 0);
+
+        gui.setAutomaticTimeUpdateEnabled(true);
+        gui.startRecording();
+        gui.draw();
+        REQUIRE(gui.stopRecording().getFrameCount() == 1);
+    }
+}
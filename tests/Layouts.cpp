@@ -405,6 +405,43 @@ TEST_CASE("[Layouts]")
             widget->setPosition({"0"},{"0"});
             widget->setPosition("0","0");
         }
+
+        SECTION("Same string used in different widgets")
+        {
+            auto panel1 = std::make_shared<tgui::Panel>();
+            panel1->setSize(200, 100);
+            auto panel2 = std::make_shared<tgui::Panel>();
+            panel2->setSize(300, 150);
+
+            auto button1 = std::make_shared<tgui::Button>();
+            button1->setSize({"min(50%, &.w - 20)", "&.h / 2"});
+            panel1->add(button1);
+
+            auto button2 = std::make_shared<tgui::Button>();
+            button2->setSize({"min(50%, &.w - 20)", "&.h / 2"});
+            panel2->add(button2);
+
+            REQUIRE(button1->getSize() == sf::Vector2f(100, 50));
+            REQUIRE(button2->getSize() == sf::Vector2f(150, 75));
+            REQUIRE(button1->getSizeLayout().toString() == "(min(50%, &.w - 20), &.h / 2)");
+
+            panel2->setSize(30, 20);
+            REQUIRE(button1->getSize() == sf::Vector2f(100, 50));
+            REQUIRE(button2->getSize() == sf::Vector2f(10, 10));
+        }
+
+        SECTION("Bound widget is destroyed")
+        {
+            auto panel = std::make_shared<tgui::Panel>();
+            panel->setSize(200, 100);
+
+            auto button = std::make_shared<tgui::Button>();
+            button->setSize(bindWidth(panel) + bindHeight(panel) / 2, 30);
+            REQUIRE(button->getSize() == sf::Vector2f(250, 30));
+
+            panel = nullptr;
+            REQUIRE(button->getSize() == sf::Vector2f(0, 30));
+        }
     }
 
     SECTION("Bug Fixes")
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Loading/ResourcePreloader.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Texture.hpp>
+
+TEST_CASE("[ResourcePreloader]")
+{
+    SECTION("Nothing to load")
+    {
+        tgui::ResourcePreloader preloader;
+        REQUIRE(preloader.getTotalCount() == 0);
+        REQUIRE(preloader.getProgress() == 1);
+        REQUIRE(preloader.isFinished());
+
+        preloader.start();
+        preloader.wait();
+        REQUIRE(preloader.getLoadedCount() == 0);
+    }
+
+    SECTION("Images and fonts")
+    {
+        tgui::ResourcePreloader preloader;
+        preloader.addImage("resources/image.png");
+        preloader.addImage("resources/image.png");
+        preloader.addImage("resources/Texture1.png");
+        preloader.addImage("resources/SFML.svg");
+        preloader.addFont("resources/DejaVuSans.ttf");
+        REQUIRE(preloader.getTotalCount() == 3);
+        REQUIRE(preloader.getLoadedCount() == 0);
+        REQUIRE(preloader.getProgress() == 0);
+
+        preloader.start(2);
+        preloader.wait();
+        REQUIRE(preloader.isFinished());
+        REQUIRE(preloader.getLoadedCount() == 3);
+        REQUIRE(preloader.getProgress() == 1);
+
+        // Files can no longer be added once the preloader was started
+        preloader.addImage("resources/Texture2.png");
+        REQUIRE(preloader.getTotalCount() == 3);
+
+        tgui::Texture texture{"resources/image.png", {0, 0, 20, 20}};
+        REQUIRE(texture.getData() != nullptr);
+        REQUIRE(texture.getImageSize() == tgui::Vector2f(20, 20));
+
+        REQUIRE(tgui::ResourcePreloader::takePreloadedFont("resources/DejaVuSans.ttf") != nullptr);
+        REQUIRE(tgui::ResourcePreloader::takePreloadedFont("resources/DejaVuSans.ttf") == nullptr);
+
+        tgui::TextureManager::removePreloadedImages();
+    }
+
+    SECTION("Wait without start")
+    {
+        tgui::ResourcePreloader preloader;
+        preloader.addImage("resources/Texture3.png");
+        preloader.wait();
+        REQUIRE(preloader.isFinished());
+
+        tgui::TextureManager::removePreloadedImages();
+    }
+
+    SECTION("Parsed tree")
+    {
+        std::stringstream input("Picture.Pic {\n"
+                                "    Renderer {\n"
+                                "        Texture = \"resources/image.png\" Part(0, 0, 10, 10);\n"
+                                "        TextureBackground = None;\n"
+                                "        Font = \"resources/DejaVuSans.ttf\";\n"
+                                "        TextColor = Red;\n"
+                                "    }\n"
+                                "}\n"
+                                "Button.Btn {\n"
+                                "    Renderer {\n"
+                                "        Texture = \"resources/image.png\";\n"
+                                "        TextureHover = \"resources/Texture1.png\";\n"
+                                "        TextureDown = &OtherSection;\n"
+                                "    }\n"
+                                "}\n");
+
+        tgui::ResourcePreloader preloader;
+        preloader.addFromNode(tgui::DataIO::parse(input));
+        REQUIRE(preloader.getTotalCount() == 3);
+    }
+
+    SECTION("Theme file")
+    {
+        tgui::ResourcePreloader preloader;
+        preloader.addFromThemeFile("resources/Black.txt");
+        REQUIRE(preloader.getTotalCount() == 1);
+
+        REQUIRE_THROWS_AS(preloader.addFromThemeFile("resources/NonExistent.txt"), tgui::Exception);
+        REQUIRE_THROWS_AS(preloader.addFromWidgetFile("resources/NonExistent.txt"), tgui::Exception);
+    }
+}
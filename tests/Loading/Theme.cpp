@@ -25,8 +25,17 @@
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Label.hpp>
+#include <fstream>
+#include <cstdio>
 
-// TODO: Reloading theme
+namespace
+{
+    void writeThemeFile(const std::string& contents)
+    {
+        std::ofstream file{"ThemeReload.txt"};
+        file << contents;
+    }
+}
 
 TEST_CASE("[Theme]")
 {
@@ -83,6 +92,25 @@ TEST_CASE("[Theme]")
         REQUIRE(!theme.removeRenderer("nonexistent"));
     }
 
+    SECTION("Prewarming fonts")
+    {
+        tgui::Font::processGlyphPrewarming(sf::Time::Zero);
+
+        tgui::Theme theme;
+        theme.prewarmFonts({20});
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 0);
+
+        // A font that is used by several renderers is only prewarmed once
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        theme.addRenderer("label1", tgui::RendererData::create({{"font", font}}));
+        theme.addRenderer("label2", tgui::RendererData::create({{"font", font}}));
+        theme.addRenderer("label3", tgui::RendererData::create({{"textcolor", tgui::Color::Red}}));
+        theme.prewarmFonts({20}, sf::Text::Bold);
+        REQUIRE(tgui::Font::getPendingGlyphPrewarmCount() == 95);
+
+        tgui::Font::processGlyphPrewarming(sf::Time::Zero);
+    }
+
     SECTION("Renderers are shared")
     {
         tgui::Theme theme{"resources/Black.txt"};
@@ -148,6 +176,45 @@ TEST_CASE("[Theme]")
         }
     }
 
+    SECTION("Reloading")
+    {
+        writeThemeFile("Label {\n    TextColor = Red;\n    BackgroundColor = Blue;\n}\n");
+
+        tgui::Theme theme{"ThemeReload.txt"};
+        auto label = tgui::Label::create();
+        label->setRenderer(theme.getRenderer("Label"));
+        REQUIRE(label->getSharedRenderer()->getTextColor() == sf::Color::Red);
+        REQUIRE(!theme.reloadIfModified());
+
+        std::vector<std::string> changedProperties;
+        int observerId;
+        theme.getRenderer("Label")->observers[&observerId] = [&](const std::string& property){ changedProperties.push_back(property); };
+
+        writeThemeFile("Label {\n    TextColor = Green;\n    BackgroundColor = Blue;\n    BorderColor = Yellow;\n}\n");
+        REQUIRE(theme.reloadIfModified());
+        REQUIRE(label->getSharedRenderer()->getTextColor() == sf::Color::Green);
+        REQUIRE(label->getSharedRenderer()->getBackgroundColor() == sf::Color::Blue);
+        REQUIRE(label->getSharedRenderer()->getBorderColor() == sf::Color::Yellow);
+        REQUIRE(!theme.reloadIfModified());
+
+        // A theme that is created after the file was reloaded is already up-to-date
+        tgui::Theme otherTheme{"ThemeReload.txt"};
+        REQUIRE(!otherTheme.reloadIfModified());
+
+        // Only the changed properties are passed to the widgets
+        REQUIRE(changedProperties == std::vector<std::string>{"bordercolor", "textcolor"});
+
+        // When the new file contains errors, the old theme remains in use
+        writeThemeFile("Label {\n    TextColor = Blue;\n");
+        REQUIRE_THROWS_AS(theme.reloadIfModified(), tgui::Exception);
+        REQUIRE(!theme.reloadIfModified());
+        REQUIRE(label->getSharedRenderer()->getTextColor() == sf::Color::Green);
+
+        theme.getRenderer("Label")->observers.erase(&observerId);
+        tgui::DefaultThemeLoader::flushCache("ThemeReload.txt");
+        std::remove("ThemeReload.txt");
+    }
+
     SECTION("setThemeLoader")
     {
         struct CustomThemeLoader : public tgui::BaseThemeLoader
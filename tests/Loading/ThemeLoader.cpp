@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -110,6 +111,30 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nScrollbar {\n    trackcolor = Black;\n}\n}");
     }
 
+    SECTION("load parsed properties")
+    {
+        auto properties1 = loader->loadProperties("resources/ThemeNested.txt", "ComboBox4");
+        auto properties2 = loader->loadProperties("resources/ThemeNested.txt", "ComboBox4");
+        REQUIRE(properties1.size() == 1);
+        REQUIRE(properties1["listbox"].getType() == tgui::ObjectConverter::Type::String);
+
+        // Nested renderers are copied, but the values inside them are shared
+        auto listBox1 = properties1["listbox"].getRenderer();
+        auto listBox2 = properties2["listbox"].getRenderer();
+        REQUIRE(listBox1 != listBox2);
+        REQUIRE(listBox1->propertyValuePairs["backgroundcolor"].getColor() == tgui::Color::Magenta);
+        REQUIRE(listBox2->propertyValuePairs["backgroundcolor"].getColor() == tgui::Color::Magenta);
+
+        listBox1->propertyValuePairs["backgroundcolor"] = tgui::Color::Green;
+        REQUIRE(listBox2->propertyValuePairs["backgroundcolor"].getColor() == tgui::Color::Magenta);
+        REQUIRE(loader->loadProperties("resources/ThemeNested.txt", "ComboBox4")["listbox"].getRenderer()->propertyValuePairs["backgroundcolor"].getColor() == tgui::Color::Magenta);
+
+        properties1 = loader->loadProperties("resources/ThemeButton1.txt", "Button1");
+        REQUIRE(properties1["textcolor"].getColor() == tgui::Color::Yellow);
+
+        REQUIRE_THROWS_AS(loader->loadProperties("resources/Black.txt", "NonexistentClassName"), tgui::Exception);
+    }
+
     SECTION("cache")
     {
         REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
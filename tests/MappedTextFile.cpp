@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/MappedTextFile.hpp>
+#include <fstream>
+
+TEST_CASE("[MappedTextFile]")
+{
+    tgui::MappedTextFile file;
+    REQUIRE(!file.isOpen());
+    REQUIRE(file.getLineCount() == 0);
+
+    SECTION("Lines")
+    {
+        {
+            std::ofstream stream("MappedTextFile.txt", std::ios::binary);
+            for (unsigned int i = 0; i < 1000; ++i)
+                stream << "Line " << i << "\n";
+            stream << "Windows line\r\n\xE2\x82\xAC";
+        }
+
+        file.open("MappedTextFile.txt");
+        REQUIRE(file.isOpen());
+        REQUIRE(file.getFileSize() > 0);
+
+        file.waitForIndexing();
+        REQUIRE(file.isIndexingFinished());
+        REQUIRE(file.getLineCount() == 1002);
+
+        REQUIRE(file.getLine(0) == "Line 0");
+        REQUIRE(file.getLine(255) == "Line 255");
+        REQUIRE(file.getLine(256) == "Line 256");
+        REQUIRE(file.getLine(999) == "Line 999");
+        REQUIRE(file.getLine(1000) == "Windows line");
+        REQUIRE(file.getLine(1001) == sf::String(sf::Uint32(0x20AC)));
+        REQUIRE(file.getLine(1002) == "");
+
+        const auto lines = file.getLines(510, 5);
+        REQUIRE(lines.size() == 5);
+        REQUIRE(lines[0] == "Line 510");
+        REQUIRE(lines[4] == "Line 514");
+
+        REQUIRE(file.getLines(1000, 10).size() == 2);
+        REQUIRE(file.getLines(1002, 10).empty());
+
+        file.close();
+        REQUIRE(!file.isOpen());
+        REQUIRE(file.getLineCount() == 0);
+    }
+
+    SECTION("Newline at end of file")
+    {
+        {
+            std::ofstream stream("MappedTextFile.txt", std::ios::binary);
+            stream << "a\nb\n";
+        }
+
+        file.open("MappedTextFile.txt");
+        file.waitForIndexing();
+        REQUIRE(file.getLineCount() == 3);
+        REQUIRE(file.getLine(1) == "b");
+        REQUIRE(file.getLine(2) == "");
+    }
+
+    SECTION("Empty file")
+    {
+        std::ofstream{"MappedTextFile.txt"};
+
+        file.open("MappedTextFile.txt");
+        REQUIRE(file.isIndexingFinished());
+        REQUIRE(file.getLineCount() == 1);
+        REQUIRE(file.getLine(0) == "");
+    }
+
+#ifndef SFML_SYSTEM_WINDOWS // Windows doesn't allow truncating a mapped file
+    SECTION("Truncated file")
+    {
+        {
+            std::ofstream stream("MappedTextFile.txt", std::ios::binary);
+            for (unsigned int i = 0; i < 100000; ++i)
+                stream << "Line " << i << "\n";
+        }
+
+        file.open("MappedTextFile.txt");
+        file.waitForIndexing();
+        REQUIRE(file.getLineCount() == 100001);
+
+        // Lines past the new end of the file can no longer be read
+        {
+            std::ofstream stream("MappedTextFile.txt", std::ios::binary);
+            stream << "Line 0\nLi";
+        }
+
+        REQUIRE(file.getLine(0) == "Line 0");
+        REQUIRE(file.getLine(1) == "Li");
+        REQUIRE(file.getLine(90000) == "");
+        REQUIRE(file.getLines(0, 10).size() == 2);
+    }
+#endif
+
+    SECTION("Nonexistent file")
+    {
+        REQUIRE_THROWS_AS(file.open("NonexistentFile.txt"), tgui::Exception);
+        REQUIRE(!file.isOpen());
+    }
+}
@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Profiler.hpp>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+TEST_CASE("[Profiler]")
+{
+    tgui::Profiler::finishFrame();
+
+    SECTION("Enabled")
+    {
+        REQUIRE(tgui::Profiler::isEnabled());
+        tgui::Profiler::setEnabled(false);
+        REQUIRE(!tgui::Profiler::isEnabled());
+
+        tgui::Profiler::count(tgui::Profiler::Counter::DrawCalls);
+        REQUIRE(tgui::Profiler::finishFrame().drawCalls == 0);
+
+        tgui::Profiler::setEnabled(true);
+        REQUIRE(tgui::Profiler::isEnabled());
+    }
+
+    SECTION("Counters")
+    {
+        tgui::Profiler::count(tgui::Profiler::Counter::DrawCalls);
+        tgui::Profiler::count(tgui::Profiler::Counter::DrawCalls);
+        tgui::Profiler::count(tgui::Profiler::Counter::TextureBinds);
+        tgui::Profiler::count(tgui::Profiler::Counter::ClippingPushes);
+        tgui::Profiler::count(tgui::Profiler::Counter::TextLayouts);
+        tgui::Profiler::count(tgui::Profiler::Counter::Events);
+
+        const tgui::FrameStats stats = tgui::Profiler::finishFrame();
+        REQUIRE(stats.drawCalls == 2);
+        REQUIRE(stats.textureBinds == 1);
+        REQUIRE(stats.clippingPushes == 1);
+        REQUIRE(stats.textLayouts == 1);
+        REQUIRE(stats.events == 1);
+
+        // The counters are reset at the start of each frame
+        REQUIRE(tgui::Profiler::finishFrame().drawCalls == 0);
+    }
+
+    SECTION("Threads")
+    {
+        tgui::Profiler::count(tgui::Profiler::Counter::DrawCalls);
+
+        // Each thread collects its own statistics
+        unsigned int workerDrawCalls = 0;
+        std::thread worker([&]{
+            tgui::Profiler::count(tgui::Profiler::Counter::DrawCalls);
+            tgui::Profiler::count(tgui::Profiler::Counter::DrawCalls);
+            workerDrawCalls = tgui::Profiler::finishFrame().drawCalls;
+        });
+        worker.join();
+
+        REQUIRE(workerDrawCalls == 2);
+        REQUIRE(tgui::Profiler::finishFrame().drawCalls == 1);
+    }
+
+    SECTION("Scopes")
+    {
+        {
+            tgui::Profiler::Scope scope{tgui::Profiler::Category::Draw, "Draw"};
+            tgui::Profiler::Scope widgetScope1{tgui::Profiler::Category::WidgetDraw, "Button"};
+            tgui::Profiler::Scope widgetScope2{tgui::Profiler::Category::WidgetDraw, "Label"};
+        }
+
+        const tgui::FrameStats stats = tgui::Profiler::finishFrame();
+        REQUIRE(stats.widgetsDrawn == 2);
+        REQUIRE(stats.drawTime >= 0);
+        REQUIRE(stats.frameTime >= stats.drawTime);
+    }
+
+    SECTION("Trace")
+    {
+        REQUIRE(!tgui::Profiler::isTracing());
+        tgui::Profiler::startTrace();
+        REQUIRE(tgui::Profiler::isTracing());
+
+        {
+            tgui::Profiler::Scope scope{tgui::Profiler::Category::Signal, "Pressed"};
+        }
+
+        // The name may be destroyed before the scope ends
+        {
+            auto name = std::make_unique<std::string>("Destroyed");
+            tgui::Profiler::Scope scope{tgui::Profiler::Category::Signal, name->c_str()};
+            name = nullptr;
+        }
+
+        tgui::Profiler::stopTrace();
+        REQUIRE(!tgui::Profiler::isTracing());
+
+        {
+            tgui::Profiler::Scope scope{tgui::Profiler::Category::Signal, "Ignored"};
+        }
+
+        tgui::Profiler::saveTrace("ProfilerTrace.json");
+
+        std::ifstream in{"ProfilerTrace.json"};
+        REQUIRE(in.is_open());
+        std::stringstream contents;
+        contents << in.rdbuf();
+        REQUIRE(contents.str().find("\"name\":\"Pressed\",\"cat\":\"Signal\",\"ph\":\"X\"") != std::string::npos);
+        REQUIRE(contents.str().find("\"name\":\"Destroyed\"") != std::string::npos);
+        REQUIRE(contents.str().find("Ignored") == std::string::npos);
+
+        REQUIRE_THROWS_AS(tgui::Profiler::saveTrace("NonExistentDir/ProfilerTrace.json"), tgui::Exception);
+    }
+}
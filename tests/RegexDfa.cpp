@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/RegexDfa.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <regex>
+
+TEST_CASE("[RegexDfa]")
+{
+    SECTION("Matches like std::regex")
+    {
+        const std::vector<std::string> patterns = {
+            "abc[0-9]xyz", "(ab|a)*b", "a{2,3}", "a{2,}b?", "[^a-c]+", ".*x", "\\d+\\.\\d{1,2}",
+            "(?:a|b)c", "[a\\-z]*", "\\w\\s\\W", "a*?b", "(a|)+", "[\\d.]+", "a|b|", "(a*)*"
+        };
+        const std::vector<std::string> texts = {
+            "", "a", "b", "ab", "aab", "abab", "aa", "aaa", "aaaa", "aab", "aabb", "xyz", "dx", "x", "abx", "12.5", "12.55", "12.555",
+            ".5", "ac", "bc", "abc", "a-z", "a b", "a_b", "a c", "ab", "abc1xyz", "abcxyz", "1.2.3", "ba"
+        };
+
+        for (const auto& pattern : patterns)
+        {
+            const auto dfa = tgui::RegexDfa::compile(pattern);
+            REQUIRE(dfa != nullptr);
+
+            const std::regex regex{pattern};
+            for (const auto& text : texts)
+                REQUIRE(dfa->match(text) == std::regex_match(text, regex));
+        }
+    }
+
+    SECTION("Incremental matching")
+    {
+        const auto dfa = tgui::RegexDfa::compile("[a-z]+[0-9]*");
+        REQUIRE(dfa != nullptr);
+
+        unsigned int state = dfa->getStartState();
+        REQUIRE(!dfa->isAccepting(state));
+
+        state = dfa->advance(state, 'a');
+        REQUIRE(dfa->isAccepting(state));
+
+        state = dfa->advance(state, '1');
+        REQUIRE(dfa->isAccepting(state));
+
+        state = dfa->advance(state, 'b');
+        REQUIRE(state == tgui::RegexDfa::DeadState);
+        REQUIRE(dfa->advance(state, '1') == tgui::RegexDfa::DeadState);
+    }
+
+    SECTION("Unicode")
+    {
+        const auto dfa = tgui::RegexDfa::compile(u8"[à-ÿ]\\u0416.");
+        REQUIRE(dfa != nullptr);
+        REQUIRE(dfa->match(L"êЖx"));
+        REQUIRE(dfa->match(L"êЖ中"));
+        REQUIRE(!dfa->match(L"eЖx"));
+        REQUIRE(!dfa->match(L"êЖ\n"));
+    }
+
+    SECTION("Unsupported patterns")
+    {
+        REQUIRE(tgui::RegexDfa::compile("abc[0-") == nullptr);
+        REQUIRE(tgui::RegexDfa::compile("a**") == nullptr);
+        REQUIRE(tgui::RegexDfa::compile("(a") == nullptr);
+        REQUIRE(tgui::RegexDfa::compile("^a$") == nullptr);
+        REQUIRE(tgui::RegexDfa::compile("(?=a)a") == nullptr);
+        REQUIRE(tgui::RegexDfa::compile("(a)\\1") == nullptr);
+        REQUIRE(tgui::RegexDfa::compile("\\bword") == nullptr);
+        REQUIRE(tgui::RegexDfa::compile("[[:alpha:]]") == nullptr);
+    }
+
+    SECTION("Prebuilt validators")
+    {
+        const std::vector<std::string> validators = {
+            tgui::EditBox::Validator::Int, tgui::EditBox::Validator::UInt, tgui::EditBox::Validator::Float
+        };
+        const std::vector<std::string> texts = {
+            "", "0", "5", "42", "+", "-", "+7", "-7", "--7", "7-", ".", "5.", ".5", "-1.25", "+.", "1.2.3", "1,5", "1/2", "a", " 1"
+        };
+
+        for (const auto& validator : validators)
+        {
+            const auto prebuilt = tgui::RegexDfa::create(validator);
+            const auto compiled = tgui::RegexDfa::compile(validator);
+            REQUIRE(prebuilt != nullptr);
+            REQUIRE(compiled != nullptr);
+            REQUIRE(prebuilt == tgui::RegexDfa::create(validator));
+
+            const std::regex regex{validator};
+            for (const auto& text : texts)
+            {
+                REQUIRE(prebuilt->match(text) == std::regex_match(text, regex));
+                REQUIRE(compiled->match(text) == std::regex_match(text, regex));
+            }
+        }
+    }
+}
@@ -24,6 +24,38 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <thread>
+
+namespace
+{
+    // Signal with more parameters than any of the signals of the widgets
+    class SignalThreeInts : public tgui::Signal
+    {
+    public:
+
+        SignalThreeInts() :
+            tgui::Signal{"ThreeInts", 3}
+        {
+        }
+
+        unsigned int connect(const std::function<void(int, int, int)>& handler)
+        {
+            return tgui::Signal::connect([handler]{
+                auto& parameters = tgui::internal_signal::getParameters();
+                handler(*static_cast<const int*>(parameters[1]), *static_cast<const int*>(parameters[2]), *static_cast<const int*>(parameters[3]));
+            });
+        }
+
+        bool emit(const tgui::Widget* widget, int value1, int value2, int value3)
+        {
+            auto& parameters = tgui::internal_signal::getParameters();
+            parameters[1] = &value1;
+            parameters[2] = &value2;
+            parameters[3] = &value3;
+            return tgui::Signal::emit(widget);
+        }
+    };
+}
 
 TEST_CASE("[Signal]")
 {
@@ -140,5 +172,45 @@ TEST_CASE("[Signal]")
         widget->setPosition(60, 60);
         widget->setSize(400, 100);
         REQUIRE(i == 4);
+
+        // Signals can be connected again after all handlers were removed
+        widget->connect("PositionChanged", [&](){ i++; });
+        widget->setPosition(70, 70);
+        REQUIRE(i == 5);
+    }
+
+    SECTION("Name")
+    {
+        REQUIRE(widget->onPositionChange.getName() == "PositionChanged");
+        REQUIRE(widget->onMouseEnter.getName() == "MouseEntered");
+
+        std::string name;
+        widget->connect("MouseEntered", [&](tgui::Widget::Ptr, std::string signalName){ name = signalName; });
+        widget->onMouseEnter.emit(widget.get());
+        REQUIRE(name == "MouseEntered");
+
+        // Handlers aren't copied, but the name is
+        auto copiedWidget = widget->clone();
+        REQUIRE(copiedWidget->onMouseEnter.getName() == "MouseEntered");
+        name = "";
+        copiedWidget->onMouseEnter.emit(copiedWidget.get());
+        REQUIRE(name == "");
+    }
+
+    SECTION("Emitting on other thread")
+    {
+        // The signal is constructed on this thread, but the parameters are stored in the other thread
+        SignalThreeInts signal;
+        int sum = 0;
+        signal.connect([&](int value1, int value2, int value3){ sum = value1 + value2 + value3; });
+
+        std::size_t parameterCount = 0;
+        std::thread worker([&]{
+            parameterCount = tgui::internal_signal::getParameters().size();
+            signal.emit(widget.get(), 1, 2, 3);
+        });
+        worker.join();
+        REQUIRE(parameterCount >= 4);
+        REQUIRE(sum == 6);
     }
 }
@@ -0,0 +1,305 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/SoftwareRenderer.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+
+namespace
+{
+    tgui::Color getPixel(const tgui::SoftwareRenderer& renderer, unsigned int x, unsigned int y)
+    {
+        const std::uint8_t* pixel = renderer.getPixels() + (y * renderer.getSize().x + x) * 4;
+        return {pixel[0], pixel[1], pixel[2], pixel[3]};
+    }
+
+    std::vector<tgui::Color> getPixels(const tgui::SoftwareRenderer& renderer, sf::IntRect rect)
+    {
+        std::vector<tgui::Color> pixels;
+        for (int y = rect.top; y < rect.top + rect.height; ++y)
+        {
+            for (int x = rect.left; x < rect.left + rect.width; ++x)
+                pixels.push_back(getPixel(renderer, static_cast<unsigned int>(x), static_cast<unsigned int>(y)));
+        }
+        return pixels;
+    }
+
+    void drawTexturedQuad(tgui::SoftwareRenderer& renderer, const sf::Texture& texture)
+    {
+        const float width = static_cast<float>(texture.getSize().x);
+        const float height = static_cast<float>(texture.getSize().y);
+        const sf::Vertex quad[] = {
+            {{10, 10}, sf::Color::White, {0, 0}},
+            {{10, 30}, sf::Color::White, {0, height}},
+            {{30, 10}, sf::Color::White, {width, 0}},
+            {{30, 30}, sf::Color::White, {width, height}}
+        };
+
+        sf::RenderStates states;
+        states.texture = &texture;
+
+        renderer.beginFrame(sf::View{{0, 0, 100, 80}});
+        renderer.renderVertices(quad, 4, sf::PrimitiveType::TrianglesStrip, states);
+        renderer.endFrame();
+    }
+}
+
+TEST_CASE("[SoftwareRenderer]")
+{
+    auto renderer = tgui::SoftwareRenderer::create({100, 80});
+    renderer->setTileSize(32);
+
+    SECTION("Properties")
+    {
+        REQUIRE(renderer->getSize() == sf::Vector2u(100, 80));
+        REQUIRE(renderer->getTileSize() == 32);
+        REQUIRE(renderer->getClearColor() == tgui::Color::Black);
+
+        renderer->setClearColor(tgui::Color::Blue);
+        REQUIRE(renderer->getClearColor() == tgui::Color::Blue);
+
+        renderer->setSize({20, 10});
+        REQUIRE(renderer->getSize() == sf::Vector2u(20, 10));
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui;
+        gui.setRenderBackend(renderer);
+        REQUIRE(gui.getRenderBackend() == renderer);
+        REQUIRE(gui.getView().getSize() == sf::Vector2f(100, 80));
+
+        auto panel = tgui::Panel::create({40, 30});
+        panel->setPosition(10, 20);
+        panel->getRenderer()->setBorders(0);
+        panel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+        gui.add(panel);
+
+        gui.draw();
+        REQUIRE(getPixel(*renderer, 10, 20) == tgui::Color::Red);
+        REQUIRE(getPixel(*renderer, 49, 49) == tgui::Color::Red);
+        REQUIRE(getPixel(*renderer, 9, 20) == tgui::Color::Black);
+        REQUIRE(getPixel(*renderer, 50, 49) == tgui::Color::Black);
+        REQUIRE(getPixel(*renderer, 49, 50) == tgui::Color::Black);
+
+        SECTION("Dirty rects")
+        {
+            // Everything is dirty after the first frame
+            REQUIRE(renderer->getDirtyRects().size() == 3);
+            REQUIRE(renderer->getDirtyRects()[0] == sf::IntRect(0, 0, 100, 32));
+            REQUIRE(renderer->getDirtyRects()[1] == sf::IntRect(0, 32, 100, 32));
+            REQUIRE(renderer->getDirtyRects()[2] == sf::IntRect(0, 64, 100, 16));
+
+            gui.draw();
+            REQUIRE(renderer->getDirtyRects().empty());
+
+            panel->setSize({10, 10});
+            gui.draw();
+            REQUIRE(renderer->getDirtyRects().size() == 2);
+            REQUIRE(renderer->getDirtyRects()[0] == sf::IntRect(0, 0, 64, 32));
+            REQUIRE(renderer->getDirtyRects()[1] == sf::IntRect(0, 32, 64, 32));
+
+            renderer->setSize({100, 80});
+            gui.draw();
+            REQUIRE(renderer->getDirtyRects().size() == 3);
+        }
+
+        SECTION("Transparency")
+        {
+            panel->getRenderer()->setBackgroundColor({255, 255, 255, 51});
+            gui.draw();
+            REQUIRE(getPixel(*renderer, 30, 30) == tgui::Color(51, 51, 51, 255));
+
+            panel->getRenderer()->setOpacity(0);
+            gui.draw();
+            REQUIRE(getPixel(*renderer, 30, 30) == tgui::Color::Black);
+        }
+
+        SECTION("Clipping")
+        {
+            auto child = tgui::Panel::create({100, 100});
+            child->setPosition(-20, -20);
+            child->getRenderer()->setBackgroundColor(tgui::Color::Green);
+            panel->add(child);
+
+            gui.draw();
+            REQUIRE(getPixel(*renderer, 10, 20) == tgui::Color::Green);
+            REQUIRE(getPixel(*renderer, 49, 49) == tgui::Color::Green);
+            REQUIRE(getPixel(*renderer, 9, 20) == tgui::Color::Black);
+            REQUIRE(getPixel(*renderer, 50, 49) == tgui::Color::Black);
+        }
+
+        SECTION("Picture")
+        {
+            sf::Image image;
+            image.create(4, 4, sf::Color::Green);
+            sf::Texture texture;
+            texture.loadFromImage(image);
+
+            auto picture = tgui::Picture::create(tgui::Texture{texture});
+            picture->setPosition(60, 10);
+            picture->setSize(20, 20);
+            gui.add(picture);
+
+            gui.draw();
+            REQUIRE(getPixel(*renderer, 60, 10) == tgui::Color::Green);
+            REQUIRE(getPixel(*renderer, 79, 29) == tgui::Color::Green);
+            REQUIRE(getPixel(*renderer, 59, 10) == tgui::Color::Black);
+            REQUIRE(getPixel(*renderer, 80, 29) == tgui::Color::Black);
+        }
+
+        SECTION("Text")
+        {
+            auto label = tgui::Label::create("I");
+            label->setPosition(60, 10);
+            label->setTextSize(20);
+            label->getRenderer()->setTextColor(tgui::Color::White);
+            gui.add(label);
+
+            const sf::IntRect labelRect{60, 10, 40, 40};
+            const auto countTextPixels = [](const std::vector<tgui::Color>& pixels){
+                unsigned int count = 0;
+                for (const auto& pixel : pixels)
+                {
+                    // Anti-aliased text on a black background only contains shades of gray
+                    REQUIRE(pixel.getRed() == pixel.getGreen());
+                    REQUIRE(pixel.getRed() == pixel.getBlue());
+                    if (pixel != tgui::Color::Black)
+                        count++;
+                }
+                return count;
+            };
+
+            gui.draw();
+            const auto pixelsI = getPixels(*renderer, labelRect);
+            const unsigned int countI = countTextPixels(pixelsI);
+            REQUIRE(countI > 0);
+            REQUIRE(getPixel(*renderer, 59, 20) == tgui::Color::Black);
+
+            // A glyph that wasn't drawn before has to be copied from the font texture as well
+            label->setText("W");
+            gui.draw();
+            const auto pixelsW = getPixels(*renderer, labelRect);
+            REQUIRE(countTextPixels(pixelsW) > countI);
+
+            label->setText("I");
+            gui.draw();
+            REQUIRE(getPixels(*renderer, labelRect) == pixelsI);
+        }
+
+        SECTION("Events")
+        {
+            unsigned int mousePressedCount = 0;
+            panel->connect("MousePressed", [&](sf::Vector2f pos){
+                REQUIRE(pos == sf::Vector2f(5, 6));
+                mousePressedCount++;
+            });
+
+            sf::Event event;
+            event.type = sf::Event::MouseButtonPressed;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = 15;
+            event.mouseButton.y = 26;
+            gui.handleEvent(event);
+            REQUIRE(mousePressedCount == 1);
+        }
+    }
+
+    SECTION("Primitives")
+    {
+        renderer->beginFrame(sf::View{{0, 0, 100, 80}});
+
+        const sf::Vertex triangle[] = {
+            {{0, 0}, sf::Color::White},
+            {{20, 0}, sf::Color::White},
+            {{0, 20}, sf::Color::White}
+        };
+        renderer->renderVertices(triangle, 3, sf::PrimitiveType::Triangles, {});
+
+        renderer->pushClipArea({50, 50, 10, 10});
+        const sf::Vertex quad[] = {
+            {{40, 40}, sf::Color::Yellow},
+            {{40, 80}, sf::Color::Yellow},
+            {{80, 40}, sf::Color::Yellow},
+            {{80, 80}, sf::Color::Yellow}
+        };
+        renderer->renderVertices(quad, 4, sf::PrimitiveType::TrianglesStrip, {});
+        renderer->popClipArea();
+        renderer->endFrame();
+
+        REQUIRE(getPixel(*renderer, 0, 0) == tgui::Color::White);
+        REQUIRE(getPixel(*renderer, 18, 0) == tgui::Color::White);
+        REQUIRE(getPixel(*renderer, 19, 19) == tgui::Color::Black);
+
+        REQUIRE(getPixel(*renderer, 50, 50) == tgui::Color::Yellow);
+        REQUIRE(getPixel(*renderer, 59, 59) == tgui::Color::Yellow);
+        REQUIRE(getPixel(*renderer, 49, 50) == tgui::Color::Black);
+        REQUIRE(getPixel(*renderer, 60, 59) == tgui::Color::Black);
+    }
+
+    SECTION("Out of range coordinates")
+    {
+        renderer->beginFrame(sf::View{{0, 0, 100, 80}});
+        const sf::Vertex triangle[] = {
+            {{-1e20f, -1e20f}, sf::Color::White},
+            {{1e20f, 0}, sf::Color::White},
+            {{0, 1e20f}, sf::Color::White}
+        };
+        renderer->renderVertices(triangle, 3, sf::PrimitiveType::Triangles, {});
+        renderer->endFrame();
+        REQUIRE(getPixel(*renderer, 50, 40) == tgui::Color::White);
+    }
+
+    SECTION("Texture cache")
+    {
+        sf::Image image;
+        image.create(2, 2, sf::Color::Red);
+        auto texture = std::make_unique<sf::Texture>();
+        texture->loadFromImage(image);
+
+        drawTexturedQuad(*renderer, *texture);
+        REQUIRE(getPixel(*renderer, 10, 10) == tgui::Color::Red);
+        REQUIRE(getPixel(*renderer, 29, 29) == tgui::Color::Red);
+        REQUIRE(getPixel(*renderer, 9, 10) == tgui::Color::Black);
+
+        // A texture that is created where the old one was destroyed must not show the old pixels
+        image.create(4, 4, sf::Color::Green);
+        texture = nullptr;
+        texture = std::make_unique<sf::Texture>();
+        texture->loadFromImage(image);
+        drawTexturedQuad(*renderer, *texture);
+        REQUIRE(getPixel(*renderer, 20, 20) == tgui::Color::Green);
+
+        // Changing the pixels of a texture requires calling invalidateTexture
+        image.create(4, 4, sf::Color::Blue);
+        texture->update(image);
+        renderer->invalidateTexture(*texture);
+        drawTexturedQuad(*renderer, *texture);
+        REQUIRE(getPixel(*renderer, 20, 20) == tgui::Color::Blue);
+    }
+}
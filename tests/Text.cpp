@@ -135,4 +135,35 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("LayoutCache")
+    {
+        REQUIRE(tgui::Text::getLayoutCacheCapacity() == 4096);
+
+        text.setFont("resources/DejaVuSans.ttf");
+        text.setCharacterSize(20);
+        text.setString("Some text\nover two lines");
+        const sf::Vector2f cachedSize = text.getSize();
+        const sf::String cachedWrap = tgui::Text::wordWrap(80, "Some text that has to be wrapped", text.getFont(), 20, false);
+
+        tgui::Text text2;
+        text2.setFont(text.getFont());
+        text2.setCharacterSize(20);
+        text2.setString("Some text\nover two lines");
+        REQUIRE(text2.getSize() == cachedSize);
+
+        // The style is part of the cache key
+        text2.setStyle(sf::Text::Bold);
+        REQUIRE(text2.getSize().x > cachedSize.x);
+
+        tgui::Text::setLayoutCacheCapacity(0);
+        REQUIRE(tgui::Text::getLayoutCacheCapacity() == 0);
+        tgui::Text::clearLayoutCache();
+
+        text2.setStyle(sf::Text::Regular);
+        REQUIRE(text2.getSize() == cachedSize);
+        REQUIRE(tgui::Text::wordWrap(80, "Some text that has to be wrapped", text.getFont(), 20, false) == cachedWrap);
+
+        tgui::Text::setLayoutCacheCapacity(4096);
+    }
 }
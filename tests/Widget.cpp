@@ -26,6 +26,19 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+
+namespace
+{
+    // Gives access to whether the widget currently has a cached absolute position
+    struct AbsolutePositionProbe : public tgui::ClickableWidget
+    {
+        bool hasCachedAbsolutePosition() const
+        {
+            return m_absolutePositionCached;
+        }
+    };
+}
 
 TEST_CASE("[Widget]")
 {
@@ -162,6 +175,97 @@ TEST_CASE("[Widget]")
         REQUIRE(widget4->getPosition() == sf::Vector2f(400*0.2f, 300*0.1f));
     }
 
+    SECTION("AbsolutePosition")
+    {
+        auto outerPanel = tgui::Panel::create({400, 300});
+        outerPanel->setPosition(10, 20);
+        outerPanel->getRenderer()->setBorders({0});
+        outerPanel->getRenderer()->setPadding({0});
+
+        auto innerPanel = tgui::ScrollablePanel::create({200, 100}, {500, 500});
+        innerPanel->setPosition(30, 40);
+        innerPanel->getRenderer()->setBorders({0});
+        innerPanel->getRenderer()->setPadding({0});
+        outerPanel->add(innerPanel);
+
+        widget->setPosition(5, 6);
+        innerPanel->add(widget);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(45, 66));
+
+        // Moving an ancestor updates the cached absolute position of its descendants
+        outerPanel->setPosition(100, 200);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(135, 246));
+
+        // Changing the child offset of a parent also updates the position
+        outerPanel->getRenderer()->setBorders({2});
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(137, 248));
+
+        // Scrolling moves the contents of the scrollable panel
+        innerPanel->mouseWheelScrolled(-1, innerPanel->getPosition() + sf::Vector2f{150, 90});
+        REQUIRE(innerPanel->getContentOffset().y > 0);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(137, 248) - innerPanel->getContentOffset());
+
+        // Reparenting the widget
+        innerPanel->remove(widget);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(5, 6));
+        outerPanel->add(widget);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(107, 208));
+
+        // Copies don't reuse the cached position of the original
+        auto copy = widget->clone();
+        REQUIRE(copy->getAbsolutePosition() == sf::Vector2f(5, 6));
+
+        // Scrolling a copied panel updates the widgets inside the copy
+        auto innerPanelCopy = tgui::ScrollablePanel::copy(innerPanel);
+        outerPanel->add(innerPanelCopy);
+        auto widgetInCopy = tgui::ClickableWidget::create();
+        widgetInCopy->setPosition(5, 6);
+        innerPanelCopy->add(widgetInCopy);
+        const sf::Vector2f absPosInCopy = widgetInCopy->getAbsolutePosition();
+        innerPanelCopy->mouseWheelScrolled(-1, innerPanelCopy->getPosition() + sf::Vector2f{150, 90});
+        REQUIRE(widgetInCopy->getAbsolutePosition() != absPosInCopy);
+    }
+
+    SECTION("AbsolutePosition is only invalidated for the subtree that moved")
+    {
+        auto leftPanel = tgui::Panel::create({100, 100});
+        auto rightPanel = tgui::Panel::create({100, 100});
+        rightPanel->setPosition(200, 0);
+
+        auto leftWidget = std::make_shared<AbsolutePositionProbe>();
+        auto rightWidget = std::make_shared<AbsolutePositionProbe>();
+        leftWidget->setPosition(10, 10);
+        rightWidget->setPosition(10, 10);
+        leftPanel->add(leftWidget);
+        rightPanel->add(rightWidget);
+
+        auto root = tgui::Panel::create({400, 400});
+        root->getRenderer()->setBorders({0});
+        root->getRenderer()->setPadding({0});
+        leftPanel->getRenderer()->setBorders({0});
+        rightPanel->getRenderer()->setBorders({0});
+        root->add(leftPanel);
+        root->add(rightPanel);
+
+        REQUIRE(leftWidget->getAbsolutePosition() == sf::Vector2f(10, 10));
+        REQUIRE(rightWidget->getAbsolutePosition() == sf::Vector2f(210, 10));
+        REQUIRE(leftWidget->hasCachedAbsolutePosition());
+        REQUIRE(rightWidget->hasCachedAbsolutePosition());
+
+        leftPanel->setPosition(0, 50);
+        REQUIRE(!leftWidget->hasCachedAbsolutePosition());
+        REQUIRE(rightWidget->hasCachedAbsolutePosition());
+        REQUIRE(leftWidget->getAbsolutePosition() == sf::Vector2f(10, 60));
+        REQUIRE(rightWidget->getAbsolutePosition() == sf::Vector2f(210, 10));
+
+        // Moving the common parent still reaches every descendant
+        root->setPosition(5, 5);
+        REQUIRE(!leftWidget->hasCachedAbsolutePosition());
+        REQUIRE(!rightWidget->hasCachedAbsolutePosition());
+        REQUIRE(leftWidget->getAbsolutePosition() == sf::Vector2f(15, 65));
+        REQUIRE(rightWidget->getAbsolutePosition() == sf::Vector2f(215, 15));
+    }
+
     SECTION("Size")
     {
         auto container = tgui::Panel::create();
@@ -300,6 +404,55 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Overlay on shared renderer")
+        {
+            auto sharedData = tgui::RendererData::create({{"opacity", 0.5f}, {"transparenttexture", true}});
+
+            auto widget2 = std::make_shared<tgui::ClickableWidget>();
+            widget2->setRenderer(sharedData);
+            widget2->getRenderer()->setOpacity(0.8f);
+
+            // Only the changed property is stored in the widget
+            REQUIRE(widget2->getRenderer()->getData() != sharedData);
+            REQUIRE(widget2->getRenderer()->getData()->propertyValuePairs.size() == 1);
+            REQUIRE(widget2->getRenderer()->getPropertyValuePairs().size() == 2);
+            REQUIRE(widget2->getRenderer()->getOpacity() == 0.8f);
+            REQUIRE(widget2->getRenderer()->getTransparentTexture());
+            REQUIRE(sharedData->propertyValuePairs["opacity"].getNumber() == 0.5f);
+
+            // Changes to the shared renderer are only visible when the property wasn't overridden
+            std::vector<std::string> changedProperties;
+            widget2->getRenderer()->subscribe(&changedProperties, [&](const std::string& property){ changedProperties.push_back(property); });
+            tgui::WidgetRenderer sharedRenderer{sharedData};
+            sharedRenderer.setOpacity(0.3f);
+            sharedRenderer.setTransparentTexture(false);
+            REQUIRE(widget2->getRenderer()->getOpacity() == 0.8f);
+            REQUIRE(!widget2->getRenderer()->getTransparentTexture());
+            REQUIRE(changedProperties == std::vector<std::string>{"transparenttexture"});
+            widget2->getRenderer()->unsubscribe(&changedProperties);
+
+            // A clone contains all properties
+            auto clonedRenderer = widget2->getRenderer()->clone();
+            REQUIRE(clonedRenderer->propertyValuePairs.size() == 2);
+            REQUIRE(clonedRenderer->base == nullptr);
+
+            // Textures are returned by reference, so they are copied into the overlay and changing them doesn't affect the shared data
+            sharedData->propertyValuePairs["texture"] = tgui::Texture{"resources/image.png"};
+            tgui::EditBoxRenderer editBoxRenderer{widget2->getRenderer()->getData()};
+            editBoxRenderer.getTexture().setColor(tgui::Color::Red);
+            REQUIRE(editBoxRenderer.getTexture().getColor() == tgui::Color::Red);
+            REQUIRE(sharedData->propertyValuePairs["texture"].getTexture().getColor() == tgui::Color::White);
+
+            // Reading a texture that doesn't exist adds it to the overlay instead of the shared data
+            editBoxRenderer.getTextureHover().setColor(tgui::Color::Green);
+            REQUIRE(editBoxRenderer.getTextureHover().getColor() == tgui::Color::Green);
+            REQUIRE(sharedData->propertyValuePairs.count("texturehover") == 0);
+
+            REQUIRE(sharedData->observers.size() == 1);
+            widget2 = nullptr;
+            REQUIRE(sharedData->observers.empty());
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
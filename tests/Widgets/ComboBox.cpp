@@ -214,6 +214,38 @@ TEST_CASE("[ComboBox]")
         REQUIRE(!comboBox->contains("Item 1"));
         REQUIRE(!comboBox->containsId("1"));
     }
+
+    SECTION("ItemIndex")
+    {
+        REQUIRE(!comboBox->isItemIndexEnabled());
+        comboBox->setItemIndexEnabled(true);
+        REQUIRE(comboBox->isItemIndexEnabled());
+
+        comboBox->addItem("Item 1", "1");
+        comboBox->addItem("Item 2", "2");
+        REQUIRE(comboBox->containsId("2"));
+        REQUIRE(comboBox->setSelectedItemById("2"));
+        REQUIRE(comboBox->getSelectedItem() == "Item 2");
+
+        REQUIRE(comboBox->removeItemById("2"));
+        REQUIRE(!comboBox->containsId("2"));
+        REQUIRE(comboBox->getSelectedItem() == "");
+    }
+
+    SECTION("Filter")
+    {
+        comboBox->addItem("Apple");
+        comboBox->addItem("Banana");
+        comboBox->addItem("Pineapple");
+
+        REQUIRE(comboBox->getFilter() == "");
+        comboBox->setFilter("apple");
+        REQUIRE(comboBox->getFilter() == "apple");
+        REQUIRE(comboBox->getItemCount() == 3);
+
+        comboBox->setFilter("");
+        REQUIRE(comboBox->getFilter() == "");
+    }
     
     SECTION("ItemsToDisplay")
     {
@@ -240,6 +272,26 @@ TEST_CASE("[ComboBox]")
         REQUIRE(comboBox->getItems()[2] == "Item 3");
     }
 
+    SECTION("ItemModel")
+    {
+        auto model = tgui::ItemModel::create({"Item 1", "Item 2", "Item 3"}, {"1", "2", "3"});
+        auto comboBox2 = tgui::ComboBox::create();
+        comboBox->setItemModel(model);
+        comboBox2->setItemModel(model);
+        REQUIRE(comboBox->getItemModel() == model);
+        REQUIRE(comboBox->getItemCount() == 3);
+        REQUIRE(comboBox->getItems() == model->getItems());
+
+        REQUIRE(comboBox->setSelectedItemById("3"));
+        REQUIRE(comboBox->getSelectedItem() == "Item 3");
+        REQUIRE(comboBox2->getSelectedItem() == "");
+
+        comboBox->removeItem("Item 1");
+        REQUIRE(comboBox->getItemModel() == nullptr);
+        REQUIRE(comboBox->getItemCount() == 2);
+        REQUIRE(comboBox2->getItemCount() == 3);
+    }
+
     SECTION("TextSize")
     {
         comboBox->setTextSize(25);
@@ -337,6 +337,64 @@ TEST_CASE("[EditBox]")
             REQUIRE(!editBox->setInputValidator("abc[0-"));
             REQUIRE(editBox->getInputValidator() == "abc[0-9]xyz");
         }
+
+        SECTION("Editing inside the text")
+        {
+            REQUIRE(editBox->setInputValidator("[a-z]+[0-9]*"));
+            editBox->setText("abc123");
+
+            editBox->setCaretPosition(3);
+            editBox->textEntered('d');
+            REQUIRE(editBox->getText() == "abcd123");
+
+            editBox->textEntered('4');
+            REQUIRE(editBox->getText() == "abcd4123");
+
+            editBox->textEntered('e');
+            REQUIRE(editBox->getText() == "abcd4123");
+
+            editBox->setCaretPosition(0);
+            editBox->textEntered('5');
+            REQUIRE(editBox->getText() == "abcd4123");
+
+            editBox->selectText(0, 5);
+            editBox->textEntered('5');
+            REQUIRE(editBox->getText() == "abcd4123");
+            editBox->textEntered('x');
+            REQUIRE(editBox->getText() == "x123");
+
+            editBox->setCaretPosition(4);
+            editBox->textEntered('y');
+            REQUIRE(editBox->getText() == "x123");
+            editBox->textEntered('9');
+            REQUIRE(editBox->getText() == "x1239");
+        }
+
+        SECTION("Unicode")
+        {
+            REQUIRE(editBox->setInputValidator(u8"[a-z\u00E0-\u00FF]*"));
+            editBox->setText(L"\u00EAtre");
+            REQUIRE(editBox->getText() == L"\u00EAtre");
+
+            editBox->textEntered(0xE9);
+            REQUIRE(editBox->getText() == L"\u00EAtre\u00E9");
+
+            editBox->textEntered(0x0416);
+            REQUIRE(editBox->getText() == L"\u00EAtre\u00E9");
+        }
+
+        SECTION("Patterns that require std::regex")
+        {
+            REQUIRE(editBox->setInputValidator("^[0-9]+$"));
+            editBox->setText("12");
+            REQUIRE(editBox->getText() == "12");
+
+            editBox->textEntered('3');
+            REQUIRE(editBox->getText() == "123");
+
+            editBox->textEntered('x');
+            REQUIRE(editBox->getText() == "123");
+        }
     }
 
     SECTION("Events / Signals")
@@ -247,6 +247,82 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("ItemIndex")
+    {
+        REQUIRE(!listBox->isItemIndexEnabled());
+        listBox->addItem("Item 1", "1");
+        listBox->addItem("Item 2", "2");
+        listBox->setItemIndexEnabled(true);
+        REQUIRE(listBox->isItemIndexEnabled());
+
+        listBox->addItem("Item 3", "3");
+        listBox->addItem("Item 2", "4");
+        REQUIRE(listBox->contains("Item 3"));
+        REQUIRE(listBox->containsId("4"));
+        REQUIRE(!listBox->contains("Item 4"));
+        REQUIRE(listBox->getItemById("3") == "Item 3");
+
+        // The first item with the name is used
+        REQUIRE(listBox->setSelectedItem("Item 2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        REQUIRE(listBox->removeItemById("2"));
+        REQUIRE(listBox->setSelectedItem("Item 2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+        REQUIRE(listBox->setSelectedItemById("3"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        REQUIRE(listBox->changeItemById("1", "Item 5"));
+        REQUIRE(!listBox->contains("Item 1"));
+        REQUIRE(listBox->contains("Item 5"));
+
+        listBox->removeAllItems();
+        REQUIRE(!listBox->containsId("1"));
+
+        listBox->setItemIndexEnabled(false);
+        REQUIRE(!listBox->isItemIndexEnabled());
+    }
+
+    SECTION("Filter")
+    {
+        listBox->addItem("Apple", "1");
+        listBox->addItem("Banana", "2");
+        listBox->addItem("Pineapple", "3");
+        listBox->addItem("Grape", "4");
+        REQUIRE(listBox->getFilter() == "");
+        REQUIRE(listBox->getFilteredItemCount() == 4);
+
+        listBox->setFilter("AP");
+        REQUIRE(listBox->getFilter() == "AP");
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+
+        listBox->setFilter("APP");
+        REQUIRE(listBox->getFilteredItemCount() == 2);
+
+        listBox->setFilter("ap");
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+
+        // Item indices are not affected by the filter
+        REQUIRE(listBox->getItemCount() == 4);
+        REQUIRE(listBox->setSelectedItemById("2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        listBox->addItem("Apricot");
+        listBox->addItem("Cherry");
+        REQUIRE(listBox->getFilteredItemCount() == 4);
+
+        REQUIRE(listBox->removeItem("Apple"));
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+
+        REQUIRE(listBox->changeItem("Cherry", "Papaya"));
+        REQUIRE(listBox->getFilteredItemCount() == 4);
+        REQUIRE(listBox->changeItem("Grape", "Kiwi"));
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+
+        listBox->setFilter("");
+        REQUIRE(listBox->getFilteredItemCount() == 5);
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
@@ -272,6 +348,52 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getItems()[2] == "Item 3");
     }
 
+    SECTION("ItemModel")
+    {
+        REQUIRE(listBox->getItemModel() == nullptr);
+        REQUIRE_THROWS_AS(tgui::ItemModel::create({"1", "2"}, {"1"}), tgui::Exception);
+
+        auto model = tgui::ItemModel::create({"Item 1", "Item 2", "Item 3"}, {"1", "2"});
+        REQUIRE(model->getItemCount() == 3);
+        REQUIRE(model->getItemId(2) == "");
+        REQUIRE(model->findItem("Item 2") == 1);
+        REQUIRE(model->findItemById("3") == -1);
+
+        auto listBox2 = tgui::ListBox::create();
+        listBox->addItem("Old item");
+        listBox->setItemModel(model);
+        listBox2->setItemModel(model);
+        REQUIRE(listBox->getItemModel() == model);
+        REQUIRE(listBox2->getItemModel() == model);
+        REQUIRE(listBox->getItemCount() == 3);
+        REQUIRE(listBox->getItems() == model->getItems());
+        REQUIRE(listBox->getItemIds() == model->getItemIds());
+        REQUIRE(listBox->getItemById("2") == "Item 2");
+
+        REQUIRE(listBox->setSelectedItemById("2"));
+        REQUIRE(listBox2->setSelectedItemByIndex(0));
+        REQUIRE(listBox->getSelectedItem() == "Item 2");
+        REQUIRE(listBox2->getSelectedItem() == "Item 1");
+
+        listBox->setFilter("3");
+        REQUIRE(listBox->getFilteredItemCount() == 1);
+        REQUIRE(listBox2->getFilteredItemCount() == 3);
+        listBox->setFilter("");
+
+        listBox->addItem("Item 4", "4");
+        REQUIRE(listBox->getItemModel() == nullptr);
+        REQUIRE(listBox->getItemCount() == 4);
+        REQUIRE(listBox->getItems()[1] == "Item 2");
+        REQUIRE(listBox->getItemIds()[3] == "4");
+        REQUIRE(listBox2->getItemModel() == model);
+        REQUIRE(listBox2->getItemCount() == 3);
+        REQUIRE(model->getItemCount() == 3);
+
+        listBox2->setItemModel(nullptr);
+        REQUIRE(listBox2->getItemModel() == nullptr);
+        REQUIRE(listBox2->getItemCount() == 0);
+    }
+
     SECTION("AutoScroll")
     {
         REQUIRE(listBox->getAutoScroll());
@@ -352,6 +474,20 @@ TEST_CASE("[ListBox]")
             REQUIRE(itemSelectedCount == 2);
             REQUIRE(listBox->getSelectedItemIndex() == 2);
 
+            SECTION("Filtered")
+            {
+                // The first row now shows the second item
+                listBox->setFilter("2");
+                mousePressed({40, 30});
+                mouseReleased({40, 30});
+                REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+                listBox->setFilter("");
+                mousePressed({40, 70});
+                mouseReleased({40, 70});
+                REQUIRE(listBox->getSelectedItemIndex() == 2);
+            }
+
             SECTION("Double click")
             {
                 // If a click happens a long time after the previous click then it isn't a double click
@@ -657,6 +793,15 @@ TEST_CASE("[ListBox]")
             }
         }
 
+        SECTION("Item model")
+        {
+            listBox->setItemModel(tgui::ItemModel::create({"1", "2", "3", "4", "5", "6"}));
+            listBox->setSelectedItem("4");
+            listBox->mouseMoved(mousePos3);
+            setHoverRenderer();
+            TEST_DRAW("ListBox_SelectedHoverOther_HoverSet.png")
+        }
+
         SECTION("Textured")
         {
             renderer.setTextureBackground("resources/Texture1.png");
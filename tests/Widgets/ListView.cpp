@@ -42,6 +42,11 @@ TEST_CASE("[ListView]")
         REQUIRE_NOTHROW(listView->connect("DoubleClicked", [](int){}));
         REQUIRE_NOTHROW(listView->connect("DoubleClicked", [](tgui::Widget::Ptr, std::string){}));
         REQUIRE_NOTHROW(listView->connect("DoubleClicked", [](tgui::Widget::Ptr, std::string, int){}));
+
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](){}));
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](int){}));
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](tgui::Widget::Ptr, std::string){}));
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](tgui::Widget::Ptr, std::string, int){}));
     }
 
     SECTION("WidgetType")
@@ -215,6 +220,78 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getSelectedItemIndex() == -1);
     }
 
+    SECTION("Sorting")
+    {
+        listView->addItem({"b", "10"});
+        listView->addItem({"c", "9"});
+        listView->addItem({"a", "-2.5"});
+        listView->addItem({"b", "x"});
+        REQUIRE(listView->getSortColumn() == -1);
+        REQUIRE(listView->getItemCell(2, 1) == "-2.5");
+        REQUIRE(listView->getItemCell(2, 2) == "");
+        REQUIRE(listView->getItemCell(4, 0) == "");
+
+        listView->setSelectedItem(1);
+
+        listView->sortItems(0);
+        REQUIRE(listView->getSortColumn() == 0);
+
+        // Sorting doesn't change the item indices
+        REQUIRE(listView->getItems() == std::vector<sf::String>{"b", "c", "a", "b"});
+        REQUIRE(listView->getSelectedItemIndex() == 1);
+        REQUIRE(listView->getFilteredItemCount() == 4);
+
+        listView->sortItems(1, tgui::ListView::SortMode::Numeric, false);
+        REQUIRE(listView->getSortColumn() == 1);
+
+        listView->sortItems(0, [](const sf::String& left, const sf::String& right){ return left.toAnsiString() > right.toAnsiString(); });
+        REQUIRE(listView->getSortColumn() == 0);
+
+        // Items can still be added, changed and removed while sorted
+        REQUIRE(listView->addItem({"d", "1"}) == 4);
+        REQUIRE(listView->changeSubItem(0, 0, "e"));
+        REQUIRE(listView->removeItem(2));
+        REQUIRE(listView->getItems() == std::vector<sf::String>{"e", "c", "b", "d"});
+        REQUIRE(listView->getSelectedItemIndex() == 1);
+        REQUIRE(listView->getFilteredItemCount() == 4);
+
+        listView->resetSorting();
+        REQUIRE(listView->getSortColumn() == -1);
+        REQUIRE(listView->getItems() == std::vector<sf::String>{"e", "c", "b", "d"});
+    }
+
+    SECTION("Filtering")
+    {
+        listView->addItem({"1", "keep"});
+        listView->addItem({"2", "hide"});
+        listView->addItem({"3", "keep"});
+        REQUIRE(listView->getFilteredItemCount() == 3);
+
+        const tgui::ListView* listViewPtr = listView.get();
+        listView->setFilter([listViewPtr](std::size_t index){ return listViewPtr->getItemCell(index, 1) == "keep"; });
+        REQUIRE(listView->getFilteredItemCount() == 2);
+        REQUIRE(listView->getItemCount() == 3);
+
+        listView->addItem({"4", "hide"});
+        listView->addItem({"5", "keep"});
+        REQUIRE(listView->getFilteredItemCount() == 3);
+
+        REQUIRE(listView->changeSubItem(1, 1, "keep"));
+        REQUIRE(listView->getFilteredItemCount() == 4);
+
+        REQUIRE(listView->removeItem(0));
+        REQUIRE(listView->getFilteredItemCount() == 3);
+
+        listView->sortItems(0, tgui::ListView::SortMode::Numeric, false);
+        REQUIRE(listView->getFilteredItemCount() == 3);
+
+        listView->setFilter(nullptr);
+        REQUIRE(listView->getFilteredItemCount() == 4);
+
+        listView->removeAllItems();
+        REQUIRE(listView->getFilteredItemCount() == 0);
+    }
+
     SECTION("Header height")
     {
         listView->setHeaderHeight(50);
@@ -467,6 +544,19 @@ TEST_CASE("[ListView]")
                 mouseReleased({40, 70});
                 REQUIRE(doubleClickedCount == 1);
             }
+
+            SECTION("Sorted")
+            {
+                // The first row now contains the third item
+                listView->sortItems(0, tgui::ListView::SortMode::Lexical, false);
+                mousePressed({12, 22});
+                mouseReleased({12, 22});
+                REQUIRE(listView->getSelectedItemIndex() == 2);
+
+                mousePressed({40, 70});
+                mouseReleased({40, 70});
+                REQUIRE(listView->getSelectedItemIndex() == 0);
+            }
         }
 
         SECTION("Click on header")
@@ -475,9 +565,17 @@ TEST_CASE("[ListView]")
             listView->addColumn("Col 1", 50);
             listView->addColumn("Col 2", 50);
 
+            int clickedColumn = -1;
+            listView->connect("HeaderClicked", [&](int column){ clickedColumn = column; });
+
             mousePressed({40, 35});
             mouseReleased({40, 35});
             REQUIRE(listView->getSelectedItemIndex() == -1);
+            REQUIRE(clickedColumn == 0);
+
+            mousePressed({68, 35});
+            mouseReleased({68, 35});
+            REQUIRE(clickedColumn == 1);
 
             listView->setHeaderVisible(false);
             mousePressed({40, 35});
@@ -25,6 +25,8 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <fstream>
+#include <thread>
 
 TEST_CASE("[TextBox]")
 {
@@ -202,6 +204,41 @@ TEST_CASE("[TextBox]")
         REQUIRE(textBox->getLinesCount() == 4);
     }
 
+    SECTION("Document")
+    {
+        {
+            std::ofstream stream("TextBoxDocument.txt");
+            for (unsigned int i = 0; i < 100; ++i)
+                stream << "Line " << i << "\n";
+        }
+
+        textBox->setText("Some text");
+        textBox->openDocument("TextBoxDocument.txt");
+        REQUIRE(textBox->isDocumentOpen());
+        REQUIRE(textBox->getText() == "");
+
+        // The lines are found in the background
+        for (unsigned int i = 0; (i < 1000) && (textBox->getLinesCount() != 101); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        REQUIRE(textBox->getLinesCount() == 101);
+
+        textBox->textEntered('x');
+        REQUIRE(textBox->getText() == "");
+        REQUIRE(textBox->isDocumentOpen());
+
+        textBox->setText("Other text");
+        REQUIRE(!textBox->isDocumentOpen());
+        REQUIRE(textBox->getLinesCount() == 1);
+
+        textBox->openDocument("TextBoxDocument.txt");
+        textBox->closeDocument();
+        REQUIRE(!textBox->isDocumentOpen());
+        REQUIRE(textBox->getText() == "");
+
+        REQUIRE_THROWS_AS(textBox->openDocument("NonexistentFile.txt"), tgui::Exception);
+        REQUIRE(!textBox->isDocumentOpen());
+    }
+
     SECTION("Events / Signals")
     {
         textBox->setSize(165, 100);